@@ -267,8 +267,9 @@ MU_TEST_1(flipper_format_read_and_update_test, FlipperFormat* flipper_format) {
         flipper_format, test_uint_key, ARRAY_W_COUNT(uint32_updated_data)));
 }
 
-MU_TEST(flipper_format_string_test) {
+MU_TEST_1(flipper_format_string_test, bool indexed_mode) {
     FlipperFormat* flipper_format = flipper_format_string_alloc();
+    flipper_format_set_indexed_mode(flipper_format, indexed_mode);
     Stream* stream = flipper_format_get_raw_stream(flipper_format);
 
     mu_check(flipper_format_write_header_cstr(flipper_format, test_filetype, test_version));
@@ -295,9 +296,10 @@ MU_TEST(flipper_format_string_test) {
     flipper_format_free(flipper_format);
 }
 
-MU_TEST(flipper_format_file_test) {
+MU_TEST_1(flipper_format_file_test, bool indexed_mode) {
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
+    flipper_format_set_indexed_mode(flipper_format, indexed_mode);
     mu_check(flipper_format_file_open_always(flipper_format, EXT_PATH("flipper.fff")));
     Stream* stream = flipper_format_get_raw_stream(flipper_format);
 
@@ -326,9 +328,105 @@ MU_TEST(flipper_format_file_test) {
     furi_record_close(RECORD_STORAGE);
 }
 
+#define TEST_INDEX_BLOCK_COUNT 256
+#define TEST_INDEX_BLOCK_SIZE 16
+
+static bool flipper_format_index_read_blocks(
+    FlipperFormat* flipper_format,
+    uint8_t* data,
+    bool reverse,
+    uint32_t* time) {
+    FuriString* key = furi_string_alloc();
+    bool result = true;
+    uint32_t start = furi_get_tick();
+
+    flipper_format_rewind(flipper_format);
+    for(size_t i = 0; i < TEST_INDEX_BLOCK_COUNT; i++) {
+        size_t block = reverse ? (TEST_INDEX_BLOCK_COUNT - 1 - i) : i;
+        furi_string_printf(key, "Block %u", block);
+        if(reverse) flipper_format_rewind(flipper_format);
+        if(!flipper_format_read_hex(
+               flipper_format,
+               furi_string_get_cstr(key),
+               &data[block * TEST_INDEX_BLOCK_SIZE],
+               TEST_INDEX_BLOCK_SIZE)) {
+            result = false;
+            break;
+        }
+    }
+
+    *time = furi_get_tick() - start;
+    furi_string_free(key);
+    return result;
+}
+
+MU_TEST(flipper_format_index_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* flipper_format = flipper_format_buffered_file_alloc(storage);
+    uint8_t* expected = malloc(TEST_INDEX_BLOCK_COUNT * TEST_INDEX_BLOCK_SIZE);
+    uint8_t* data = malloc(TEST_INDEX_BLOCK_COUNT * TEST_INDEX_BLOCK_SIZE);
+    FuriString* key = furi_string_alloc();
+    uint32_t time[2][2];
+
+    // Mifare Classic 4K sized dump
+    mu_check(flipper_format_buffered_file_open_always(flipper_format, EXT_PATH("flipper.fff")));
+    mu_check(flipper_format_write_header_cstr(flipper_format, test_filetype, test_version));
+    mu_check(flipper_format_write_comment_cstr(flipper_format, "Mifare Classic blocks"));
+    for(size_t i = 0; i < TEST_INDEX_BLOCK_COUNT * TEST_INDEX_BLOCK_SIZE; i++) {
+        expected[i] = i * 7 + i / TEST_INDEX_BLOCK_SIZE;
+    }
+    for(size_t i = 0; i < TEST_INDEX_BLOCK_COUNT; i++) {
+        furi_string_printf(key, "Block %u", i);
+        mu_check(flipper_format_write_hex(
+            flipper_format,
+            furi_string_get_cstr(key),
+            &expected[i * TEST_INDEX_BLOCK_SIZE],
+            TEST_INDEX_BLOCK_SIZE));
+    }
+    mu_check(flipper_format_buffered_file_close(flipper_format));
+
+    for(size_t indexed = 0; indexed < 2; indexed++) {
+        mu_check(
+            flipper_format_buffered_file_open_existing(flipper_format, EXT_PATH("flipper.fff")));
+        flipper_format_set_indexed_mode(flipper_format, indexed);
+        for(size_t reverse = 0; reverse < 2; reverse++) {
+            memset(data, 0, TEST_INDEX_BLOCK_COUNT * TEST_INDEX_BLOCK_SIZE);
+            mu_check(flipper_format_index_read_blocks(
+                flipper_format, data, reverse, &time[indexed][reverse]));
+            mu_assert_mem_eq(expected, data, TEST_INDEX_BLOCK_COUNT * TEST_INDEX_BLOCK_SIZE);
+        }
+        // Missing key, strict mode
+        mu_check(flipper_format_rewind(flipper_format));
+        mu_check(!flipper_format_key_exist(flipper_format, "Block 256"));
+        flipper_format_set_strict_mode(flipper_format, true);
+        mu_check(!flipper_format_read_hex(flipper_format, "Block 1", data, TEST_INDEX_BLOCK_SIZE));
+        flipper_format_set_strict_mode(flipper_format, false);
+        mu_check(flipper_format_buffered_file_close(flipper_format));
+    }
+
+    FURI_LOG_I(
+        "FlipperFormatTest",
+        "Read %u blocks: %lums/%lums forward, %lums/%lums reverse (scan/indexed)",
+        TEST_INDEX_BLOCK_COUNT,
+        time[0][0],
+        time[1][0],
+        time[0][1],
+        time[1][1]);
+
+    mu_check(storage_simply_remove(storage, EXT_PATH("flipper.fff")));
+    furi_string_free(key);
+    free(data);
+    free(expected);
+    flipper_format_free(flipper_format);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(flipper_format_string_suite) {
-    MU_RUN_TEST(flipper_format_string_test);
-    MU_RUN_TEST(flipper_format_file_test);
+    MU_RUN_TEST_1(flipper_format_string_test, false);
+    MU_RUN_TEST_1(flipper_format_string_test, true);
+    MU_RUN_TEST_1(flipper_format_file_test, false);
+    MU_RUN_TEST_1(flipper_format_file_test, true);
+    MU_RUN_TEST(flipper_format_index_test);
 }
 
 int run_minunit_test_flipper_format_string() {
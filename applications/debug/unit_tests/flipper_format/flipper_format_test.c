@@ -2,8 +2,10 @@
 #include <flipper_format/flipper_format.h>
 #include <flipper_format/flipper_format_i.h>
 #include <toolbox/stream/stream.h>
+#include <toolbox/stream/file_stream.h>
 #include "../minunit.h"
 
+#define TAG "FlipperFormatTest"
 #define TEST_DIR TEST_DIR_NAME "/"
 #define TEST_DIR_NAME EXT_PATH("unit_tests_tmp")
 
@@ -522,6 +524,37 @@ MU_TEST(flipper_format_multikey_test) {
     mu_assert(test_read_multikey(TEST_DIR "ff_multiline.test"), "Multikey read test error");
 }
 
+MU_TEST(flipper_format_read_cache_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* file = flipper_format_file_alloc(storage);
+    FuriString* string_value = furi_string_alloc();
+    uint32_t uint32_value;
+    uint8_t uint8_value;
+
+    // Opened for read and write, like every flipper format file
+    mu_check(flipper_format_file_open_existing(file, TEST_DIR "ff_multiline.test"));
+    mu_check(flipper_format_read_header(file, string_value, &uint32_value));
+    for(uint8_t index = 0; index < 100; index++) {
+        mu_check(flipper_format_read_hex(file, test_hex_key, &uint8_value, 1));
+        mu_assert_int_eq(index, uint8_value);
+    }
+
+    StorageFileCacheStats stats;
+    file_stream_get_cache_stats(flipper_format_get_raw_stream(file), &stats);
+    FURI_LOG_I(
+        TAG,
+        "Read cache: %lu reads, %lu hits, %lu requests",
+        stats.read_calls,
+        stats.read_hits,
+        stats.requests);
+    mu_check(stats.read_hits > stats.read_calls / 2);
+    mu_check(stats.requests < stats.read_calls);
+
+    furi_string_free(string_value);
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST(flipper_format_oddities_test) {
     mu_assert(
         storage_write_string(test_file_oddities, test_data_odd), "Write test error [Oddities]");
@@ -541,6 +574,7 @@ MU_TEST_SUITE(flipper_format) {
     MU_RUN_TEST(flipper_format_update_2_test);
     MU_RUN_TEST(flipper_format_update_2_result_test);
     MU_RUN_TEST(flipper_format_multikey_test);
+    MU_RUN_TEST(flipper_format_read_cache_test);
     MU_RUN_TEST(flipper_format_oddities_test);
     tests_teardown();
 }
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <core/common_defines.h>
 
 void test_furi_memmgr() {
     void* ptr;
@@ -26,9 +27,57 @@ void test_furi_memmgr() {
         mu_assert_int_eq(66, ((uint8_t*)ptr)[i]);
     }
 
-    // TODO FL-3492: fix realloc to copy only old size, and write testcase that leftover of reallocated memory is zero-initialized
+    // test that leftover of reallocated memory is zero-initialized
+    for(int i = 100; i < 200; i++) {
+        mu_assert_int_eq(0, ((uint8_t*)ptr)[i]);
+    }
+
+    // shrink keeps data and pointer
+    void* old_ptr = ptr;
+    ptr = realloc(ptr, 50);
+    mu_check(ptr == old_ptr);
+    for(int i = 0; i < 50; i++) {
+        mu_assert_int_eq(66, ((uint8_t*)ptr)[i]);
+    }
+
+    // growing back over released tail keeps data, new part is zeroed
+    ptr = realloc(ptr, 150);
+    mu_check(ptr != NULL);
+    for(int i = 0; i < 50; i++) {
+        mu_assert_int_eq(66, ((uint8_t*)ptr)[i]);
+    }
+    for(int i = 50; i < 150; i++) {
+        mu_assert_int_eq(0, ((uint8_t*)ptr)[i]);
+    }
     free(ptr);
 
+    // realloc of NULL allocates, realloc to zero frees
+    ptr = realloc(NULL, 16);
+    mu_check(ptr != NULL);
+    mu_check(realloc(ptr, 0) == NULL);
+
+    // small blocks are reused and come back zeroed
+    for(size_t size = 1; size <= 64; size++) {
+        uint8_t* small[4];
+        for(size_t i = 0; i < COUNT_OF(small); i++) {
+            small[i] = malloc(size);
+            mu_check(small[i] != NULL);
+            memset(small[i], 0xAA, size);
+        }
+        for(size_t i = 0; i < COUNT_OF(small); i++) {
+            free(small[i]);
+        }
+        for(size_t i = 0; i < COUNT_OF(small); i++) {
+            small[i] = malloc(size);
+            for(size_t j = 0; j < size; j++) {
+                mu_assert_int_eq(0, small[i][j]);
+            }
+        }
+        for(size_t i = 0; i < COUNT_OF(small); i++) {
+            free(small[i]);
+        }
+    }
+
     // allocate and zero-initialize array (calloc)
     ptr = calloc(100, 2);
     mu_check(ptr != NULL);
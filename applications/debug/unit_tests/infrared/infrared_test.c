@@ -2,11 +2,15 @@
 #include <flipper_format.h>
 #include <infrared.h>
 #include <common/infrared_common_i.h>
+#include <infrared/infrared_remote.h>
+#include <toolbox/stream/file_stream.h>
 #include "../minunit.h"
 
 #define IR_TEST_FILES_DIR EXT_PATH("unit_tests/infrared/")
 #define IR_TEST_FILE_PREFIX "test_"
 #define IR_TEST_FILE_SUFFIX ".irtest"
+#define IR_TEST_REMOTE_PATH EXT_PATH("unit_tests/infrared/remote_test.ir")
+#define IR_TEST_REMOTE_BUTTONS 8
 
 typedef struct {
     InfraredDecoderHandler* decoder_handler;
@@ -522,6 +526,115 @@ MU_TEST(infrared_test_encoder_decoder_all) {
     infrared_test_run_encoder_decoder(InfraredProtocolRCA, 1);
 }
 
+MU_TEST(infrared_test_remote_rename) {
+    InfraredRemote* remote = infrared_remote_alloc();
+    InfraredSignal* signal = infrared_signal_alloc();
+    FuriString* path = furi_string_alloc_set(IR_TEST_REMOTE_PATH);
+    FuriString* name = furi_string_alloc();
+
+    // Remote keeps only a few signals loaded, first buttons are evicted and stay on disk
+    infrared_remote_set_path(remote, IR_TEST_REMOTE_PATH);
+    for(uint32_t i = 0; i < IR_TEST_REMOTE_BUTTONS; i++) {
+        InfraredMessage message = {
+            .protocol = InfraredProtocolNEC,
+            .address = i,
+            .command = i,
+        };
+        infrared_signal_set_message(signal, &message);
+        furi_string_printf(name, "button_%lu", i);
+        mu_assert(
+            infrared_remote_add_button(remote, furi_string_get_cstr(name), signal),
+            "failed to add button");
+    }
+
+    // Reload, so no signal is loaded
+    mu_assert(infrared_remote_load(remote, path), "failed to load remote");
+    mu_assert(
+        infrared_remote_get_button_count(remote) == IR_TEST_REMOTE_BUTTONS, "wrong button count");
+    mu_assert(infrared_remote_rename_button(remote, "renamed", 1), "failed to rename button");
+
+    mu_assert(infrared_remote_load(remote, path), "failed to reload remote");
+    for(uint32_t i = 0; i < IR_TEST_REMOTE_BUTTONS; i++) {
+        furi_string_printf(name, "button_%lu", i);
+        const char* expected = (i == 1) ? "renamed" : furi_string_get_cstr(name);
+        mu_assert_string_eq(
+            expected, infrared_remote_button_get_name(infrared_remote_get_button(remote, i)));
+
+        InfraredSignal* loaded = infrared_remote_get_signal(remote, i);
+        mu_assert(loaded, "failed to load signal");
+        mu_assert(
+            infrared_signal_get_message(loaded)->command == i, "wrong signal after rename");
+    }
+
+    mu_assert(infrared_remote_remove(remote), "failed to remove remote");
+
+    furi_string_free(name);
+    furi_string_free(path);
+    infrared_signal_free(signal);
+    infrared_remote_free(remote);
+}
+
+#define IR_TEST_REMOTE_BAD_SIGNAL \
+    "type: parsed\nprotocol: Unknown\naddress: 01 00 00 00\ncommand: 02 00 00 00\n"
+
+MU_TEST(infrared_test_remote_bad_signal) {
+    InfraredRemote* remote = infrared_remote_alloc();
+    FuriString* path = furi_string_alloc_set(IR_TEST_REMOTE_PATH);
+    FuriString* data = furi_string_alloc();
+    FuriString* line = furi_string_alloc();
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    Stream* stream = file_stream_alloc(storage);
+    mu_assert(
+        file_stream_open(stream, IR_TEST_REMOTE_PATH, FSAM_WRITE, FSOM_CREATE_ALWAYS),
+        "failed to create remote");
+    stream_write_cstring(
+        stream,
+        "Filetype: IR signals file\nVersion: 1\n"
+        "#\nname: first\ntype: parsed\nprotocol: NEC\n"
+        "address: 01 00 00 00\ncommand: 01 00 00 00\n"
+        "#\nname: bad\n" IR_TEST_REMOTE_BAD_SIGNAL "#\nname: last\ntype: parsed\nprotocol: NEC\n"
+        "address: 03 00 00 00\ncommand: 03 00 00 00\n");
+    mu_assert(file_stream_close(stream), "failed to write remote");
+
+    // Signal that can not be parsed must not block changes of the other ones
+    mu_assert(infrared_remote_load(remote, path), "failed to load remote");
+    mu_assert(infrared_remote_get_button_count(remote) == 3, "wrong button count");
+    mu_assert(infrared_remote_get_signal(remote, 1) == NULL, "bad signal loaded");
+    mu_assert(infrared_remote_rename_button(remote, "renamed", 1), "failed to rename bad signal");
+    mu_assert(infrared_remote_delete_button(remote, 0), "failed to delete button");
+
+    mu_assert(infrared_remote_load(remote, path), "failed to reload remote");
+    mu_assert(infrared_remote_get_button_count(remote) == 2, "wrong button count after delete");
+    mu_assert_string_eq(
+        "renamed", infrared_remote_button_get_name(infrared_remote_get_button(remote, 0)));
+    InfraredSignal* last = infrared_remote_get_signal(remote, 1);
+    mu_assert(last, "failed to load signal");
+    mu_assert(infrared_signal_get_message(last)->command == 3, "wrong signal after delete");
+
+    // Body of the bad signal is kept as is
+    mu_assert(
+        file_stream_open(stream, IR_TEST_REMOTE_PATH, FSAM_READ, FSOM_OPEN_EXISTING),
+        "failed to open remote");
+    while(stream_read_line(stream, line)) {
+        furi_string_cat(data, line);
+    }
+    mu_assert(
+        furi_string_search_str(data, "name: renamed\n" IR_TEST_REMOTE_BAD_SIGNAL "#\n") !=
+            FURI_STRING_FAILURE,
+        "bad signal body changed");
+    file_stream_close(stream);
+    stream_free(stream);
+    furi_record_close(RECORD_STORAGE);
+
+    mu_assert(infrared_remote_remove(remote), "failed to remove remote");
+
+    furi_string_free(line);
+    furi_string_free(data);
+    furi_string_free(path);
+    infrared_remote_free(remote);
+}
+
 MU_TEST_SUITE(infrared_test) {
     MU_SUITE_CONFIGURE(&infrared_test_alloc, &infrared_test_free);
 
@@ -541,6 +654,8 @@ MU_TEST_SUITE(infrared_test) {
     MU_RUN_TEST(infrared_test_decoder_rca);
     MU_RUN_TEST(infrared_test_decoder_mixed);
     MU_RUN_TEST(infrared_test_encoder_decoder_all);
+    MU_RUN_TEST(infrared_test_remote_rename);
+    MU_RUN_TEST(infrared_test_remote_bad_signal);
 }
 
 int run_minunit_test_infrared() {
@@ -79,6 +79,74 @@ MU_TEST(test_bit_lib_push) {
     mu_assert_mem_eq(expected_data_6, data, TEST_BIT_LIB_PUSH_DATA_SIZE);
 }
 
+MU_TEST(test_bit_lib_window) {
+#define TEST_BIT_LIB_WINDOW_DATA_SIZE 5
+    uint8_t data[TEST_BIT_LIB_WINDOW_DATA_SIZE] = {0};
+    uint8_t copy[TEST_BIT_LIB_WINDOW_DATA_SIZE] = {0};
+    uint8_t buffer[BIT_LIB_WINDOW_BUFFER_SIZE(TEST_BIT_LIB_WINDOW_DATA_SIZE)];
+    BitLibWindow window;
+    bit_lib_window_init(&window, buffer, TEST_BIT_LIB_WINDOW_DATA_SIZE);
+
+    // window must always look like a bit_lib_push_bit array, including after wrap around
+    uint32_t seed = 0x12345678;
+    for(uint32_t i = 0; i < TEST_BIT_LIB_WINDOW_DATA_SIZE * 8 * 5 + 3; ++i) {
+        seed = seed * 1103515245 + 12345;
+        bool bit = (seed >> 16) & 1;
+        bit_lib_push_bit(data, TEST_BIT_LIB_WINDOW_DATA_SIZE, bit);
+        bit_lib_window_push_bit(&window, bit);
+
+        bit_lib_window_copy(&window, copy);
+        mu_assert_mem_eq(data, copy, TEST_BIT_LIB_WINDOW_DATA_SIZE);
+
+        for(size_t position = 0; position < TEST_BIT_LIB_WINDOW_DATA_SIZE * 8; ++position) {
+            mu_assert_int_eq(
+                bit_lib_get_bit(data, position), bit_lib_window_get_bit(&window, position));
+        }
+        mu_assert_int_eq(bit_lib_get_bits(data, 3, 7), bit_lib_window_get_bits(&window, 3, 7));
+        mu_assert_int_eq(
+            bit_lib_get_bits_16(data, 11, 13), bit_lib_window_get_bits_16(&window, 11, 13));
+        mu_assert_int_eq(
+            bit_lib_get_bits_32(data, 8, 32), bit_lib_window_get_bits_32(&window, 8, 32));
+    }
+
+    bit_lib_window_reset(&window);
+    memset(data, 0, TEST_BIT_LIB_WINDOW_DATA_SIZE);
+    bit_lib_window_copy(&window, copy);
+    mu_assert_mem_eq(data, copy, TEST_BIT_LIB_WINDOW_DATA_SIZE);
+}
+
+MU_TEST(test_bit_lib_window_speed) {
+#define TEST_BIT_LIB_WINDOW_SPEED_DATA_SIZE 17
+#define TEST_BIT_LIB_WINDOW_SPEED_BITS 100000
+    uint8_t data[TEST_BIT_LIB_WINDOW_SPEED_DATA_SIZE] = {0};
+    uint8_t copy[TEST_BIT_LIB_WINDOW_SPEED_DATA_SIZE] = {0};
+    uint8_t buffer[BIT_LIB_WINDOW_BUFFER_SIZE(TEST_BIT_LIB_WINDOW_SPEED_DATA_SIZE)];
+    BitLibWindow window;
+    bit_lib_window_init(&window, buffer, TEST_BIT_LIB_WINDOW_SPEED_DATA_SIZE);
+
+    uint32_t push_time = furi_get_tick();
+    for(uint32_t i = 0; i < TEST_BIT_LIB_WINDOW_SPEED_BITS; ++i) {
+        bit_lib_push_bit(data, TEST_BIT_LIB_WINDOW_SPEED_DATA_SIZE, i % 3 == 0);
+    }
+    push_time = furi_get_tick() - push_time;
+
+    uint32_t window_time = furi_get_tick();
+    for(uint32_t i = 0; i < TEST_BIT_LIB_WINDOW_SPEED_BITS; ++i) {
+        bit_lib_window_push_bit(&window, i % 3 == 0);
+    }
+    window_time = furi_get_tick() - window_time;
+
+    FURI_LOG_I(
+        "BitLibTest",
+        "%d bits: push_bit %lums, window %lums",
+        TEST_BIT_LIB_WINDOW_SPEED_BITS,
+        push_time,
+        window_time);
+
+    bit_lib_window_copy(&window, copy);
+    mu_assert_mem_eq(data, copy, TEST_BIT_LIB_WINDOW_SPEED_DATA_SIZE);
+}
+
 MU_TEST(test_bit_lib_set_bit) {
     uint8_t value[2] = {0x00, 0xFF};
     bit_lib_set_bit(value, 15, false);
@@ -451,6 +519,8 @@ MU_TEST_SUITE(test_bit_lib) {
     MU_RUN_TEST(test_bit_lib_increment_index);
     MU_RUN_TEST(test_bit_lib_is_set);
     MU_RUN_TEST(test_bit_lib_push);
+    MU_RUN_TEST(test_bit_lib_window);
+    MU_RUN_TEST(test_bit_lib_window_speed);
     MU_RUN_TEST(test_bit_lib_set_bit);
     MU_RUN_TEST(test_bit_lib_set_bits);
     MU_RUN_TEST(test_bit_lib_get_bit);
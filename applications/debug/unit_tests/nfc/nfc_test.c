@@ -3,7 +3,9 @@
 #include <storage/storage.h>
 #include <lib/flipper_format/flipper_format.h>
 #include <lib/nfc/protocols/nfca.h>
+#include <lib/nfc/protocols/crypto1.h>
 #include <lib/nfc/helpers/mf_classic_dict.h>
+#include <lib/nfc/helpers/mf_classic_key_scheduler.h>
 #include <lib/digital_signal/digital_signal.h>
 #include <lib/nfc/nfc_device.h>
 #include <lib/nfc/helpers/nfc_generators.h>
@@ -19,6 +21,7 @@
 #define NFC_TEST_SIGNAL_SHORT_FILE "nfc_nfca_signal_short.nfc"
 #define NFC_TEST_SIGNAL_LONG_FILE "nfc_nfca_signal_long.nfc"
 #define NFC_TEST_DICT_PATH EXT_PATH("unit_tests/mf_classic_dict.nfc")
+#define NFC_TEST_DICT_INDEX_PATH EXT_PATH("unit_tests/mf_classic_dict.mfd")
 #define NFC_TEST_NFC_DEV_PATH EXT_PATH("unit_tests/nfc/nfc_dev_test.nfc")
 
 static const char* nfc_test_file_type = "Flipper NFC test";
@@ -310,7 +313,8 @@ MU_TEST(mf_classic_dict_load_test) {
     mu_assert(
         mf_classic_dict_get_next_key_str(instance, temp_str),
         "get_next_key_str == true assert failed\r\n");
-    mu_assert(furi_string_cmp_str(temp_str, key_str) == 0, "invalid key loaded\r\n");
+    // Keys are loaded from compiled dictionary, so letter case isn't preserved
+    mu_assert(furi_string_cmpi_str(temp_str, key_str) == 0, "invalid key loaded\r\n");
     mu_assert(mf_classic_dict_rewind(instance), "mf_classic_dict_rewind == 1 assert failed\r\n");
     mu_assert(
         mf_classic_dict_get_next_key(instance, &key_dut),
@@ -332,10 +336,285 @@ MU_TEST(mf_classic_dict_load_test) {
     // Delete unit test dict file
     mu_assert(
         storage_simply_remove(storage, NFC_TEST_DICT_PATH), "remove == true assert failed\r\n");
+    mu_assert(
+        storage_simply_remove(storage, NFC_TEST_DICT_INDEX_PATH),
+        "remove == true assert failed\r\n");
+    stream_free(file_stream);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(mf_classic_dict_index_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    mu_assert(storage != NULL, "storage != NULL assert failed\r\n");
+
+    mu_assert(
+        storage_simply_remove(storage, NFC_TEST_DICT_PATH), "remove == true assert failed\r\n");
+    mu_assert(
+        storage_simply_remove(storage, NFC_TEST_DICT_INDEX_PATH),
+        "remove == true assert failed\r\n");
+
+    // Create unit test dict file, keys are not sorted
+    Stream* file_stream = file_stream_alloc(storage);
+    mu_assert(
+        file_stream_open(file_stream, NFC_TEST_DICT_PATH, FSAM_WRITE, FSOM_OPEN_ALWAYS),
+        "file_stream_open == true assert failed\r\n");
+    const char* dict_str = "# Comment\nFFFFFFFFFFFF\na0a1a2a3a4a5\nnot a key\n000000000000\n"
+                           "D3F7D3F7D3F7\n";
+    mu_assert(
+        stream_write_cstring(file_stream, dict_str) == strlen(dict_str),
+        "write == true assert failed\r\n");
+    mu_assert(file_stream_close(file_stream), "file_stream_close == true assert failed\r\n");
+
+    MfClassicDict* instance = mf_classic_dict_alloc(MfClassicDictTypeUnitTest);
+    mu_assert(instance != NULL, "mf_classic_dict_alloc\r\n");
+    mu_assert(mf_classic_dict_get_total_keys(instance) == 4, "total_keys == 4 assert failed\r\n");
+
+    // Lookups go to sorted keys, indexes follow file order
+    uint8_t key_present[6] = {0xD3, 0xF7, 0xD3, 0xF7, 0xD3, 0xF7};
+    uint8_t key_absent[6] = {0xD3, 0xF7, 0xD3, 0xF7, 0xD3, 0xF8};
+    uint32_t index = 0;
+    uint64_t key = 0;
+    mu_assert(mf_classic_dict_is_key_present(instance, key_present), "key not found\r\n");
+    mu_assert(!mf_classic_dict_is_key_present(instance, key_absent), "absent key found\r\n");
+    mu_assert(mf_classic_dict_find_index(instance, key_present, &index), "key not found\r\n");
+    mu_assert(index == 3, "index == 3 assert failed\r\n");
+    mu_assert(mf_classic_dict_get_key_at_index(instance, &key, 1), "get_key_at_index failed\r\n");
+    mu_assert(key == 0xA0A1A2A3A4A5, "invalid key at index 1\r\n");
+    mu_assert(!mf_classic_dict_get_key_at_index(instance, &key, 4), "key out of range\r\n");
+
+    // Added keys are searchable right away
+    mu_assert(mf_classic_dict_add_key(instance, key_absent), "add_key == true assert failed\r\n");
+    uint8_t key_first[6] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
+    mu_assert(mf_classic_dict_add_key(instance, key_first), "add_key == true assert failed\r\n");
+    mu_assert(mf_classic_dict_get_total_keys(instance) == 6, "total_keys == 6 assert failed\r\n");
+    mu_assert(mf_classic_dict_is_key_present(instance, key_absent), "key not found\r\n");
+    mu_assert(mf_classic_dict_is_key_present(instance, key_first), "key not found\r\n");
+    mu_assert(mf_classic_dict_is_key_present(instance, key_present), "key not found\r\n");
+    mu_assert(mf_classic_dict_find_index(instance, key_first, &index), "key not found\r\n");
+    mu_assert(index == 5, "index == 5 assert failed\r\n");
+    mf_classic_dict_free(instance);
+
+    // Compiled dictionary is reused and keeps file order
+    const uint64_t keys_ref[] = {
+        0xFFFFFFFFFFFF,
+        0xA0A1A2A3A4A5,
+        0x000000000000,
+        0xD3F7D3F7D3F7,
+        0xD3F7D3F7D3F8,
+        0x000000000001,
+    };
+    instance = mf_classic_dict_alloc(MfClassicDictTypeUnitTest);
+    mu_assert(instance != NULL, "mf_classic_dict_alloc\r\n");
+    mu_assert(mf_classic_dict_get_total_keys(instance) == 6, "total_keys == 6 assert failed\r\n");
+    for(size_t i = 0; i < COUNT_OF(keys_ref); i++) {
+        mu_assert(mf_classic_dict_get_next_key(instance, &key), "get_next_key failed\r\n");
+        mu_assert(key == keys_ref[i], "invalid key order\r\n");
+    }
+    mu_assert(!mf_classic_dict_get_next_key(instance, &key), "get_next_key past end\r\n");
+    mf_classic_dict_free(instance);
+
+    // Changes made to text dictionary by others are picked up
+    mu_assert(
+        file_stream_open(file_stream, NFC_TEST_DICT_PATH, FSAM_WRITE, FSOM_OPEN_APPEND),
+        "file_stream_open == true assert failed\r\n");
+    const char* key_str = "4D3A99C351DD\n";
+    mu_assert(
+        stream_write_cstring(file_stream, key_str) == strlen(key_str),
+        "write == true assert failed\r\n");
+    mu_assert(file_stream_close(file_stream), "file_stream_close == true assert failed\r\n");
+
+    instance = mf_classic_dict_alloc(MfClassicDictTypeUnitTest);
+    mu_assert(instance != NULL, "mf_classic_dict_alloc\r\n");
+    mu_assert(mf_classic_dict_get_total_keys(instance) == 7, "total_keys == 7 assert failed\r\n");
+    FuriString* temp_str = furi_string_alloc_set("4D3A99C351DD");
+    mu_assert(mf_classic_dict_is_key_present_str(instance, temp_str), "key not found\r\n");
+
+    // Deleted keys are gone from lookups
+    mu_assert(mf_classic_dict_delete_index(instance, 3), "delete_index failed\r\n");
+    mu_assert(mf_classic_dict_get_total_keys(instance) == 6, "total_keys == 6 assert failed\r\n");
+    mu_assert(!mf_classic_dict_is_key_present(instance, key_present), "deleted key found\r\n");
+    mu_assert(mf_classic_dict_get_key_at_index(instance, &key, 3), "get_key_at_index failed\r\n");
+    mu_assert(key == 0xD3F7D3F7D3F8, "invalid key at index 3\r\n");
+    furi_string_free(temp_str);
+    mf_classic_dict_free(instance);
+
+    mu_assert(
+        storage_simply_remove(storage, NFC_TEST_DICT_PATH), "remove == true assert failed\r\n");
+    mu_assert(
+        storage_simply_remove(storage, NFC_TEST_DICT_INDEX_PATH),
+        "remove == true assert failed\r\n");
+    stream_free(file_stream);
+    furi_record_close(RECORD_STORAGE);
+}
+
+#define NFC_TEST_SCHEDULER_DICT_KEYS (40)
+#define NFC_TEST_SCHEDULER_KEY_ABSENT (0x123456789ABC)
+
+typedef struct {
+    uint8_t sectors;
+    uint64_t keys[MF_CLASSIC_1K_TOTAL_SECTORS_NUM][2];
+} NfcTestCardModel;
+
+static uint64_t nfc_test_scheduler_dict_key(uint32_t index) {
+    return index == 0 ? 0xFFFFFFFFFFFF : 0xA0A1A2A30000 + index;
+}
+
+static uint32_t nfc_test_scheduler_dict_tries(uint64_t key) {
+    for(uint32_t i = 0; i < NFC_TEST_SCHEDULER_DICT_KEYS; i++) {
+        if(nfc_test_scheduler_dict_key(i) == key) return i + 1;
+    }
+    return NFC_TEST_SCHEDULER_DICT_KEYS;
+}
+
+static void nfc_test_scheduler_run(MfClassicDict* dict, const NfcTestCardModel* card) {
+    MfClassicKeyScheduler* scheduler = mf_classic_key_scheduler_alloc(dict);
+    uint32_t tries = 0;
+    uint32_t baseline = 0;
+
+    for(uint8_t i = 0; i < card->sectors; i++) {
+        bool found[2] = {false, false};
+        uint64_t key = 0;
+
+        // Try every key as A and B key, same as dictionary attack does
+        mf_classic_key_scheduler_start_sector(scheduler);
+        while(mf_classic_key_scheduler_get_next_key(scheduler, &key)) {
+            for(size_t j = 0; j < 2; j++) {
+                if(!found[j] && card->keys[i][j] == key) {
+                    found[j] = true;
+                    mf_classic_key_scheduler_add_found_key(scheduler, key);
+                }
+            }
+            if(found[0] && found[1]) break;
+        }
+        for(size_t j = 0; j < 2; j++) {
+            mu_assert(
+                found[j] == (card->keys[i][j] != NFC_TEST_SCHEDULER_KEY_ABSENT),
+                "key found mismatch\r\n");
+        }
+
+        uint32_t sector_tries = mf_classic_key_scheduler_get_sector_keys_tried(scheduler);
+        uint32_t sector_baseline = MAX(
+            nfc_test_scheduler_dict_tries(card->keys[i][0]),
+            nfc_test_scheduler_dict_tries(card->keys[i][1]));
+        mu_assert(sector_tries <= sector_baseline, "more keys tried than dictionary has\r\n");
+        tries += sector_tries;
+        baseline += sector_baseline;
+    }
+
+    MfClassicKeySchedulerStats stats;
+    mf_classic_key_scheduler_get_stats(scheduler, &stats);
+    mu_assert(stats.keys_tried == tries, "keys_tried mismatch\r\n");
+    mu_assert(stats.keys_saved == baseline - tries, "keys_saved mismatch\r\n");
+    mu_assert(tries < baseline, "found keys didn't save tries\r\n");
+    mf_classic_key_scheduler_free(scheduler);
+}
+
+MU_TEST(mf_classic_key_scheduler_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    mu_assert(storage != NULL, "storage != NULL assert failed\r\n");
+
+    mu_assert(
+        storage_simply_remove(storage, NFC_TEST_DICT_PATH), "remove == true assert failed\r\n");
+    mu_assert(
+        storage_simply_remove(storage, NFC_TEST_DICT_INDEX_PATH),
+        "remove == true assert failed\r\n");
+
+    Stream* file_stream = file_stream_alloc(storage);
+    mu_assert(
+        file_stream_open(file_stream, NFC_TEST_DICT_PATH, FSAM_WRITE, FSOM_OPEN_ALWAYS),
+        "file_stream_open == true assert failed\r\n");
+    for(uint32_t i = 0; i < NFC_TEST_SCHEDULER_DICT_KEYS; i++) {
+        stream_write_format(file_stream, "%012llX\n", nfc_test_scheduler_dict_key(i));
+    }
+    mu_assert(file_stream_close(file_stream), "file_stream_close == true assert failed\r\n");
     stream_free(file_stream);
+
+    MfClassicDict* dict = mf_classic_dict_alloc(MfClassicDictTypeUnitTest);
+    mu_assert(dict != NULL, "mf_classic_dict_alloc\r\n");
+    mu_assert(
+        mf_classic_dict_get_total_keys(dict) == NFC_TEST_SCHEDULER_DICT_KEYS,
+        "total_keys assert failed\r\n");
+
+    // Transport card: default keys in sector 0, the same keys in all others
+    NfcTestCardModel card = {.sectors = MF_CLASSIC_1K_TOTAL_SECTORS_NUM};
+    card.keys[0][0] = nfc_test_scheduler_dict_key(0);
+    card.keys[0][1] = nfc_test_scheduler_dict_key(0);
+    for(uint8_t i = 1; i < card.sectors; i++) {
+        card.keys[i][0] = nfc_test_scheduler_dict_key(30);
+        card.keys[i][1] = nfc_test_scheduler_dict_key(35);
+    }
+    nfc_test_scheduler_run(dict, &card);
+
+    // Hotel card: one key pair, B key of one sector is not in dictionary
+    for(uint8_t i = 0; i < card.sectors; i++) {
+        card.keys[i][0] = nfc_test_scheduler_dict_key(20);
+        card.keys[i][1] = nfc_test_scheduler_dict_key(39);
+    }
+    card.keys[5][1] = NFC_TEST_SCHEDULER_KEY_ABSENT;
+    nfc_test_scheduler_run(dict, &card);
+
+    // Mini card: A and B keys swapped between sectors
+    card.sectors = MF_MINI_TOTAL_SECTORS_NUM;
+    for(uint8_t i = 0; i < card.sectors; i++) {
+        card.keys[i][i % 2] = nfc_test_scheduler_dict_key(10);
+        card.keys[i][(i + 1) % 2] = nfc_test_scheduler_dict_key(12);
+    }
+    nfc_test_scheduler_run(dict, &card);
+
+    // Keys seeded before the first sector, as from key cache, are tried first
+    MfClassicKeyScheduler* scheduler = mf_classic_key_scheduler_alloc(dict);
+    mf_classic_key_scheduler_add_found_key(scheduler, NFC_TEST_SCHEDULER_KEY_ABSENT);
+    mf_classic_key_scheduler_add_found_key(scheduler, nfc_test_scheduler_dict_key(25));
+    mf_classic_key_scheduler_start_sector(scheduler);
+    uint64_t key = 0;
+    mu_assert(mf_classic_key_scheduler_get_next_key(scheduler, &key), "no key assert failed\r\n");
+    mu_assert(key == NFC_TEST_SCHEDULER_KEY_ABSENT, "seeded key not tried first\r\n");
+    mu_assert(mf_classic_key_scheduler_get_next_key(scheduler, &key), "no key assert failed\r\n");
+    mu_assert(key == nfc_test_scheduler_dict_key(25), "seeded key not tried second\r\n");
+    uint32_t dict_keys = 0;
+    while(mf_classic_key_scheduler_get_next_key(scheduler, &key)) {
+        mu_assert(key != nfc_test_scheduler_dict_key(25), "seeded key tried twice\r\n");
+        dict_keys++;
+    }
+    mu_assert(dict_keys == NFC_TEST_SCHEDULER_DICT_KEYS - 1, "dictionary keys mismatch\r\n");
+    mf_classic_key_scheduler_free(scheduler);
+
+    mf_classic_dict_free(dict);
+    mu_assert(
+        storage_simply_remove(storage, NFC_TEST_DICT_PATH), "remove == true assert failed\r\n");
+    mu_assert(
+        storage_simply_remove(storage, NFC_TEST_DICT_INDEX_PATH),
+        "remove == true assert failed\r\n");
     furi_record_close(RECORD_STORAGE);
 }
 
+MU_TEST(crypto1_test) {
+    // Reference values from bit by bit implementation
+    Crypto1 crypto;
+    crypto1_init(&crypto, 0xA0A1A2A3A4A5);
+    mu_assert(
+        crypto1_word(&crypto, 0x01020304 ^ 0xCAFEBABE, 0) == 0x1A4502D3,
+        "crypto1_word nonce assert failed\r\n");
+    mu_assert(crypto1_word(&crypto, 0, 0) == 0x3D68547A, "crypto1_word assert failed\r\n");
+    mu_assert(crypto1_byte(&crypto, 0x5A, 1) == 0x49, "crypto1_byte assert failed\r\n");
+    mu_assert(crypto1_bit(&crypto, 1, 0) == 0, "crypto1_bit assert failed\r\n");
+    mu_assert(
+        crypto.odd == 0xBED68111 && crypto.even == 0x8DE6EB8B,
+        "crypto1 state assert failed\r\n");
+
+    // Byte and word stepping must match single bits
+    Crypto1 crypto_bits = crypto;
+    uint8_t byte = crypto1_byte(&crypto, 0xC3, 1);
+    uint8_t byte_bits = 0;
+    for(uint8_t i = 0; i < 8; i++) {
+        byte_bits |= crypto1_bit(&crypto_bits, FURI_BIT(0xC3, i), 1) << i;
+    }
+    mu_assert(byte == byte_bits, "crypto1_byte != crypto1_bit assert failed\r\n");
+    mu_assert(
+        crypto.odd == crypto_bits.odd && crypto.even == crypto_bits.even,
+        "crypto1 state after byte assert failed\r\n");
+}
+
 MU_TEST(nfca_file_test) {
     NfcDevice* nfc = nfc_device_alloc();
     mu_assert(nfc != NULL, "nfc_device_data != NULL assert failed\r\n");
@@ -565,6 +844,9 @@ MU_TEST_SUITE(nfc) {
     MU_RUN_TEST(nfc_digital_signal_test);
     MU_RUN_TEST(mf_classic_dict_test);
     MU_RUN_TEST(mf_classic_dict_load_test);
+    MU_RUN_TEST(mf_classic_dict_index_test);
+    MU_RUN_TEST(mf_classic_key_scheduler_test);
+    MU_RUN_TEST(crypto1_test);
 
     nfc_test_free();
 }
@@ -9,6 +9,14 @@ typedef enum {
     TestDictProtocolMax,
 } TestDictProtocols;
 
+typedef enum {
+    TestDemodulatedDictProtocol0,
+    TestDemodulatedDictProtocol2,
+    TestDemodulatedDictProtocol3,
+
+    TestDemodulatedDictProtocolMax,
+} TestDemodulatedDictProtocols;
+
 /*********************** PROTOCOL 0 START ***********************/
 
 typedef struct {
@@ -99,6 +107,101 @@ static LevelDuration protocol_1_encoder_yield(Protocol1Data* data) {
     return level_duration_make(!(data->encoder_counter % 2), 100);
 }
 
+/*********************** DEMODULATOR START ***********************/
+
+typedef struct {
+    uint32_t pulses;
+} TestDemodulatorSymbols;
+
+typedef struct {
+    TestDemodulatorSymbols symbols;
+} TestDemodulatorData;
+
+static void* test_demodulator_alloc() {
+    void* data = malloc(sizeof(TestDemodulatorData));
+    return data;
+}
+
+static void test_demodulator_free(TestDemodulatorData* data) {
+    free(data);
+}
+
+static void test_demodulator_start(TestDemodulatorData* data) {
+    data->symbols.pulses = 0;
+}
+
+static const TestDemodulatorSymbols*
+    test_demodulator_feed(TestDemodulatorData* data, bool level, uint32_t duration) {
+    UNUSED(duration);
+    if(!level) return NULL;
+
+    data->symbols.pulses++;
+    return &data->symbols;
+}
+
+static const ProtocolDemodulator test_demodulator = {
+    .alloc = (ProtocolAlloc)test_demodulator_alloc,
+    .free = (ProtocolFree)test_demodulator_free,
+    .start = (ProtocolDemodulatorStart)test_demodulator_start,
+    .feed = (ProtocolDemodulatorFeed)test_demodulator_feed,
+};
+
+/*********************** PROTOCOL 2 START ***********************/
+
+typedef struct {
+    uint32_t data;
+} Protocol2Data;
+
+static void* protocol_2_alloc() {
+    void* data = malloc(sizeof(Protocol2Data));
+    return data;
+}
+
+static void protocol_2_free(Protocol2Data* data) {
+    free(data);
+}
+
+static uint8_t* protocol_2_get_data(Protocol2Data* data) {
+    return (uint8_t*)&data->data;
+}
+
+static void protocol_2_decoder_start(Protocol2Data* data) {
+    data->data = 0;
+}
+
+static bool protocol_2_decoder_feed(Protocol2Data* data, const TestDemodulatorSymbols* symbols) {
+    data->data = symbols->pulses;
+    return symbols->pulses == 3;
+}
+
+/*********************** PROTOCOL 3 START ***********************/
+
+typedef struct {
+    uint32_t data;
+} Protocol3Data;
+
+static void* protocol_3_alloc() {
+    void* data = malloc(sizeof(Protocol3Data));
+    return data;
+}
+
+static void protocol_3_free(Protocol3Data* data) {
+    free(data);
+}
+
+static uint8_t* protocol_3_get_data(Protocol3Data* data) {
+    return (uint8_t*)&data->data;
+}
+
+static void protocol_3_decoder_start(Protocol3Data* data) {
+    data->data = 0;
+}
+
+static bool protocol_3_decoder_feed(Protocol3Data* data, const TestDemodulatorSymbols* symbols) {
+    data->data = symbols->pulses;
+    return symbols->pulses == 5;
+}
+
 /*********************** PROTOCOLS DESCRIPTION ***********************/
 static const ProtocolBase protocol_0 = {
     .name = "Protocol 0",
@@ -143,6 +246,42 @@ static const ProtocolBase* test_protocols_base[] = {
     [TestDictProtocol1] = &protocol_1,
 };
 
+static const ProtocolBase protocol_2 = {
+    .name = "Protocol 2",
+    .manufacturer = "Manufacturer 2",
+    .data_size = 4,
+    .alloc = (ProtocolAlloc)protocol_2_alloc,
+    .free = (ProtocolFree)protocol_2_free,
+    .get_data = (ProtocolGetData)protocol_2_get_data,
+    .decoder =
+        {
+            .start = (ProtocolDecoderStart)protocol_2_decoder_start,
+            .demodulator = &test_demodulator,
+            .feed_demodulated = (ProtocolDecoderFeedDemodulated)protocol_2_decoder_feed,
+        },
+};
+
+static const ProtocolBase protocol_3 = {
+    .name = "Protocol 3",
+    .manufacturer = "Manufacturer 3",
+    .data_size = 4,
+    .alloc = (ProtocolAlloc)protocol_3_alloc,
+    .free = (ProtocolFree)protocol_3_free,
+    .get_data = (ProtocolGetData)protocol_3_get_data,
+    .decoder =
+        {
+            .start = (ProtocolDecoderStart)protocol_3_decoder_start,
+            .demodulator = &test_demodulator,
+            .feed_demodulated = (ProtocolDecoderFeedDemodulated)protocol_3_decoder_feed,
+        },
+};
+
+static const ProtocolBase* test_demodulated_protocols_base[] = {
+    [TestDemodulatedDictProtocol0] = &protocol_0,
+    [TestDemodulatedDictProtocol2] = &protocol_2,
+    [TestDemodulatedDictProtocol3] = &protocol_3,
+};
+
 MU_TEST(test_protocol_dict) {
     ProtocolDict* dict = protocol_dict_alloc(test_protocols_base, TestDictProtocolMax);
     size_t max_data_size = protocol_dict_get_max_data_size(dict);
@@ -212,8 +351,51 @@ MU_TEST(test_protocol_dict) {
     free(data);
 }
 
+MU_TEST(test_protocol_dict_demodulator) {
+    ProtocolDict* dict =
+        protocol_dict_alloc(test_demodulated_protocols_base, TestDemodulatedDictProtocolMax);
+    uint32_t data = 0;
+
+    protocol_dict_decoders_start(dict);
+    ProtocolId protocol_id = PROTOCOL_NO;
+
+    // demodulator yields nothing, so demodulated decoders are not called
+    protocol_id = protocol_dict_decoders_feed(dict, false, 100);
+    mu_assert_int_eq(PROTOCOL_NO, protocol_id);
+    protocol_dict_get_data(dict, TestDemodulatedDictProtocol2, (uint8_t*)&data, sizeof(data));
+    mu_assert_int_eq(0, data);
+
+    // shared demodulator is fed once per edge
+    for(size_t i = 0; i < 2; i++) {
+        protocol_id = protocol_dict_decoders_feed(dict, true, 100);
+        mu_assert_int_eq(PROTOCOL_NO, protocol_id);
+    }
+
+    protocol_id = protocol_dict_decoders_feed(dict, true, 100);
+    mu_assert_int_eq(TestDemodulatedDictProtocol2, protocol_id);
+    protocol_dict_get_data(dict, TestDemodulatedDictProtocol3, (uint8_t*)&data, sizeof(data));
+    mu_assert_int_eq(3, data);
+
+    // protocols without demodulator are still fed with raw edges
+    protocol_id = protocol_dict_decoders_feed(dict, true, 666);
+    mu_assert_int_eq(TestDemodulatedDictProtocol0, protocol_id);
+
+    protocol_id = protocol_dict_decoders_feed_by_id(dict, TestDemodulatedDictProtocol3, true, 100);
+    mu_assert_int_eq(TestDemodulatedDictProtocol3, protocol_id);
+
+    // demodulator is restarted with decoders
+    protocol_dict_decoders_start(dict);
+    protocol_id = protocol_dict_decoders_feed(dict, true, 100);
+    mu_assert_int_eq(PROTOCOL_NO, protocol_id);
+    protocol_dict_get_data(dict, TestDemodulatedDictProtocol2, (uint8_t*)&data, sizeof(data));
+    mu_assert_int_eq(1, data);
+
+    protocol_dict_free(dict);
+}
+
 MU_TEST_SUITE(test_protocol_dict_suite) {
     MU_RUN_TEST(test_protocol_dict);
+    MU_RUN_TEST(test_protocol_dict_demodulator);
 }
 
 int run_minunit_test_protocol_dict() {
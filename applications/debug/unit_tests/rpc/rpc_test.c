@@ -4,10 +4,12 @@
 #include "pb_decode.h"
 #include <rpc/rpc.h>
 #include "rpc/rpc_i.h"
+#include "rpc/rpc_gui_delta.h"
 #include "storage.pb.h"
 #include "storage/filesystem_api_defines.h"
 #include "storage/storage.h"
 #include <furi.h>
+#include <furi_hal.h>
 #include "../minunit.h"
 #include <stdint.h>
 #include <pb.h>
@@ -15,6 +17,7 @@
 #include <m-list.h>
 #include <lib/toolbox/md5_calc.h>
 #include <lib/toolbox/path.h>
+#include <lib/toolbox/compress.h>
 #include <cli/cli.h>
 #include <loader/loader.h>
 #include <protobuf_version.h>
@@ -25,6 +28,9 @@ LIST_DEF(MsgList, PB_Main, M_POD_OPLIST)
 
 #define TEST_RPC_SESSIONS 2
 
+#define TEST_RPC_GUI_FRAME_SIZE (1024)
+#define TEST_RPC_GUI_FRAMES (160)
+
 /* MinUnit test framework doesn't allow passing context into tests,
  * so we have to use global variables
  */
@@ -45,6 +51,7 @@ static RpcSessionContext rpc_session[TEST_RPC_SESSIONS];
 #define MAX_RECEIVE_OUTPUT_TIMEOUT 3000
 #define MAX_NAME_LENGTH 254
 #define MAX_DATA_SIZE 512u // have to be exact as in rpc_storage.c
+#define MAX_CHUNK_SIZE 4096u // have to be exact as RPC_STORAGE_CHUNK_SIZE_MAX
 #define TEST_DIR TEST_DIR_NAME "/"
 #define TEST_DIR_NAME EXT_PATH("unit_tests_tmp")
 #define MD5SUM_SIZE 16
@@ -267,10 +274,14 @@ static PB_CommandStatus test_rpc_storage_get_file_error(File* file) {
 static void output_bytes_callback(void* ctx, uint8_t* got_bytes, size_t got_size) {
     RpcSessionContext* callbacks_context = ctx;
 
-    size_t bytes_sent = furi_stream_buffer_send(
-        callbacks_context->output_stream, got_bytes, got_size, FuriWaitForever);
-    (void)bytes_sent;
-    furi_check(bytes_sent == got_size);
+    // Read responses can be bigger than the stream buffer, send them in parts
+    while(got_size) {
+        size_t bytes_sent = furi_stream_buffer_send(
+            callbacks_context->output_stream, got_bytes, got_size, FuriWaitForever);
+        furi_check(bytes_sent);
+        got_bytes += bytes_sent;
+        got_size -= bytes_sent;
+    }
 }
 
 static void test_rpc_add_ping_to_list(MsgList_t msg_list, bool request, uint32_t command_id) {
@@ -752,8 +763,11 @@ static void
 static void test_rpc_add_read_to_list_by_reading_real_file(
     MsgList_t msg_list,
     const char* path,
+    uint32_t chunk_size,
     uint32_t command_id) {
     furi_check(MsgList_empty_p(msg_list));
+    // Same as rpc_storage.c: zero is default, anything else is clamped
+    chunk_size = chunk_size ? CLAMP(chunk_size, MAX_CHUNK_SIZE, MAX_DATA_SIZE) : MAX_DATA_SIZE;
     Storage* fs_api = furi_record_open(RECORD_STORAGE);
     File* file = storage_file_alloc(fs_api);
 
@@ -771,10 +785,10 @@ static void test_rpc_add_read_to_list_by_reading_real_file(
             response->content.storage_read_response.has_file = true;
 
             response->content.storage_read_response.file.data =
-                malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(MIN(size_left, MAX_DATA_SIZE)));
+                malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(MIN(size_left, chunk_size)));
             uint8_t* buffer = response->content.storage_read_response.file.data->bytes;
             uint16_t* read_size_msg = &response->content.storage_read_response.file.data->size;
-            size_t read_size = MIN(size_left, MAX_DATA_SIZE);
+            size_t read_size = MIN(size_left, chunk_size);
             *read_size_msg = storage_file_read(file, buffer, read_size);
             size_left -= read_size;
             result = (*read_size_msg == read_size);
@@ -798,14 +812,16 @@ static void test_rpc_add_read_to_list_by_reading_real_file(
     furi_record_close(RECORD_STORAGE);
 }
 
-static void test_storage_read_run(const char* path, uint32_t command_id) {
+static void test_storage_read_run(const char* path, uint32_t chunk_size, uint32_t command_id) {
     PB_Main request;
     MsgList_t expected_msg_list;
     MsgList_init(expected_msg_list);
 
-    test_rpc_add_read_to_list_by_reading_real_file(expected_msg_list, path, command_id);
+    test_rpc_add_read_to_list_by_reading_real_file(
+        expected_msg_list, path, chunk_size, command_id);
     test_rpc_create_simple_message(
         &request, PB_Main_storage_read_request_tag, path, command_id, false);
+    request.content.storage_read_request.chunk_size = chunk_size;
     test_rpc_encode_and_feed_one(&request, 0);
     test_rpc_decode_and_compare(expected_msg_list, 0);
 
@@ -953,12 +969,80 @@ MU_TEST(test_storage_read) {
     test_create_file(TEST_DIR "file2.txt", MAX_DATA_SIZE);
     test_create_file(TEST_DIR "file3.txt", MAX_DATA_SIZE + 1);
     test_create_file(TEST_DIR "file4.txt", (MAX_DATA_SIZE * 2) + 1);
+    test_create_file(TEST_DIR "file5.txt", (MAX_DATA_SIZE * 7) + 3);
+
+    test_storage_read_run(TEST_DIR "empty.txt", 0, ++command_id);
+    test_storage_read_run(TEST_DIR "file1.txt", 0, ++command_id);
+    test_storage_read_run(TEST_DIR "file2.txt", 0, ++command_id);
+    test_storage_read_run(TEST_DIR "file3.txt", 0, ++command_id);
+    test_storage_read_run(TEST_DIR "file4.txt", 0, ++command_id);
+    test_storage_read_run(TEST_DIR "file5.txt", 0, ++command_id);
 
-    test_storage_read_run(TEST_DIR "empty.txt", ++command_id);
-    test_storage_read_run(TEST_DIR "file1.txt", ++command_id);
-    test_storage_read_run(TEST_DIR "file2.txt", ++command_id);
-    test_storage_read_run(TEST_DIR "file3.txt", ++command_id);
-    test_storage_read_run(TEST_DIR "file4.txt", ++command_id);
+    // Negotiated chunk size, clamped to the supported range
+    test_create_file(TEST_DIR "file6.txt", (MAX_CHUNK_SIZE * 2) + 5);
+    test_storage_read_run(TEST_DIR "file6.txt", MAX_CHUNK_SIZE, ++command_id);
+    test_storage_read_run(TEST_DIR "file6.txt", 1000, ++command_id);
+    test_storage_read_run(TEST_DIR "file6.txt", MAX_CHUNK_SIZE * 4, ++command_id);
+    test_storage_read_run(TEST_DIR "file6.txt", 16, ++command_id);
+}
+
+#define TEST_STORAGE_READ_BENCHMARK_SIZE (64 * 1024)
+
+static void test_storage_read_benchmark_run(uint32_t chunk_size) {
+    PB_Main request;
+    test_rpc_create_simple_message(
+        &request, PB_Main_storage_read_request_tag, TEST_DIR "benchmark.bin", ++command_id, false);
+    request.content.storage_read_request.chunk_size = chunk_size;
+
+    rpc_session[0].timeout = xTaskGetTickCount() + MAX_RECEIVE_OUTPUT_TIMEOUT;
+    pb_istream_t istream = {
+        .callback = test_rpc_pb_stream_read,
+        .state = &rpc_session[0],
+        .errmsg = NULL,
+        .bytes_left = 0x7FFFFFFF,
+    };
+    PB_Main result = {.cb_content.funcs.decode = NULL};
+
+    uint32_t start = furi_get_tick();
+    test_rpc_encode_and_feed_one(&request, 0);
+
+    size_t received = 0;
+    bool has_next = true;
+    while(has_next) {
+        if(!pb_decode_ex(&istream, &PB_Main_msg, &result, PB_DECODE_DELIMITED)) {
+            mu_fail("failed to decode read response");
+            break;
+        }
+        mu_assert(result.command_id == command_id, "wrong command_id");
+        mu_assert(result.command_status == PB_CommandStatus_OK, "wrong command_status");
+        mu_assert(result.which_content == PB_Main_storage_read_response_tag, "wrong content");
+        if(result.content.storage_read_response.file.data) {
+            received += result.content.storage_read_response.file.data->size;
+        }
+        has_next = result.has_next;
+        pb_release(&PB_Main_msg, &result);
+        rpc_session[0].timeout = xTaskGetTickCount() + MAX_RECEIVE_OUTPUT_TIMEOUT;
+    }
+    uint32_t elapsed = MAX(furi_get_tick() - start, 1UL);
+
+    mu_assert(received == TEST_STORAGE_READ_BENCHMARK_SIZE, "wrong size received");
+    FURI_LOG_I(
+        TAG,
+        "Storage read: %u bytes in %lums, %luKB/s, chunk size %lu",
+        TEST_STORAGE_READ_BENCHMARK_SIZE,
+        elapsed,
+        (uint32_t)TEST_STORAGE_READ_BENCHMARK_SIZE * furi_kernel_get_tick_frequency() /
+            elapsed / 1024,
+        chunk_size ? chunk_size : MAX_DATA_SIZE);
+
+    pb_release(&PB_Main_msg, &request);
+}
+
+MU_TEST(test_storage_read_benchmark) {
+    test_create_file(TEST_DIR "benchmark.bin", TEST_STORAGE_READ_BENCHMARK_SIZE);
+
+    test_storage_read_benchmark_run(0);
+    test_storage_read_benchmark_run(MAX_CHUNK_SIZE);
 }
 
 static void test_storage_write_run(
@@ -1447,6 +1531,84 @@ MU_TEST(test_system_protobuf_version) {
     test_rpc_free_msg_list(expected_msg_list);
 }
 
+static void test_rpc_gui_draw_frame(uint8_t* frame, uint32_t index) {
+    // Static text-like background, menu cursor and animated 32x32 area
+    for(size_t i = 0; i < TEST_RPC_GUI_FRAME_SIZE; i++) {
+        frame[i] = (i * 37 % 11) ? 0 : i * 13;
+    }
+    size_t cursor_page = 2 + (index / 16) % 5;
+    memset(&frame[cursor_page * 128], 0xFF, 90);
+    for(size_t page = 3; page < 7; page++) {
+        for(size_t x = 94; x < 126; x++) {
+            frame[page * 128 + x] = (((x + index) / 4) % 2) ? 0xF0 : 0x0F;
+        }
+    }
+}
+
+MU_TEST(test_gui_screen_delta) {
+    uint8_t* frame = malloc(TEST_RPC_GUI_FRAME_SIZE);
+    uint8_t* decoded = malloc(TEST_RPC_GUI_FRAME_SIZE);
+    uint8_t* reconstructed = malloc(TEST_RPC_GUI_FRAME_SIZE);
+    uint8_t* encoded = malloc(RPC_GUI_DELTA_ENCODED_SIZE_MAX(TEST_RPC_GUI_FRAME_SIZE));
+    RpcGuiDelta* delta = rpc_gui_delta_alloc(TEST_RPC_GUI_FRAME_SIZE);
+    Compress* compress = compress_alloc(TEST_RPC_GUI_FRAME_SIZE);
+
+    size_t encoded_total = 0;
+    uint32_t encode_time = 0;
+    uint32_t keyframes = 0;
+    for(uint32_t i = 0; i < TEST_RPC_GUI_FRAMES; i++) {
+        test_rpc_gui_draw_frame(frame, i);
+
+        size_t encoded_size = 0;
+        uint32_t time_start = DWT->CYCCNT;
+        RpcGuiDeltaFrame type = rpc_gui_delta_encode(delta, frame, encoded, &encoded_size);
+        encode_time += DWT->CYCCNT - time_start;
+        encoded_total += encoded_size;
+
+        size_t decoded_size = 0;
+        mu_assert(
+            compress_decode(
+                compress, encoded, encoded_size, decoded, TEST_RPC_GUI_FRAME_SIZE, &decoded_size),
+            "compress_decode failed");
+        mu_assert(decoded_size == TEST_RPC_GUI_FRAME_SIZE, "decoded size mismatch");
+        if(type == RpcGuiDeltaFrameKey) {
+            keyframes++;
+            memcpy(reconstructed, decoded, TEST_RPC_GUI_FRAME_SIZE);
+        } else {
+            for(size_t j = 0; j < TEST_RPC_GUI_FRAME_SIZE; j++) {
+                reconstructed[j] ^= decoded[j];
+            }
+        }
+        mu_assert(
+            memcmp(reconstructed, frame, TEST_RPC_GUI_FRAME_SIZE) == 0,
+            "reconstructed frame mismatch");
+    }
+
+    mu_assert(keyframes > 1, "no periodic keyframes");
+    mu_assert(
+        encoded_total < TEST_RPC_GUI_FRAMES * TEST_RPC_GUI_FRAME_SIZE / 4,
+        "delta frames are too large");
+    uint32_t encode_us = encode_time / furi_hal_cortex_instructions_per_microsecond() /
+                         TEST_RPC_GUI_FRAMES;
+    FURI_LOG_I(
+        TAG,
+        "Screen delta: %zu bytes per frame of %u, encode %luus per frame",
+        encoded_total / TEST_RPC_GUI_FRAMES,
+        TEST_RPC_GUI_FRAME_SIZE,
+        encode_us);
+
+    compress_free(compress);
+    rpc_gui_delta_free(delta);
+    free(encoded);
+    free(reconstructed);
+    free(decoded);
+    free(frame);
+}
+
+MU_TEST_SUITE(test_rpc_gui) {
+    MU_RUN_TEST(test_gui_screen_delta);
+}
+
 MU_TEST_SUITE(test_rpc_system) {
     MU_SUITE_CONFIGURE(&test_rpc_setup, &test_rpc_teardown);
 
@@ -1462,6 +1624,7 @@ MU_TEST_SUITE(test_rpc_storage) {
     MU_RUN_TEST(test_storage_list);
     MU_RUN_TEST(test_storage_list_md5);
     MU_RUN_TEST(test_storage_read);
+    MU_RUN_TEST(test_storage_read_benchmark);
     MU_RUN_TEST(test_storage_write_read);
     MU_RUN_TEST(test_storage_write);
     MU_RUN_TEST(test_storage_delete);
@@ -1817,6 +1980,7 @@ int run_minunit_test_rpc() {
     MU_RUN_SUITE(test_rpc_system);
     MU_RUN_SUITE(test_rpc_app);
     MU_RUN_SUITE(test_rpc_session);
+    MU_RUN_SUITE(test_rpc_gui);
 
     return MU_EXIT_CODE;
 }
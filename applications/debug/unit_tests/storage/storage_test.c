@@ -115,10 +115,156 @@ MU_TEST(storage_file_open_close) {
     furi_record_close(RECORD_STORAGE);
 }
 
+#define STORAGE_CACHE_FILE UNIT_TESTS_PATH("cache_file.test")
+#define STORAGE_CACHE_LINES 100
+
+MU_TEST(storage_file_cache_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    StorageFileCacheStats stats;
+    char line[32];
+    size_t file_size = 0;
+
+    storage_simply_remove(storage, STORAGE_CACHE_FILE);
+    storage_file_set_cache_size(file, 256);
+
+    // small writes are collected
+    mu_check(storage_file_open(file, STORAGE_CACHE_FILE, FSAM_READ_WRITE, FSOM_CREATE_NEW));
+    for(size_t i = 0; i < STORAGE_CACHE_LINES; i++) {
+        size_t length = snprintf(line, sizeof(line), "Line %u\n", i);
+        mu_assert_int_eq(length, storage_file_write(file, line, length));
+        file_size += length;
+    }
+    mu_assert_int_eq(file_size, storage_file_tell(file));
+    storage_file_get_cache_stats(file, &stats);
+    mu_assert_int_eq(STORAGE_CACHE_LINES, stats.write_calls);
+    mu_check(stats.requests < stats.write_calls / 10);
+
+    // pending data is written before size and seek
+    mu_assert_int_eq(file_size, storage_file_size(file));
+    mu_check(storage_file_seek(file, 0, true));
+
+    // small reads and seeks inside of the cached data
+    for(size_t i = 0; i < STORAGE_CACHE_LINES; i++) {
+        size_t length = snprintf(line, sizeof(line), "Line %u\n", i);
+        char read_line[32] = {0};
+        uint64_t position = storage_file_tell(file);
+        mu_assert_int_eq(5, storage_file_read(file, read_line, 5));
+        mu_check(storage_file_seek(file, position, true));
+        mu_assert_int_eq(length, storage_file_read(file, read_line, length));
+        mu_assert_string_eq(line, read_line);
+    }
+    mu_check(storage_file_eof(file));
+
+    // write after read goes to the read position
+    mu_check(storage_file_seek(file, 0, true));
+    mu_assert_int_eq(4, storage_file_read(file, line, 4));
+    mu_assert_int_eq(1, storage_file_write(file, "_", 1));
+    mu_check(storage_file_seek(file, 0, true));
+    mu_assert_int_eq(7, storage_file_read(file, line, 7));
+    mu_check(memcmp(line, "Line_0\n", 7) == 0);
+
+    storage_file_get_cache_stats(file, &stats);
+    mu_check(stats.requests < (stats.read_calls + stats.write_calls) / 4);
+    mu_check(storage_file_close(file));
+
+    // read-ahead only cache sends writes at once
+    storage_file_set_read_cache_size(file, 256);
+    mu_check(storage_file_open(file, STORAGE_CACHE_FILE, FSAM_READ_WRITE, FSOM_OPEN_EXISTING));
+    mu_assert_int_eq(4, storage_file_read(file, line, 4));
+    mu_assert_int_eq(1, storage_file_write(file, "-", 1));
+    storage_file_get_cache_stats(file, &stats);
+    mu_assert_int_eq(1, stats.write_calls);
+    mu_assert_int_eq(0, stats.write_hits);
+    mu_check(storage_file_seek(file, 0, true));
+    mu_assert_int_eq(7, storage_file_read(file, line, 7));
+    mu_check(memcmp(line, "Line-0\n", 7) == 0);
+    mu_check(storage_file_close(file));
+
+    // cache is not required to read the file back
+    storage_file_set_cache_size(file, 0);
+    mu_check(storage_file_open(file, STORAGE_CACHE_FILE, FSAM_READ, FSOM_OPEN_EXISTING));
+    mu_assert_int_eq(7, storage_file_read(file, line, 7));
+    mu_check(memcmp(line, "Line-0\n", 7) == 0);
+    storage_file_get_cache_stats(file, &stats);
+    mu_assert_int_eq(0, stats.requests);
+    mu_check(storage_file_close(file));
+
+    storage_file_free(file);
+    mu_check(storage_simply_remove(storage, STORAGE_CACHE_FILE));
+    furi_record_close(RECORD_STORAGE);
+}
+
+#define STORAGE_LARGE_FILE UNIT_TESTS_PATH("large_file.test")
+#define STORAGE_LARGE_FILE_COPY UNIT_TESTS_PATH("large_file_copy.test")
+#define STORAGE_LARGE_CHUNK_SIZE (3 * 1024 + 17)
+
+MU_TEST(storage_file_vector_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    const size_t total_size = STORAGE_LARGE_CHUNK_SIZE * 3;
+    uint8_t* data = malloc(total_size);
+    uint8_t* read_data = malloc(total_size);
+
+    for(size_t i = 0; i < total_size; i++) {
+        data[i] = i * 7 + i / 256;
+    }
+
+    storage_simply_remove(storage, STORAGE_LARGE_FILE);
+    storage_simply_remove(storage, STORAGE_LARGE_FILE_COPY);
+
+    // vectored write, chunks are not sector aligned
+    StorageIoVec iov[] = {
+        {.buff = data, .size = STORAGE_LARGE_CHUNK_SIZE},
+        {.buff = data + STORAGE_LARGE_CHUNK_SIZE, .size = STORAGE_LARGE_CHUNK_SIZE},
+        {.buff = data + STORAGE_LARGE_CHUNK_SIZE * 2, .size = STORAGE_LARGE_CHUNK_SIZE},
+    };
+    mu_check(storage_file_open(file, STORAGE_LARGE_FILE, FSAM_WRITE, FSOM_CREATE_NEW));
+    mu_assert_int_eq(total_size, storage_file_writev(file, iov, COUNT_OF(iov)));
+    mu_check(storage_file_close(file));
+
+    // read back in one request
+    mu_check(storage_file_open(file, STORAGE_LARGE_FILE, FSAM_READ, FSOM_OPEN_EXISTING));
+    mu_assert_int_eq(total_size, storage_file_read_large(file, read_data, total_size + 100));
+    mu_check(memcmp(data, read_data, total_size) == 0);
+
+    // vectored read of a part after a cached read
+    memset(read_data, 0, total_size);
+    storage_file_set_cache_size(file, 128);
+    mu_check(storage_file_seek(file, 0, true));
+    mu_assert_int_eq(10, storage_file_read(file, read_data, 10));
+    StorageIoVec read_iov[] = {
+        {.buff = read_data + 10, .size = 1000},
+        {.buff = read_data + 1010, .size = 5000},
+    };
+    mu_assert_int_eq(6000, storage_file_readv(file, read_iov, COUNT_OF(read_iov)));
+    mu_check(memcmp(data, read_data, 6010) == 0);
+    mu_check(storage_file_close(file));
+
+    // copy uses large transfers
+    mu_assert_int_eq(
+        FSE_OK, storage_common_copy(storage, STORAGE_LARGE_FILE, STORAGE_LARGE_FILE_COPY));
+    memset(read_data, 0, total_size);
+    mu_check(storage_file_open(file, STORAGE_LARGE_FILE_COPY, FSAM_READ, FSOM_OPEN_EXISTING));
+    mu_assert_int_eq(total_size, storage_file_size(file));
+    mu_assert_int_eq(total_size, storage_file_read_large(file, read_data, total_size));
+    mu_check(memcmp(data, read_data, total_size) == 0);
+    mu_check(storage_file_close(file));
+
+    free(data);
+    free(read_data);
+    storage_file_free(file);
+    mu_check(storage_simply_remove(storage, STORAGE_LARGE_FILE));
+    mu_check(storage_simply_remove(storage, STORAGE_LARGE_FILE_COPY));
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(storage_file) {
     storage_file_open_lock_setup();
     MU_RUN_TEST(storage_file_open_close);
     MU_RUN_TEST(storage_file_open_lock);
+    MU_RUN_TEST(storage_file_cache_test);
+    MU_RUN_TEST(storage_file_vector_test);
     storage_file_open_lock_teardown();
 }
 
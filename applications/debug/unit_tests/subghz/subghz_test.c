@@ -5,7 +5,9 @@
 #include <lib/subghz/transmitter.h>
 #include <lib/subghz/subghz_keystore.h>
 #include <lib/subghz/subghz_file_encoder_worker.h>
+#include <lib/subghz/subghz_worker.h>
 #include <lib/subghz/protocols/protocol_items.h>
+#include <lib/subghz/protocols/keeloq_common.h>
 #include <flipper_format/flipper_format_i.h>
 #include <lib/subghz/devices/devices.h>
 #include <lib/subghz/devices/cc1101_configs.h>
@@ -18,6 +20,11 @@
 #define TEST_RANDOM_DIR_NAME EXT_PATH("unit_tests/subghz/test_random_raw.sub")
 #define TEST_RANDOM_COUNT_PARSE 329
 #define TEST_TIMEOUT 10000
+#define TEST_KEELOQ_BATCH_KEY_COUNT (KEELOQ_BATCH_SIZE * 32)
+#define TEST_WORKER_EDGE_COUNT 1000
+#define TEST_WORKER_STREAM_SIZE 4096
+#define TEST_PREAMBLE_UPLOAD_SIZE 1024
+#define TEST_PREAMBLE_NOISE_COUNT 2000
 
 static SubGhzEnvironment* environment_handler;
 static SubGhzReceiver* receiver_handler;
@@ -217,6 +224,165 @@ MU_TEST(subghz_keystore_test) {
         "Test keystore error");
 }
 
+MU_TEST(subghz_keystore_learning_cache_test) {
+    SubGhzKeystore* keystore = subghz_keystore_alloc();
+    mu_assert(subghz_keystore_load(keystore, KEYSTORE_DIR_NAME), "Test keystore error");
+    SubGhzKeyArray_t* keys = subghz_keystore_get_data(keystore);
+    mu_assert(SubGhzKeyArray_size(*keys) > 1, "Keystore is too small");
+    const SubGhzKey* manufacture_code = SubGhzKeyArray_cget(*keys, 1);
+
+    uint64_t man = 0;
+    uint8_t learning_type = 0;
+    mu_check(!subghz_keystore_learning_cache_get(keystore, 0x1234567, 0, &man, &learning_type));
+    subghz_keystore_learning_cache_put(
+        keystore, 0x1234567, 0, manufacture_code, 0xDEADBEEFCAFEBABE, KEELOQ_LEARNING_NORMAL);
+    mu_check(
+        subghz_keystore_learning_cache_get(keystore, 0x1234567, 0, &man, &learning_type) ==
+        manufacture_code);
+    mu_assert_int_eq(KEELOQ_LEARNING_NORMAL, learning_type);
+    mu_check(man == 0xDEADBEEFCAFEBABE);
+
+    // Fill the cache, the entry used last must survive
+    for(uint32_t serial = 0; serial < 64; serial++) {
+        subghz_keystore_learning_cache_put(
+            keystore, serial, 1, manufacture_code, serial, KEELOQ_LEARNING_SIMPLE);
+        subghz_keystore_learning_cache_get(keystore, 0x1234567, 0, &man, &learning_type);
+    }
+    mu_check(subghz_keystore_learning_cache_get(keystore, 0x1234567, 0, &man, &learning_type));
+    mu_check(!subghz_keystore_learning_cache_get(keystore, 0, 1, &man, &learning_type));
+
+    subghz_keystore_learning_cache_drop(keystore, 0x1234567, 0);
+    mu_check(!subghz_keystore_learning_cache_get(keystore, 0x1234567, 0, &man, &learning_type));
+
+    SubGhzKeystoreLearningCacheStats stats = subghz_keystore_learning_cache_get_stats(keystore);
+    mu_assert_int_eq(65, stats.hits);
+    mu_assert_int_eq(4, stats.misses);
+
+    subghz_keystore_free(keystore);
+}
+
+MU_TEST(subghz_keeloq_batch_test) {
+    const uint32_t fix = 0x1A2B3C4D;
+    const uint32_t hop = 0xC0FFEE11;
+    const uint32_t seed = 0x5EED5EED;
+    uint64_t* keys = malloc(sizeof(uint64_t) * TEST_KEELOQ_BATCH_KEY_COUNT);
+    uint64_t* man = malloc(sizeof(uint64_t) * TEST_KEELOQ_BATCH_KEY_COUNT);
+    uint32_t* decrypt = malloc(sizeof(uint32_t) * TEST_KEELOQ_BATCH_KEY_COUNT);
+    uint32_t* decrypt_batch = malloc(sizeof(uint32_t) * TEST_KEELOQ_BATCH_KEY_COUNT);
+
+    // Deterministic pseudo random manufacture keys
+    uint64_t key = 0x0123456789ABCDEF;
+    for(size_t i = 0; i < TEST_KEELOQ_BATCH_KEY_COUNT; i++) {
+        key = key * 6364136223846793005ULL + 1442695040888963407ULL;
+        keys[i] = key;
+    }
+
+    uint32_t scalar_start = furi_get_tick();
+    for(size_t i = 0; i < TEST_KEELOQ_BATCH_KEY_COUNT; i++) {
+        decrypt[i] = subghz_protocol_keeloq_common_decrypt(hop, keys[i]);
+    }
+    uint32_t scalar_time = furi_get_tick() - scalar_start;
+
+    uint32_t batch_start = furi_get_tick();
+    subghz_protocol_keeloq_common_decrypt_batch(
+        hop, keys, decrypt_batch, TEST_KEELOQ_BATCH_KEY_COUNT);
+    uint32_t batch_time = furi_get_tick() - batch_start;
+
+    mu_assert_mem_eq(decrypt, decrypt_batch, sizeof(uint32_t) * TEST_KEELOQ_BATCH_KEY_COUNT);
+
+    FURI_LOG_I(
+        TAG,
+        "KeeLoq decrypt: %lu keys/s single, %lu keys/s batch",
+        TEST_KEELOQ_BATCH_KEY_COUNT * 1000 / MAX(scalar_time, 1UL),
+        TEST_KEELOQ_BATCH_KEY_COUNT * 1000 / MAX(batch_time, 1UL));
+
+    // Uneven tail must be handled as well
+    const size_t count = KEELOQ_BATCH_SIZE + 7;
+    subghz_protocol_keeloq_common_normal_learning_batch(fix, keys, man, count);
+    for(size_t i = 0; i < count; i++) {
+        mu_assert(
+            man[i] == subghz_protocol_keeloq_common_normal_learning(fix, keys[i]),
+            "Normal learning batch mismatch");
+    }
+    subghz_protocol_keeloq_common_secure_learning_batch(fix, seed, keys, man, count);
+    for(size_t i = 0; i < count; i++) {
+        mu_assert(
+            man[i] == subghz_protocol_keeloq_common_secure_learning(fix, seed, keys[i]),
+            "Secure learning batch mismatch");
+    }
+
+    free(keys);
+    free(man);
+    free(decrypt);
+    free(decrypt_batch);
+}
+
+typedef struct {
+    uint32_t pairs;
+    uint32_t calls;
+    uint32_t errors;
+    bool level;
+} SubGhzWorkerTest;
+
+static void subghz_worker_test_pair_batch_callback(
+    void* context,
+    const LevelDuration* pairs,
+    size_t count) {
+    SubGhzWorkerTest* test = context;
+    test->calls++;
+    for(size_t i = 0; i < count; i++) {
+        bool level = level_duration_get_level(pairs[i]);
+        uint32_t duration = level_duration_get_duration(pairs[i]);
+        // Very first pair is the empty filter state
+        if(test->pairs && ((level == test->level) || (duration != 500))) test->errors++;
+        test->level = level;
+        test->pairs++;
+    }
+}
+
+MU_TEST(subghz_worker_batch_test) {
+    SubGhzWorkerTest test = {0};
+    SubGhzWorkerStats stats;
+    SubGhzWorker* worker = subghz_worker_alloc();
+    subghz_worker_set_pair_batch_callback(worker, subghz_worker_test_pair_batch_callback);
+    subghz_worker_set_context(worker, &test);
+
+    subghz_worker_start(worker);
+    uint32_t start = furi_get_tick();
+    for(size_t i = 0; i < TEST_WORKER_EDGE_COUNT; i++) {
+        subghz_worker_rx_callback(i % 2 == 0, 500, worker);
+        if(i % 256 == 0) furi_delay_tick(1);
+    }
+    furi_delay_ms(50);
+    uint32_t elapsed = furi_get_tick() - start;
+    subghz_worker_stop(worker);
+
+    subghz_worker_get_stats(worker, &stats);
+    mu_assert_int_eq(TEST_WORKER_EDGE_COUNT, stats.edges);
+    mu_assert_int_eq(TEST_WORKER_EDGE_COUNT, stats.pairs);
+    mu_assert_int_eq(TEST_WORKER_EDGE_COUNT, test.pairs);
+    mu_assert_int_eq(0, stats.overruns);
+    mu_assert_int_eq(0, test.errors);
+    mu_check(test.calls < test.pairs);
+    FURI_LOG_I(
+        TAG, "Worker: %lu pairs in %lu callbacks, %lums", test.pairs, test.calls, elapsed);
+
+    // Fill the stream before the thread runs, next edge must report the overrun
+    for(size_t i = 0; i < TEST_WORKER_STREAM_SIZE + 16; i++) {
+        subghz_worker_rx_callback(i % 2 == 0, 500, worker);
+    }
+    subghz_worker_start(worker);
+    furi_delay_ms(50);
+    subghz_worker_rx_callback(true, 500, worker);
+    furi_delay_ms(50);
+    subghz_worker_stop(worker);
+
+    subghz_worker_get_stats(worker, &stats);
+    mu_assert_int_eq(1, stats.overruns);
+
+    subghz_worker_free(worker);
+}
+
 typedef enum {
     SubGhzHalAsyncTxTestTypeNormal,
     SubGhzHalAsyncTxTestTypeInvalidStart,
@@ -810,9 +976,146 @@ MU_TEST(subghz_random_test) {
     mu_assert(subghz_decode_random_test(TEST_RANDOM_DIR_NAME), "Random test error\r\n");
 }
 
+static void subghz_test_decoder_stats_total(SubGhzReceiverDecoderStats* total) {
+    const char* name;
+    SubGhzReceiverDecoderStats stats;
+    total->fed = 0;
+    total->skipped = 0;
+    for(size_t i = 0; subghz_receiver_get_decoder_stats(receiver_handler, i, &name, &stats); i++) {
+        total->fed += stats.fed;
+        total->skipped += stats.skipped;
+    }
+}
+
+MU_TEST(subghz_random_preamble_filter_test) {
+    SubGhzReceiverDecoderStats before;
+    SubGhzReceiverDecoderStats after;
+
+    subghz_receiver_set_preamble_filter(receiver_handler, false);
+    uint32_t tick = furi_get_tick();
+    mu_assert(
+        subghz_decode_random_test(TEST_RANDOM_DIR_NAME),
+        "Random test without preamble filter error\r\n");
+    uint32_t unfiltered_ms = furi_get_tick() - tick;
+
+    subghz_receiver_set_preamble_filter(receiver_handler, true);
+    subghz_test_decoder_stats_total(&before);
+    tick = furi_get_tick();
+    mu_assert(
+        subghz_decode_random_test(TEST_RANDOM_DIR_NAME),
+        "Random test with preamble filter error\r\n");
+    uint32_t filtered_ms = furi_get_tick() - tick;
+    subghz_test_decoder_stats_total(&after);
+
+    FURI_LOG_I(
+        TAG,
+        "Preamble filter: fed %lu, skipped %lu, %lums vs %lums unfiltered",
+        after.fed - before.fed,
+        after.skipped - before.skipped,
+        filtered_ms,
+        unfiltered_ms);
+    mu_check(after.skipped > before.skipped);
+}
+
+static void subghz_test_count_rx_callback(
+    SubGhzReceiver* receiver,
+    SubGhzProtocolDecoderBase* decoder_base,
+    void* context) {
+    UNUSED(receiver);
+    UNUSED(decoder_base);
+    uint16_t* count = context;
+    (*count)++;
+}
+
+static size_t subghz_test_load_upload(const char* path, LevelDuration* upload, size_t size) {
+    size_t count = 0;
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* fff_data_file = flipper_format_file_alloc(storage);
+    FuriString* protocol = furi_string_alloc();
+
+    if(flipper_format_file_open_existing(fff_data_file, path) &&
+       flipper_format_read_string(fff_data_file, "Protocol", protocol)) {
+        SubGhzTransmitter* transmitter =
+            subghz_transmitter_alloc_init(environment_handler, furi_string_get_cstr(protocol));
+        flipper_format_rewind(fff_data_file);
+        if(subghz_transmitter_deserialize(transmitter, fff_data_file) ==
+           SubGhzProtocolStatusOk) {
+            while(count < size) {
+                LevelDuration level_duration = subghz_transmitter_yield(transmitter);
+                if(level_duration_is_reset(level_duration)) break;
+                upload[count++] = level_duration;
+            }
+        }
+        subghz_transmitter_free(transmitter);
+    }
+
+    furi_string_free(protocol);
+    flipper_format_free(fff_data_file);
+    furi_record_close(RECORD_STORAGE);
+    return count;
+}
+
+static bool subghz_test_decoder_stats(
+    SubGhzReceiver* receiver,
+    const char* decoder_name,
+    SubGhzReceiverDecoderStats* stats) {
+    const char* name;
+    for(size_t i = 0; subghz_receiver_get_decoder_stats(receiver, i, &name, stats); i++) {
+        if(strcmp(name, decoder_name) == 0) return true;
+    }
+    return false;
+}
+
+MU_TEST(subghz_preamble_filter_noise_test) {
+    LevelDuration* upload = malloc(sizeof(LevelDuration) * TEST_PREAMBLE_UPLOAD_SIZE);
+    size_t upload_count = subghz_test_load_upload(
+        EXT_PATH("unit_tests/subghz/princeton.sub"), upload, TEST_PREAMBLE_UPLOAD_SIZE);
+    mu_check(upload_count > 0);
+
+    // Live RX never resets the receiver between packets, so neither does this test
+    uint16_t decoded = 0;
+    SubGhzReceiver* receiver = subghz_receiver_alloc_init(environment_handler);
+    subghz_receiver_set_filter(receiver, SubGhzProtocolFlag_Decodable);
+    subghz_receiver_set_rx_callback(receiver, subghz_test_count_rx_callback, &decoded);
+
+    subghz_receiver_decode_batch(receiver, upload, upload_count);
+    uint16_t decoded_first = decoded;
+    mu_check(decoded_first > 0);
+
+    SubGhzReceiverDecoderStats before;
+    SubGhzReceiverDecoderStats after;
+    mu_check(subghz_test_decoder_stats(receiver, SUBGHZ_PROTOCOL_PRINCETON_NAME, &before));
+
+    // Short pulses of both levels, far from the Princeton preamble
+    uint32_t seed = 0x5EED5EED;
+    for(size_t i = 0; i < TEST_PREAMBLE_NOISE_COUNT; i++) {
+        seed = seed * 1664525UL + 1013904223UL;
+        subghz_receiver_decode(receiver, i & 1, 100 + (seed >> 16) % 900);
+    }
+
+    mu_check(subghz_test_decoder_stats(receiver, SUBGHZ_PROTOCOL_PRINCETON_NAME, &after));
+    FURI_LOG_I(
+        TAG,
+        "Noise after packet: fed %lu, skipped %lu",
+        after.fed - before.fed,
+        after.skipped - before.skipped);
+    // The decoder drops back to its reset step within a few pulses and is skipped from there
+    mu_check(after.skipped - before.skipped > TEST_PREAMBLE_NOISE_COUNT / 2);
+
+    // Princeton remembers the last key across noise, so the second packet may decode once more
+    subghz_receiver_decode_batch(receiver, upload, upload_count);
+    mu_check(decoded >= decoded_first * 2);
+
+    subghz_receiver_free(receiver);
+    free(upload);
+}
+
 MU_TEST_SUITE(subghz) {
     subghz_test_init();
     MU_RUN_TEST(subghz_keystore_test);
+    MU_RUN_TEST(subghz_keystore_learning_cache_test);
+    MU_RUN_TEST(subghz_keeloq_batch_test);
+    MU_RUN_TEST(subghz_worker_batch_test);
 
     MU_RUN_TEST(subghz_hal_async_tx_test);
 
@@ -884,6 +1187,8 @@ MU_TEST_SUITE(subghz) {
     MU_RUN_TEST(subghz_encoder_dooya_test);
 
     MU_RUN_TEST(subghz_random_test);
+    MU_RUN_TEST(subghz_random_preamble_filter_test);
+    MU_RUN_TEST(subghz_preamble_filter_noise_test);
     subghz_test_deinit();
 }
 
@@ -32,7 +32,10 @@
 #define TAG "Mfkey32"
 #define NFC_MF_CLASSIC_KEY_LEN (13)
 
-#define MIN_RAM 115632
+// Heap left to the rest of the system while state tables take the biggest free block
+#define HEAP_RESERVE (16 * 1024)
+// State tables never take more than this, so GUI and storage keep working during a long crack
+#define POOL_SIZE_MAX (96U * 1024U)
 #define LF_POLY_ODD (0x29CE5C)
 #define LF_POLY_EVEN (0x870804)
 #define CONST_M1_1 (LF_POLY_EVEN << 1 | 1)
@@ -47,8 +50,16 @@
 
 static int eta_round_time = 56;
 static int eta_total_time = 900;
-// MSB_LIMIT: Chunk size (out of 256)
+// MSB_LIMIT: MSBs (out of 256) per pass over all semi-states, adjusted to fit free heap
 static int MSB_LIMIT = 16;
+static int msb_rounds_total = 16;
+#define MSB_MAX (256)
+// Unique states per MSB are about 480 on average, same limit as the fixed per-MSB arrays had
+#define MSB_STATES_MAX (768)
+#define MSB_CHUNK_STATES (63)
+#define MSB_EXPECTED_CHUNKS (9)
+// States of one MSB, with room for extend_table
+#define TEMP_STATES (MSB_STATES_MAX * 2)
 
 struct Crypto1State {
     uint32_t odd, even;
@@ -57,9 +68,30 @@ struct Crypto1Params {
     uint64_t key;
     uint32_t nr0_enc, uid_xor_nt0, uid_xor_nt1, nr1_enc, p64b, ar1_enc;
 };
+struct MsbChunk {
+    struct MsbChunk* next;
+    uint32_t states[MSB_CHUNK_STATES];
+};
 struct Msb {
-    int tail;
-    uint32_t states[768];
+    struct MsbChunk* chunk; // newest chunk
+    uint16_t tail; // states in newest chunk
+    uint16_t count;
+};
+typedef enum {
+    MsbTablesOk,
+    MsbTablesPoolFull, // retry with fewer MSBs per pass
+    MsbTablesStatesFull, // nonce data gives more states than a MSB can hold
+} MsbTablesResult;
+struct MsbTables {
+    struct Msb odd[MSB_MAX];
+    struct Msb even[MSB_MAX];
+    struct MsbChunk* pool;
+    int pool_size;
+    int pool_used;
+};
+struct SortBuffer {
+    uint32_t offset[256];
+    unsigned int states[TEMP_STATES];
 };
 
 typedef enum {
@@ -324,46 +356,33 @@ static inline int state_loop(unsigned int* states_buffer, int xks, int m1, int m
     return states_tail;
 }
 
-int binsearch(unsigned int data[], int start, int stop) {
-    int mid, val = data[stop] & 0xff000000;
-    while(start != stop) {
-        mid = (stop - start) >> 1;
-        if((data[start + mid] ^ 0x80000000) > (val ^ 0x80000000))
-            stop = start + mid;
-        else
-            start += mid + 1;
-    }
-    return start;
-}
-void quicksort(unsigned int array[], int low, int high) {
-    //if (SIZEOF(array) == 0)
-    //    return;
-    if(low >= high) return;
-    int middle = low + (high - low) / 2;
-    unsigned int pivot = array[middle];
-    int i = low, j = high;
-    while(i <= j) {
-        while(array[i] < pivot) {
-            i++;
-        }
-        while(array[j] > pivot) {
-            j--;
-        }
-        if(i <= j) { // swap
-            int temp = array[i];
-            array[i] = array[j];
-            array[j] = temp;
-            i++;
-            j--;
-        }
+// Bucket states by MSB, order inside of bucket doesn't matter
+static void bucket_sort(unsigned int data[], int head, int tail, struct SortBuffer* temp) {
+    uint32_t* offset = temp->offset;
+    uint32_t total = 0;
+    int i;
+    memset(offset, 0, sizeof(temp->offset));
+    for(i = head; i <= tail; i++) {
+        offset[data[i] >> 24]++;
     }
-    if(low < j) {
-        quicksort(array, low, j);
+    for(i = 0; i < 256; i++) {
+        uint32_t count = offset[i];
+        offset[i] = total;
+        total += count;
     }
-    if(high > i) {
-        quicksort(array, i, high);
+    for(i = head; i <= tail; i++) {
+        temp->states[offset[data[i] >> 24]++] = data[i];
     }
+    memcpy(&data[head], temp->states, total * sizeof(unsigned int));
+}
+
+// Find first state of the bucket ending at stop
+static inline int bucket_head(unsigned int data[], int start, int stop) {
+    unsigned int msb = data[stop] >> 24;
+    while(stop > start && (data[stop - 1] >> 24) == msb) stop--;
+    return stop;
 }
+
 int extend_table(unsigned int data[], int tbl, int end, int bit, int m1, int m2) {
     for(data[tbl] <<= 1; tbl <= end; data[++tbl] <<= 1) {
         if((filter(data[tbl]) ^ filter(data[tbl] | 1)) != 0) {
@@ -394,7 +413,8 @@ int old_recover(
     int rem,
     int s,
     struct Crypto1Params* p,
-    int first_run) {
+    int first_run,
+    struct SortBuffer* temp) {
     int o, e, i;
     if(rem == -1) {
         for(e = e_head; e <= e_tail; ++e) {
@@ -423,20 +443,22 @@ int old_recover(
         }
     }
     first_run = 0;
-    quicksort(odd, o_head, o_tail);
-    quicksort(even, e_head, e_tail);
+    bucket_sort(odd, o_head, o_tail, temp);
+    bucket_sort(even, e_head, e_tail, temp);
+    // Buckets are walked from the top, so extend_table can grow them over processed ones
     while(o_tail >= o_head && e_tail >= e_head) {
         if(((odd[o_tail] ^ even[e_tail]) >> 24) == 0) {
-            o_tail = binsearch(odd, o_head, o = o_tail);
-            e_tail = binsearch(even, e_head, e = e_tail);
-            s = old_recover(odd, o_tail--, o, oks, even, e_tail--, e, eks, rem, s, p, first_run);
+            o_tail = bucket_head(odd, o_head, o = o_tail);
+            e_tail = bucket_head(even, e_head, e = e_tail);
+            s = old_recover(
+                odd, o_tail--, o, oks, even, e_tail--, e, eks, rem, s, p, first_run, temp);
             if(s == -1) {
                 break;
             }
-        } else if((odd[o_tail] ^ 0x80000000) > (even[e_tail] ^ 0x80000000)) {
-            o_tail = binsearch(odd, o_head, o_tail) - 1;
+        } else if(odd[o_tail] > even[e_tail]) {
+            o_tail = bucket_head(odd, o_head, o_tail) - 1;
         } else {
-            e_tail = binsearch(even, e_head, e_tail) - 1;
+            e_tail = bucket_head(even, e_head, e_tail) - 1;
         }
     }
     return s;
@@ -453,31 +475,61 @@ static inline int sync_state(ProgramState* program_state) {
     return 0;
 }
 
-int calculate_msb_tables(
+static MsbTablesResult
+    msb_add_state(struct MsbTables* tables, struct Msb* msb, uint32_t state) {
+    int tail = msb->tail;
+    for(struct MsbChunk* chunk = msb->chunk; chunk; chunk = chunk->next) {
+        for(int j = 0; j < tail; j++) {
+            if(chunk->states[j] == state) return MsbTablesOk;
+        }
+        tail = MSB_CHUNK_STATES;
+    }
+
+    // States of one MSB are copied into TEMP_STATES buffers and extended there
+    if(msb->count >= MSB_STATES_MAX) return MsbTablesStatesFull;
+    if(!msb->chunk || msb->tail == MSB_CHUNK_STATES) {
+        if(tables->pool_used == tables->pool_size) return MsbTablesPoolFull;
+        struct MsbChunk* chunk = &tables->pool[tables->pool_used++];
+        chunk->next = msb->chunk;
+        msb->chunk = chunk;
+        msb->tail = 0;
+    }
+    msb->chunk->states[msb->tail++] = state;
+    msb->count++;
+    return MsbTablesOk;
+}
+
+static int msb_copy_states(struct Msb* msb, unsigned int* states) {
+    int tail = msb->tail;
+    int count = 0;
+    for(struct MsbChunk* chunk = msb->chunk; chunk; chunk = chunk->next) {
+        memcpy(&states[count], chunk->states, tail * sizeof(unsigned int));
+        count += tail;
+        tail = MSB_CHUNK_STATES;
+    }
+    return count;
+}
+
+static MsbTablesResult msb_tables_fill(
     int oks,
     int eks,
-    int msb_round,
-    struct Crypto1Params* p,
+    unsigned int msb_head,
+    unsigned int msb_count,
+    struct MsbTables* tables,
     unsigned int* states_buffer,
-    struct Msb* odd_msbs,
-    struct Msb* even_msbs,
-    unsigned int* temp_states_odd,
-    unsigned int* temp_states_even,
     ProgramState* program_state) {
-    //FURI_LOG_I(TAG, "MSB GO %i", msb_iter); // DEBUG
-    unsigned int msb_head = (MSB_LIMIT * msb_round); // msb_iter ranges from 0 to (256/MSB_LIMIT)-1
-    unsigned int msb_tail = (MSB_LIMIT * (msb_round + 1));
-    int states_tail = 0, tail = 0;
-    int i = 0, j = 0, semi_state = 0, found = 0;
+    int states_tail = 0, semi_state = 0, i = 0;
     unsigned int msb = 0;
-    // TODO: Why is this necessary?
-    memset(odd_msbs, 0, MSB_LIMIT * sizeof(struct Msb));
-    memset(even_msbs, 0, MSB_LIMIT * sizeof(struct Msb));
+    MsbTablesResult result = MsbTablesOk;
+
+    memset(tables->odd, 0, msb_count * sizeof(struct Msb));
+    memset(tables->even, 0, msb_count * sizeof(struct Msb));
+    tables->pool_used = 0;
 
     for(semi_state = 1 << 20; semi_state >= 0; semi_state--) {
         if(semi_state % 32768 == 0) {
             if(sync_state(program_state) == 1) {
-                return 0;
+                return MsbTablesOk;
             }
         }
 
@@ -486,20 +538,10 @@ int calculate_msb_tables(
             states_tail = state_loop(states_buffer, oks, CONST_M1_1, CONST_M2_1);
 
             for(i = states_tail; i >= 0; i--) {
-                msb = states_buffer[i] >> 24;
-                if((msb >= msb_head) && (msb < msb_tail)) {
-                    found = 0;
-                    for(j = 0; j < odd_msbs[msb - msb_head].tail - 1; j++) {
-                        if(odd_msbs[msb - msb_head].states[j] == states_buffer[i]) {
-                            found = 1;
-                            break;
-                        }
-                    }
-
-                    if(!found) {
-                        tail = odd_msbs[msb - msb_head].tail++;
-                        odd_msbs[msb - msb_head].states[tail] = states_buffer[i];
-                    }
+                msb = (states_buffer[i] >> 24) - msb_head;
+                if(msb < msb_count) {
+                    result = msb_add_state(tables, &tables->odd[msb], states_buffer[i]);
+                    if(result != MsbTablesOk) return result;
                 }
             }
         }
@@ -509,70 +551,105 @@ int calculate_msb_tables(
             states_tail = state_loop(states_buffer, eks, CONST_M1_2, CONST_M2_2);
 
             for(i = 0; i <= states_tail; i++) {
-                msb = states_buffer[i] >> 24;
-                if((msb >= msb_head) && (msb < msb_tail)) {
-                    found = 0;
-
-                    for(j = 0; j < even_msbs[msb - msb_head].tail; j++) {
-                        if(even_msbs[msb - msb_head].states[j] == states_buffer[i]) {
-                            found = 1;
-                            break;
-                        }
-                    }
-
-                    if(!found) {
-                        tail = even_msbs[msb - msb_head].tail++;
-                        even_msbs[msb - msb_head].states[tail] = states_buffer[i];
-                    }
+                msb = (states_buffer[i] >> 24) - msb_head;
+                if(msb < msb_count) {
+                    result = msb_add_state(tables, &tables->even[msb], states_buffer[i]);
+                    if(result != MsbTablesOk) return result;
                 }
             }
         }
     }
 
+    return MsbTablesOk;
+}
+
+// Returns 1 when the key is found, -1 when this key candidate can not be searched
+int calculate_msb_tables(
+    int oks,
+    int eks,
+    unsigned int msb_head,
+    unsigned int* msb_count,
+    struct Crypto1Params* p,
+    unsigned int* states_buffer,
+    struct MsbTables* tables,
+    unsigned int* temp_states_odd,
+    unsigned int* temp_states_even,
+    struct SortBuffer* temp_states_sort,
+    ProgramState* program_state) {
+    unsigned int i = 0;
+
+    // Single pass over semi-states fills tables for all MSBs that fit, fewer if heap runs out
+    MsbTablesResult result;
+    while((result = msb_tables_fill(
+               oks, eks, msb_head, *msb_count, tables, states_buffer, program_state)) ==
+          MsbTablesPoolFull) {
+        if(*msb_count == 1) break;
+        *msb_count = *msb_count / 2;
+        FURI_LOG_W(TAG, "State tables don't fit, retry with %u MSBs", *msb_count);
+    }
+    if(result != MsbTablesOk) {
+        FURI_LOG_E(
+            TAG,
+            "%s at MSB %u, skipping this nonce",
+            (result == MsbTablesPoolFull) ? "Out of memory" : "Too many states",
+            msb_head);
+        return -1;
+    }
+    if(program_state->close_thread_please) {
+        return 0;
+    }
+
     oks >>= 12;
     eks >>= 12;
 
-    for(i = 0; i < MSB_LIMIT; i++) {
+    for(i = 0; i < *msb_count; i++) {
         if(sync_state(program_state) == 1) {
             return 0;
         }
-        // TODO: Why is this necessary?
-        memset(temp_states_even, 0, sizeof(unsigned int) * (1280));
-        memset(temp_states_odd, 0, sizeof(unsigned int) * (1280));
-        memcpy(temp_states_odd, odd_msbs[i].states, odd_msbs[i].tail * sizeof(unsigned int));
-        memcpy(temp_states_even, even_msbs[i].states, even_msbs[i].tail * sizeof(unsigned int));
+        int odd_count = msb_copy_states(&tables->odd[i], temp_states_odd);
+        int even_count = msb_copy_states(&tables->even[i], temp_states_even);
         int res = old_recover(
             temp_states_odd,
             0,
-            odd_msbs[i].tail,
+            odd_count - 1,
             oks,
             temp_states_even,
             0,
-            even_msbs[i].tail,
+            even_count - 1,
             eks,
             3,
             0,
             p,
-            1);
+            1,
+            temp_states_sort);
         if(res == -1) {
             return 1;
         }
-        //odd_msbs[i].tail = 0;
-        //even_msbs[i].tail = 0;
     }
 
     return 0;
 }
 
+static int msb_rounds(unsigned int msb_head) {
+    return (MSB_MAX - msb_head + MSB_LIMIT - 1) / MSB_LIMIT;
+}
+
 bool recover(struct Crypto1Params* p, int ks2, ProgramState* program_state) {
     bool found = false;
     unsigned int* states_buffer = malloc(sizeof(unsigned int) * (2 << 9));
-    struct Msb* odd_msbs = (struct Msb*)malloc(MSB_LIMIT * sizeof(struct Msb));
-    struct Msb* even_msbs = (struct Msb*)malloc(MSB_LIMIT * sizeof(struct Msb));
-    unsigned int* temp_states_odd = malloc(sizeof(unsigned int) * (1280));
-    unsigned int* temp_states_even = malloc(sizeof(unsigned int) * (1280));
+    unsigned int* temp_states_odd = malloc(sizeof(unsigned int) * TEMP_STATES);
+    unsigned int* temp_states_even = malloc(sizeof(unsigned int) * TEMP_STATES);
+    struct SortBuffer* temp_states_sort = malloc(sizeof(struct SortBuffer));
+    struct MsbTables* tables = malloc(sizeof(struct MsbTables));
+    // Heap that is left goes to state tables, up to POOL_SIZE_MAX
+    size_t pool_size = memmgr_heap_get_max_free_block();
+    pool_size = pool_size > HEAP_RESERVE ? MIN(pool_size - HEAP_RESERVE, POOL_SIZE_MAX) : 0;
+    tables->pool_size = MAX(pool_size / sizeof(struct MsbChunk), 2U * MSB_EXPECTED_CHUNKS);
+    tables->pool = malloc(tables->pool_size * sizeof(struct MsbChunk));
+    MSB_LIMIT = CLAMP(tables->pool_size / (2 * MSB_EXPECTED_CHUNKS), MSB_MAX, 1);
     int oks = 0, eks = 0;
-    int i = 0, msb = 0;
+    int i = 0;
+    unsigned int msb = 0, msb_count = 0;
     for(i = 31; i >= 0; i -= 2) {
         oks = oks << 1 | BEBIT(ks2, i);
     }
@@ -580,23 +657,33 @@ bool recover(struct Crypto1Params* p, int ks2, ProgramState* program_state) {
         eks = eks << 1 | BEBIT(ks2, i);
     }
     int bench_start = furi_hal_rtc_get_timestamp();
+    msb_rounds_total = msb_rounds(0);
+    eta_total_time = eta_round_time * msb_rounds_total;
     program_state->eta_total = eta_total_time;
     program_state->eta_timestamp = bench_start;
-    for(msb = 0; msb <= ((256 / MSB_LIMIT) - 1); msb++) {
-        program_state->search = msb;
+    for(msb = 0, i = 0; msb < MSB_MAX; msb += msb_count, i++) {
+        msb_count = MIN((unsigned int)MSB_LIMIT, MSB_MAX - msb);
+        program_state->search = i;
         program_state->eta_round = eta_round_time;
-        program_state->eta_total = eta_total_time - (eta_round_time * msb);
-        if(calculate_msb_tables(
-               oks,
-               eks,
-               msb,
-               p,
-               states_buffer,
-               odd_msbs,
-               even_msbs,
-               temp_states_odd,
-               temp_states_even,
-               program_state)) {
+        program_state->eta_total = eta_round_time * msb_rounds(msb);
+        msb_rounds_total = i + msb_rounds(msb);
+        int res = calculate_msb_tables(
+            oks,
+            eks,
+            msb,
+            &msb_count,
+            p,
+            states_buffer,
+            tables,
+            temp_states_odd,
+            temp_states_even,
+            temp_states_sort,
+            program_state);
+        if(res == -1) {
+            // Key candidate can not be searched, the next nonce is tried instead
+            break;
+        }
+        if(res) {
             int bench_stop = furi_hal_rtc_get_timestamp();
             FURI_LOG_I(TAG, "Cracked in %i seconds", bench_stop - bench_start);
             found = true;
@@ -605,12 +692,18 @@ bool recover(struct Crypto1Params* p, int ks2, ProgramState* program_state) {
         if(program_state->close_thread_please) {
             break;
         }
+        // Size next passes by the chunks this key actually used
+        if(tables->pool_used > 0) {
+            MSB_LIMIT = CLAMP(
+                tables->pool_size * msb_count / tables->pool_used * 9 / 10, MSB_MAX, 1);
+        }
     }
     free(states_buffer);
-    free(odd_msbs);
-    free(even_msbs);
     free(temp_states_odd);
     free(temp_states_even);
+    free(temp_states_sort);
+    free(tables->pool);
+    free(tables);
     return found;
 }
 
@@ -1042,12 +1135,6 @@ void mfkey32(ProgramState* program_state) {
         free(keyarray);
         return;
     }
-    if(memmgr_get_free_heap() < MIN_RAM) {
-        // System has less than the guaranteed amount of RAM (140 KB) - adjust some parameters to run anyway at half speed
-        eta_round_time *= 2;
-        eta_total_time *= 2;
-        MSB_LIMIT /= 2;
-    }
     program_state->mfkey_state = MfkeyAttack;
     // TODO: Work backwards on this array and free memory
     for(i = 0; i < nonce_arr->total_nonces; i++) {
@@ -1166,7 +1253,7 @@ static void render_callback(Canvas* const canvas, void* ctx) {
             sizeof(draw_str),
             "Round: %d/%d - ETA %02d Sec",
             (program_state->search) + 1, // Zero indexed
-            256 / MSB_LIMIT,
+            msb_rounds_total,
             program_state->eta_round);
         elements_progress_bar_with_text(canvas, 5, 31, 118, eta_round, draw_str);
         snprintf(draw_str, sizeof(draw_str), "Total ETA %03d Sec", program_state->eta_total);
@@ -353,10 +353,11 @@ void infrared_tx_start_signal(Infrared* infrared, InfraredSignal* signal) {
 void infrared_tx_start_button_index(Infrared* infrared, size_t button_index) {
     furi_assert(button_index < infrared_remote_get_button_count(infrared->remote));
 
-    InfraredRemoteButton* button = infrared_remote_get_button(infrared->remote, button_index);
-    InfraredSignal* signal = infrared_remote_button_get_signal(button);
+    InfraredSignal* signal = infrared_remote_get_signal(infrared->remote, button_index);
 
-    infrared_tx_start_signal(infrared, signal);
+    if(signal) {
+        infrared_tx_start_signal(infrared, signal);
+    }
 }
 
 void infrared_tx_start_received(Infrared* infrared) {
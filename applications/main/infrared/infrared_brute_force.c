@@ -2,13 +2,36 @@
 
 #include <stdlib.h>
 #include <m-dict.h>
+#include <m-array.h>
 #include <flipper_format/flipper_format.h>
 
 #include "infrared_signal.h"
 
+#define TAG "InfraredBruteForce"
+
+/* Compiled database (.irx) layout, all values are little endian:
+ * header, signal records in .ir file order (see infrared_signal_save_binary),
+ * then name table at table_offset. Every name table entry holds
+ * uint8 name length, name, uint32 signal count and uint32 record offsets.
+ */
+#define INFRARED_BRUTE_FORCE_INDEX_EXTENSION "x"
+#define INFRARED_BRUTE_FORCE_INDEX_MAGIC (0x31585249UL) /* "IRX1" */
+#define INFRARED_BRUTE_FORCE_INDEX_VERSION (1U)
+#define INFRARED_BRUTE_FORCE_INDEX_CACHE_SIZE (512U)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t source_size;
+    uint32_t signal_count;
+    uint32_t name_count;
+    uint32_t table_offset;
+} InfraredBruteForceIndexHeader;
+
 typedef struct {
     uint32_t index;
     uint32_t count;
+    uint32_t offsets_position;
 } InfraredBruteForceRecord;
 
 DICT_DEF2(
@@ -18,20 +41,37 @@ DICT_DEF2(
     InfraredBruteForceRecord,
     M_POD_OPLIST);
 
+ARRAY_DEF(InfraredBruteForceOffsetArray, uint32_t, M_POD_OPLIST);
+#define M_OPL_InfraredBruteForceOffsetArray_t() \
+    ARRAY_OPLIST(InfraredBruteForceOffsetArray, M_POD_OPLIST)
+
+DICT_DEF2(
+    InfraredBruteForceOffsetDict,
+    FuriString*,
+    FURI_STRING_OPLIST,
+    InfraredBruteForceOffsetArray_t,
+    M_OPL_InfraredBruteForceOffsetArray_t());
+
 struct InfraredBruteForce {
     FlipperFormat* ff;
+    File* index_file;
     const char* db_filename;
     FuriString* current_record_name;
+    InfraredBruteForceRecord current_record;
+    uint32_t current_signal_index;
     InfraredSignal* current_signal;
     InfraredBruteForceRecordDict_t records;
+    bool is_indexed;
     bool is_started;
 };
 
 InfraredBruteForce* infrared_brute_force_alloc() {
     InfraredBruteForce* brute_force = malloc(sizeof(InfraredBruteForce));
     brute_force->ff = NULL;
+    brute_force->index_file = NULL;
     brute_force->db_filename = NULL;
     brute_force->current_signal = NULL;
+    brute_force->is_indexed = false;
     brute_force->is_started = false;
     brute_force->current_record_name = furi_string_alloc();
     InfraredBruteForceRecordDict_init(brute_force->records);
@@ -50,9 +90,197 @@ void infrared_brute_force_set_db_filename(InfraredBruteForce* brute_force, const
     brute_force->db_filename = db_filename;
 }
 
-bool infrared_brute_force_calculate_messages(InfraredBruteForce* brute_force) {
-    furi_assert(!brute_force->is_started);
-    furi_assert(brute_force->db_filename);
+static void infrared_brute_force_get_index_filename(
+    InfraredBruteForce* brute_force,
+    FuriString* index_filename) {
+    furi_string_printf(
+        index_filename, "%s%s", brute_force->db_filename, INFRARED_BRUTE_FORCE_INDEX_EXTENSION);
+}
+
+static bool infrared_brute_force_index_is_actual(
+    Storage* storage,
+    File* index_file,
+    const char* db_filename,
+    const char* index_filename) {
+    bool is_actual = false;
+
+    do {
+        FileInfo db_info;
+        uint32_t db_timestamp, index_timestamp;
+        if(storage_common_stat(storage, db_filename, &db_info) != FSE_OK) break;
+        if(storage_common_timestamp(storage, db_filename, &db_timestamp) != FSE_OK) break;
+        if(storage_common_timestamp(storage, index_filename, &index_timestamp) != FSE_OK) break;
+        if(index_timestamp < db_timestamp) break;
+
+        if(!storage_file_open(index_file, index_filename, FSAM_READ, FSOM_OPEN_EXISTING)) break;
+
+        InfraredBruteForceIndexHeader header;
+        if(storage_file_read(index_file, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != INFRARED_BRUTE_FORCE_INDEX_MAGIC) break;
+        if(header.version != INFRARED_BRUTE_FORCE_INDEX_VERSION) break;
+        if(header.source_size != db_info.size) break;
+        if(!storage_file_seek(index_file, header.table_offset, true)) break;
+
+        is_actual = true;
+    } while(false);
+
+    if(!is_actual) {
+        storage_file_close(index_file);
+    }
+
+    return is_actual;
+}
+
+static bool infrared_brute_force_index_write_names(
+    File* index_file,
+    InfraredBruteForceOffsetDict_t names) {
+    InfraredBruteForceOffsetDict_it_t it;
+    for(InfraredBruteForceOffsetDict_it(it, names); !InfraredBruteForceOffsetDict_end_p(it);
+        InfraredBruteForceOffsetDict_next(it)) {
+        const InfraredBruteForceOffsetDict_itref_t* name = InfraredBruteForceOffsetDict_cref(it);
+        const uint8_t name_length = furi_string_size(name->key);
+        const uint32_t count = InfraredBruteForceOffsetArray_size(name->value);
+        const size_t offsets_size = count * sizeof(uint32_t);
+
+        if(storage_file_write(index_file, &name_length, sizeof(uint8_t)) != sizeof(uint8_t) ||
+           storage_file_write(index_file, furi_string_get_cstr(name->key), name_length) !=
+               name_length ||
+           storage_file_write(index_file, &count, sizeof(uint32_t)) != sizeof(uint32_t) ||
+           storage_file_write_large(
+               index_file, InfraredBruteForceOffsetArray_cget(name->value, 0), offsets_size) !=
+               offsets_size) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool infrared_brute_force_index_build(
+    Storage* storage,
+    File* index_file,
+    const char* db_filename,
+    const char* index_filename) {
+    FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
+    InfraredSignal* signal = infrared_signal_alloc();
+    FuriString* signal_name = furi_string_alloc();
+    InfraredBruteForceOffsetDict_t names;
+    InfraredBruteForceOffsetDict_init(names);
+
+    InfraredBruteForceIndexHeader header = {
+        .magic = INFRARED_BRUTE_FORCE_INDEX_MAGIC,
+        .version = INFRARED_BRUTE_FORCE_INDEX_VERSION,
+    };
+
+    bool success = false;
+
+    do {
+        FileInfo db_info;
+        if(storage_common_stat(storage, db_filename, &db_info) != FSE_OK) break;
+        header.source_size = db_info.size;
+
+        if(!flipper_format_buffered_file_open_existing(ff, db_filename)) break;
+        if(!storage_file_open(index_file, index_filename, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS))
+            break;
+        if(storage_file_write(index_file, &header, sizeof(header)) != sizeof(header)) break;
+
+        bool is_written = true;
+        while(is_written && flipper_format_read_string(ff, "name", signal_name)) {
+            if(furi_string_size(signal_name) > UINT8_MAX) {
+                FURI_LOG_E(TAG, "Signal name is too long");
+                is_written = false;
+            } else if(infrared_signal_read_body(signal, ff)) {
+                const uint32_t offset = storage_file_tell(index_file);
+                is_written = infrared_signal_save_binary(signal, index_file);
+                InfraredBruteForceOffsetArray_push_back(
+                    *InfraredBruteForceOffsetDict_safe_get(names, signal_name), offset);
+                ++header.signal_count;
+            }
+        }
+
+        if(!is_written) break;
+
+        header.name_count = InfraredBruteForceOffsetDict_size(names);
+        header.table_offset = storage_file_tell(index_file);
+        if(!infrared_brute_force_index_write_names(index_file, names)) break;
+
+        if(!storage_file_seek(index_file, 0, true)) break;
+        if(storage_file_write(index_file, &header, sizeof(header)) != sizeof(header)) break;
+        if(!storage_file_seek(index_file, header.table_offset, true)) break;
+
+        success = true;
+    } while(false);
+
+    if(!success) {
+        FURI_LOG_W(TAG, "Failed to build %s", index_filename);
+        storage_file_close(index_file);
+        storage_simply_remove(storage, index_filename);
+    }
+
+    InfraredBruteForceOffsetDict_clear(names);
+    furi_string_free(signal_name);
+    infrared_signal_free(signal);
+    flipper_format_free(ff);
+    return success;
+}
+
+static bool infrared_brute_force_index_read_names(InfraredBruteForce* brute_force, File* file) {
+    FuriString* signal_name = furi_string_alloc();
+    char name_buffer[UINT8_MAX + 1];
+    bool success = true;
+
+    while(success) {
+        uint8_t name_length;
+        if(storage_file_read(file, &name_length, sizeof(uint8_t)) != sizeof(uint8_t)) break;
+
+        uint32_t count;
+        success = (storage_file_read(file, name_buffer, name_length) == name_length) &&
+                  (storage_file_read(file, &count, sizeof(uint32_t)) == sizeof(uint32_t));
+        if(!success) break;
+
+        const uint32_t offsets_position = storage_file_tell(file);
+        name_buffer[name_length] = '\0';
+        furi_string_set(signal_name, name_buffer);
+
+        InfraredBruteForceRecord* record =
+            InfraredBruteForceRecordDict_get(brute_force->records, signal_name);
+        if(record) {
+            record->count = count;
+            record->offsets_position = offsets_position;
+        }
+
+        success = storage_file_seek(file, offsets_position + count * sizeof(uint32_t), true);
+    }
+
+    furi_string_free(signal_name);
+    return success;
+}
+
+static bool infrared_brute_force_calculate_messages_indexed(InfraredBruteForce* brute_force) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* index_file = storage_file_alloc(storage);
+    FuriString* index_filename = furi_string_alloc();
+    infrared_brute_force_get_index_filename(brute_force, index_filename);
+    storage_file_set_cache_size(index_file, INFRARED_BRUTE_FORCE_INDEX_CACHE_SIZE);
+
+    const char* db_filename = brute_force->db_filename;
+    const char* index_path = furi_string_get_cstr(index_filename);
+
+    bool success =
+        infrared_brute_force_index_is_actual(storage, index_file, db_filename, index_path) ||
+        infrared_brute_force_index_build(storage, index_file, db_filename, index_path);
+
+    if(success) {
+        success = infrared_brute_force_index_read_names(brute_force, index_file);
+    }
+
+    furi_string_free(index_filename);
+    storage_file_free(index_file);
+    furi_record_close(RECORD_STORAGE);
+    return success;
+}
+
+static bool infrared_brute_force_calculate_messages_text(InfraredBruteForce* brute_force) {
     bool success = false;
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
@@ -77,6 +305,26 @@ bool infrared_brute_force_calculate_messages(InfraredBruteForce* brute_force) {
     return success;
 }
 
+bool infrared_brute_force_calculate_messages(InfraredBruteForce* brute_force) {
+    furi_assert(!brute_force->is_started);
+    furi_assert(brute_force->db_filename);
+
+    brute_force->is_indexed = infrared_brute_force_calculate_messages_indexed(brute_force);
+    if(brute_force->is_indexed) {
+        return true;
+    }
+
+    FURI_LOG_W(TAG, "Index is not available, falling back to %s", brute_force->db_filename);
+    InfraredBruteForceRecordDict_it_t it;
+    for(InfraredBruteForceRecordDict_it(it, brute_force->records);
+        !InfraredBruteForceRecordDict_end_p(it);
+        InfraredBruteForceRecordDict_next(it)) {
+        InfraredBruteForceRecordDict_ref(it)->value.count = 0;
+    }
+
+    return infrared_brute_force_calculate_messages_text(brute_force);
+}
+
 bool infrared_brute_force_start(
     InfraredBruteForce* brute_force,
     uint32_t index,
@@ -94,6 +342,7 @@ bool infrared_brute_force_start(
             *record_count = record->value.count;
             if(*record_count) {
                 furi_string_set(brute_force->current_record_name, record->key);
+                brute_force->current_record = record->value;
             }
             break;
         }
@@ -101,11 +350,28 @@ bool infrared_brute_force_start(
 
     if(*record_count) {
         Storage* storage = furi_record_open(RECORD_STORAGE);
-        brute_force->ff = flipper_format_buffered_file_alloc(storage);
         brute_force->current_signal = infrared_signal_alloc();
+        brute_force->current_signal_index = 0;
         brute_force->is_started = true;
-        success =
-            flipper_format_buffered_file_open_existing(brute_force->ff, brute_force->db_filename);
+
+        if(brute_force->is_indexed) {
+            FuriString* index_filename = furi_string_alloc();
+            infrared_brute_force_get_index_filename(brute_force, index_filename);
+            brute_force->index_file = storage_file_alloc(storage);
+            storage_file_set_cache_size(
+                brute_force->index_file, INFRARED_BRUTE_FORCE_INDEX_CACHE_SIZE);
+            success = storage_file_open(
+                brute_force->index_file,
+                furi_string_get_cstr(index_filename),
+                FSAM_READ,
+                FSOM_OPEN_EXISTING);
+            furi_string_free(index_filename);
+        } else {
+            brute_force->ff = flipper_format_buffered_file_alloc(storage);
+            success = flipper_format_buffered_file_open_existing(
+                brute_force->ff, brute_force->db_filename);
+        }
+
         if(!success) infrared_brute_force_stop(brute_force);
     }
     return success;
@@ -119,17 +385,45 @@ void infrared_brute_force_stop(InfraredBruteForce* brute_force) {
     furi_assert(brute_force->is_started);
     furi_string_reset(brute_force->current_record_name);
     infrared_signal_free(brute_force->current_signal);
-    flipper_format_free(brute_force->ff);
+    if(brute_force->ff) {
+        flipper_format_free(brute_force->ff);
+    }
+    if(brute_force->index_file) {
+        storage_file_free(brute_force->index_file);
+    }
     brute_force->current_signal = NULL;
     brute_force->ff = NULL;
+    brute_force->index_file = NULL;
     brute_force->is_started = false;
     furi_record_close(RECORD_STORAGE);
 }
 
+static bool infrared_brute_force_read_next_indexed(InfraredBruteForce* brute_force) {
+    File* file = brute_force->index_file;
+    const InfraredBruteForceRecord* record = &brute_force->current_record;
+
+    if(brute_force->current_signal_index >= record->count) {
+        return false;
+    }
+
+    const uint32_t offset_position =
+        record->offsets_position + brute_force->current_signal_index * sizeof(uint32_t);
+    ++brute_force->current_signal_index;
+
+    uint32_t offset;
+    return storage_file_seek(file, offset_position, true) &&
+           (storage_file_read(file, &offset, sizeof(uint32_t)) == sizeof(uint32_t)) &&
+           storage_file_seek(file, offset, true) &&
+           infrared_signal_read_binary(brute_force->current_signal, file);
+}
+
 bool infrared_brute_force_send_next(InfraredBruteForce* brute_force) {
     furi_assert(brute_force->is_started);
-    const bool success = infrared_signal_search_and_read(
-        brute_force->current_signal, brute_force->ff, brute_force->current_record_name);
+    const bool success =
+        brute_force->is_indexed ?
+            infrared_brute_force_read_next_indexed(brute_force) :
+            infrared_signal_search_and_read(
+                brute_force->current_signal, brute_force->ff, brute_force->current_record_name);
     if(success) {
         infrared_signal_transmit(brute_force->current_signal);
     }
@@ -140,7 +434,7 @@ void infrared_brute_force_add_record(
     InfraredBruteForce* brute_force,
     uint32_t index,
     const char* name) {
-    InfraredBruteForceRecord value = {.index = index, .count = 0};
+    InfraredBruteForceRecord value = {.index = index, .count = 0, .offsets_position = 0};
     FuriString* key;
     key = furi_string_alloc_set(name);
     InfraredBruteForceRecordDict_set_at(brute_force->records, key, value);
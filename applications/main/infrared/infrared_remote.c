@@ -3,21 +3,62 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdlib.h>
+#include <string.h>
 #include <m-array.h>
 #include <toolbox/path.h>
 #include <storage/storage.h>
 #include <core/common_defines.h>
+#include <flipper_format/flipper_format_i.h>
+#include <toolbox/stream/stream.h>
 
 #define TAG "InfraredRemote"
 
+/* Decoded signals kept in memory, others are read from the file on demand */
+#define INFRARED_REMOTE_SIGNAL_CACHE_SIZE (4U)
+#define INFRARED_REMOTE_TMP_EXTENSION ".tmp"
+
 ARRAY_DEF(InfraredButtonArray, InfraredRemoteButton*, M_PTR_OPLIST);
 
 struct InfraredRemote {
     InfraredButtonArray_t buttons;
     FuriString* name;
     FuriString* path;
+    /* Buttons with loaded signals, most recently used first. Buttons that hold
+     * a signal but are not listed here are not stored in the file yet. */
+    InfraredRemoteButton* signal_cache[INFRARED_REMOTE_SIGNAL_CACHE_SIZE];
+    size_t signal_cache_count;
 };
 
+static bool
+    infrared_remote_signal_cache_remove(InfraredRemote* remote, InfraredRemoteButton* button) {
+    for(size_t i = 0; i < remote->signal_cache_count; ++i) {
+        if(remote->signal_cache[i] == button) {
+            memmove(
+                &remote->signal_cache[i],
+                &remote->signal_cache[i + 1],
+                (remote->signal_cache_count - i - 1) * sizeof(InfraredRemoteButton*));
+            --remote->signal_cache_count;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void
+    infrared_remote_signal_cache_push(InfraredRemote* remote, InfraredRemoteButton* button) {
+    if(remote->signal_cache_count == INFRARED_REMOTE_SIGNAL_CACHE_SIZE) {
+        --remote->signal_cache_count;
+        infrared_remote_button_reset_signal(remote->signal_cache[remote->signal_cache_count]);
+    }
+
+    memmove(
+        &remote->signal_cache[1],
+        &remote->signal_cache[0],
+        remote->signal_cache_count * sizeof(InfraredRemoteButton*));
+    remote->signal_cache[0] = button;
+    ++remote->signal_cache_count;
+}
+
 static void infrared_remote_clear_buttons(InfraredRemote* remote) {
     InfraredButtonArray_it_t it;
     for(InfraredButtonArray_it(it, remote->buttons); !InfraredButtonArray_end_p(it);
@@ -25,6 +66,70 @@ static void infrared_remote_clear_buttons(InfraredRemote* remote) {
         infrared_remote_button_free(*InfraredButtonArray_cref(it));
     }
     InfraredButtonArray_reset(remote->buttons);
+    remote->signal_cache_count = 0;
+}
+
+static bool infrared_remote_read_signal(
+    FlipperFormat* ff,
+    InfraredRemoteButton* button,
+    InfraredSignal* signal,
+    FuriString* name) {
+    Stream* stream = flipper_format_get_raw_stream(ff);
+
+    if(!stream_seek(stream, infrared_remote_button_get_offset(button), StreamOffsetFromStart) ||
+       !infrared_signal_read(signal, ff, name)) {
+        return false;
+    }
+
+    if(!furi_string_equal(name, infrared_remote_button_get_name(button))) {
+        FURI_LOG_E(
+            TAG, "File was changed, expected \'%s\'", infrared_remote_button_get_name(button));
+        return false;
+    }
+
+    return true;
+}
+
+/* Copies the signal body from the source file as is, so signals that are not loaded,
+ * or can not be parsed at all, are not lost when the file is rewritten */
+static bool infrared_remote_copy_signal(
+    Stream* source,
+    InfraredRemoteButton* button,
+    FlipperFormat* ff,
+    FuriString* line) {
+    if(!stream_seek(source, infrared_remote_button_get_offset(button), StreamOffsetFromStart)) {
+        return false;
+    }
+
+    // Name is written from the button, it may have been renamed
+    bool name_found = false;
+    while(!name_found && stream_read_line(source, line)) {
+        name_found = furi_string_start_with_str(line, "name:");
+    }
+    if(!name_found) {
+        FURI_LOG_E(TAG, "No signal for \'%s\' in file", infrared_remote_button_get_name(button));
+        return false;
+    }
+
+    // Body ends at the next name, comments and blank lines before it belong to the next signal
+    const size_t body_start = stream_tell(source);
+    size_t body_end = body_start;
+    bool ends_with_newline = true;
+    while(stream_read_line(source, line) && !furi_string_start_with_str(line, "name:")) {
+        if(!furi_string_start_with_str(line, "#") && !furi_string_equal_str(line, "\n")) {
+            body_end = stream_tell(source);
+            ends_with_newline = furi_string_end_with_str(line, "\n");
+        }
+    }
+
+    Stream* stream = flipper_format_get_raw_stream(ff);
+    const size_t body_size = body_end - body_start;
+    return flipper_format_write_comment_cstr(ff, "") &&
+           flipper_format_write_string_cstr(
+               ff, "name", infrared_remote_button_get_name(button)) &&
+           stream_seek(source, body_start, StreamOffsetFromStart) &&
+           (stream_copy(source, stream, body_size) == body_size) &&
+           (ends_with_newline || stream_write_char(stream, '\n') == 1);
 }
 
 InfraredRemote* infrared_remote_alloc() {
@@ -32,6 +137,7 @@ InfraredRemote* infrared_remote_alloc() {
     InfraredButtonArray_init(remote->buttons);
     remote->name = furi_string_alloc();
     remote->path = furi_string_alloc();
+    remote->signal_cache_count = 0;
     return remote;
 }
 
@@ -74,6 +180,39 @@ InfraredRemoteButton* infrared_remote_get_button(InfraredRemote* remote, size_t
     return *InfraredButtonArray_get(remote->buttons, index);
 }
 
+InfraredSignal* infrared_remote_get_signal(InfraredRemote* remote, size_t index) {
+    furi_assert(index < InfraredButtonArray_size(remote->buttons));
+    InfraredRemoteButton* button = *InfraredButtonArray_get(remote->buttons, index);
+    InfraredSignal* signal = infrared_remote_button_get_signal(button);
+
+    if(signal) {
+        if(infrared_remote_signal_cache_remove(remote, button)) {
+            infrared_remote_signal_cache_push(remote, button);
+        }
+        return signal;
+    }
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
+    FuriString* name = furi_string_alloc();
+    signal = infrared_signal_alloc();
+
+    if(flipper_format_buffered_file_open_existing(ff, furi_string_get_cstr(remote->path)) &&
+       infrared_remote_read_signal(ff, button, signal, name)) {
+        infrared_remote_signal_cache_push(remote, button);
+        infrared_remote_button_attach_signal(button, signal);
+    } else {
+        FURI_LOG_E(TAG, "Failed to load \'%s\'", infrared_remote_button_get_name(button));
+        infrared_signal_free(signal);
+        signal = NULL;
+    }
+
+    furi_string_free(name);
+    flipper_format_free(ff);
+    furi_record_close(RECORD_STORAGE);
+    return signal;
+}
+
 bool infrared_remote_find_button_by_name(InfraredRemote* remote, const char* name, size_t* index) {
     for(size_t i = 0; i < InfraredButtonArray_size(remote->buttons); i++) {
         InfraredRemoteButton* button = *InfraredButtonArray_get(remote->buttons, i);
@@ -96,14 +235,23 @@ bool infrared_remote_add_button(InfraredRemote* remote, const char* name, Infrar
 bool infrared_remote_rename_button(InfraredRemote* remote, const char* new_name, size_t index) {
     furi_assert(index < InfraredButtonArray_size(remote->buttons));
     InfraredRemoteButton* button = *InfraredButtonArray_get(remote->buttons, index);
+
+    FuriString* old_name = furi_string_alloc_set(infrared_remote_button_get_name(button));
     infrared_remote_button_set_name(button, new_name);
-    return infrared_remote_store(remote);
+    bool success = infrared_remote_store(remote);
+    if(!success) {
+        infrared_remote_button_set_name(button, furi_string_get_cstr(old_name));
+    }
+    furi_string_free(old_name);
+
+    return success;
 }
 
 bool infrared_remote_delete_button(InfraredRemote* remote, size_t index) {
     furi_assert(index < InfraredButtonArray_size(remote->buttons));
     InfraredRemoteButton* button;
     InfraredButtonArray_pop_at(&button, remote->buttons, index);
+    infrared_remote_signal_cache_remove(remote, button);
     infrared_remote_button_free(button);
     return infrared_remote_store(remote);
 }
@@ -120,28 +268,70 @@ void infrared_remote_move_button(InfraredRemote* remote, size_t index_orig, size
 bool infrared_remote_store(InfraredRemote* remote) {
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* ff = flipper_format_file_alloc(storage);
+    FlipperFormat* ff_source = NULL;
+    FuriString* buf = furi_string_alloc();
+
     const char* path = furi_string_get_cstr(remote->path);
+    FuriString* tmp_path = furi_string_alloc_printf("%s%s", path, INFRARED_REMOTE_TMP_EXTENSION);
+
+    const size_t button_count = InfraredButtonArray_size(remote->buttons);
+    size_t* offsets = malloc(sizeof(size_t) * MAX(button_count, 1U));
 
     FURI_LOG_I(TAG, "store file: \'%s\'", path);
 
-    bool success = flipper_format_file_open_always(ff, path) &&
+    // Signals that are not loaded are copied from the old file as is, so write a new one aside
+    bool success = flipper_format_file_open_always(ff, furi_string_get_cstr(tmp_path)) &&
                    flipper_format_write_header_cstr(ff, "IR signals file", 1);
-    if(success) {
-        InfraredButtonArray_it_t it;
-        for(InfraredButtonArray_it(it, remote->buttons); !InfraredButtonArray_end_p(it);
-            InfraredButtonArray_next(it)) {
-            InfraredRemoteButton* button = *InfraredButtonArray_cref(it);
+
+    for(size_t i = 0; success && (i < button_count); ++i) {
+        InfraredRemoteButton* button = *InfraredButtonArray_get(remote->buttons, i);
+        InfraredSignal* button_signal = infrared_remote_button_get_signal(button);
+        offsets[i] = stream_tell(flipper_format_get_raw_stream(ff));
+
+        if(button_signal) {
             success = infrared_signal_save(
-                infrared_remote_button_get_signal(button),
-                ff,
-                infrared_remote_button_get_name(button));
-            if(!success) {
-                break;
+                button_signal, ff, infrared_remote_button_get_name(button));
+        } else {
+            if(!ff_source) {
+                ff_source = flipper_format_buffered_file_alloc(storage);
+                success = flipper_format_buffered_file_open_existing(ff_source, path);
             }
+            success = success && infrared_remote_copy_signal(
+                                     flipper_format_get_raw_stream(ff_source), button, ff, buf);
         }
     }
 
+    // Writes may be deferred, the file is complete only if it is closed successfully
+    if(!flipper_format_file_close(ff) && success) {
+        FURI_LOG_E(TAG, "Failed to write \'%s\'", furi_string_get_cstr(tmp_path));
+        success = false;
+    }
     flipper_format_free(ff);
+    if(ff_source) {
+        flipper_format_free(ff_source);
+    }
+
+    if(success) {
+        success = storage_common_move(storage, furi_string_get_cstr(tmp_path), path) == FSE_OK;
+    }
+
+    if(success) {
+        for(size_t i = 0; i < button_count; ++i) {
+            InfraredRemoteButton* button = *InfraredButtonArray_get(remote->buttons, i);
+            infrared_remote_button_set_offset(button, offsets[i]);
+            // Newly added signals are in the file now and may be evicted
+            if(infrared_remote_button_get_signal(button) &&
+               !infrared_remote_signal_cache_remove(remote, button)) {
+                infrared_remote_signal_cache_push(remote, button);
+            }
+        }
+    } else {
+        storage_simply_remove(storage, furi_string_get_cstr(tmp_path));
+    }
+
+    free(offsets);
+    furi_string_free(tmp_path);
+    furi_string_free(buf);
     furi_record_close(RECORD_STORAGE);
     return success;
 }
@@ -167,15 +357,15 @@ bool infrared_remote_load(InfraredRemote* remote, FuriString* path) {
         infrared_remote_set_name(remote, furi_string_get_cstr(buf));
         infrared_remote_set_path(remote, furi_string_get_cstr(path));
 
-        for(bool can_read = true; can_read;) {
+        // Only names and positions are loaded, signal bodies are read on demand
+        Stream* stream = flipper_format_get_raw_stream(ff);
+        size_t offset = stream_tell(stream);
+        while(flipper_format_read_string(ff, "name", buf)) {
             InfraredRemoteButton* button = infrared_remote_button_alloc();
-            can_read = infrared_signal_read(infrared_remote_button_get_signal(button), ff, buf);
-            if(can_read) {
-                infrared_remote_button_set_name(button, furi_string_get_cstr(buf));
-                InfraredButtonArray_push_back(remote->buttons, button);
-            } else {
-                infrared_remote_button_free(button);
-            }
+            infrared_remote_button_set_name(button, furi_string_get_cstr(buf));
+            infrared_remote_button_set_offset(button, offset);
+            InfraredButtonArray_push_back(remote->buttons, button);
+            offset = stream_tell(stream);
         }
         success = true;
     } while(false);
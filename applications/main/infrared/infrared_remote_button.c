@@ -5,18 +5,20 @@
 struct InfraredRemoteButton {
     FuriString* name;
     InfraredSignal* signal;
+    size_t offset;
 };
 
 InfraredRemoteButton* infrared_remote_button_alloc() {
     InfraredRemoteButton* button = malloc(sizeof(InfraredRemoteButton));
     button->name = furi_string_alloc();
-    button->signal = infrared_signal_alloc();
+    button->signal = NULL;
+    button->offset = 0;
     return button;
 }
 
 void infrared_remote_button_free(InfraredRemoteButton* button) {
     furi_string_free(button->name);
-    infrared_signal_free(button->signal);
+    infrared_remote_button_reset_signal(button);
     free(button);
 }
 
@@ -29,9 +31,32 @@ const char* infrared_remote_button_get_name(InfraredRemoteButton* button) {
 }
 
 void infrared_remote_button_set_signal(InfraredRemoteButton* button, InfraredSignal* signal) {
+    if(!button->signal) {
+        button->signal = infrared_signal_alloc();
+    }
     infrared_signal_set_signal(button->signal, signal);
 }
 
 InfraredSignal* infrared_remote_button_get_signal(InfraredRemoteButton* button) {
     return button->signal;
 }
+
+void infrared_remote_button_attach_signal(InfraredRemoteButton* button, InfraredSignal* signal) {
+    infrared_remote_button_reset_signal(button);
+    button->signal = signal;
+}
+
+void infrared_remote_button_reset_signal(InfraredRemoteButton* button) {
+    if(button->signal) {
+        infrared_signal_free(button->signal);
+        button->signal = NULL;
+    }
+}
+
+void infrared_remote_button_set_offset(InfraredRemoteButton* button, size_t offset) {
+    button->offset = offset;
+}
+
+size_t infrared_remote_button_get_offset(InfraredRemoteButton* button) {
+    return button->offset;
+}
@@ -11,4 +11,12 @@ void infrared_remote_button_set_name(InfraredRemoteButton* button, const char* n
 const char* infrared_remote_button_get_name(InfraredRemoteButton* button);
 
 void infrared_remote_button_set_signal(InfraredRemoteButton* button, InfraredSignal* signal);
+/* Returns NULL if the signal body is not loaded, see infrared_remote_get_signal */
 InfraredSignal* infrared_remote_button_get_signal(InfraredRemoteButton* button);
+/* Takes ownership of the signal */
+void infrared_remote_button_attach_signal(InfraredRemoteButton* button, InfraredSignal* signal);
+void infrared_remote_button_reset_signal(InfraredRemoteButton* button);
+
+/* Position in the remote file where the search for this button's name begins */
+void infrared_remote_button_set_offset(InfraredRemoteButton* button, size_t offset);
+size_t infrared_remote_button_get_offset(InfraredRemoteButton* button);
@@ -8,6 +8,9 @@
 
 #define TAG "InfraredSignal"
 
+#define INFRARED_SIGNAL_BINARY_TYPE_PARSED (0U)
+#define INFRARED_SIGNAL_BINARY_TYPE_RAW (1U)
+
 struct InfraredSignal {
     bool is_raw;
     union {
@@ -146,7 +149,7 @@ static inline bool infrared_signal_read_raw(InfraredSignal* signal, FlipperForma
     return success;
 }
 
-static bool infrared_signal_read_body(InfraredSignal* signal, FlipperFormat* ff) {
+bool infrared_signal_read_body(InfraredSignal* signal, FlipperFormat* ff) {
     FuriString* tmp = furi_string_alloc();
 
     bool success = false;
@@ -299,6 +302,105 @@ bool infrared_signal_search_and_read(
     return success;
 }
 
+bool infrared_signal_save_binary(InfraredSignal* signal, File* file) {
+    if(signal->is_raw) {
+        const InfraredRawSignal* raw = &signal->payload.raw;
+        const uint8_t type = INFRARED_SIGNAL_BINARY_TYPE_RAW;
+        const uint32_t timings_size = raw->timings_size;
+        const size_t timings_bytes = timings_size * sizeof(uint32_t);
+
+        return (storage_file_write(file, &type, sizeof(type)) == sizeof(type)) &&
+               (storage_file_write(file, &raw->frequency, sizeof(uint32_t)) ==
+                sizeof(uint32_t)) &&
+               (storage_file_write(file, &raw->duty_cycle, sizeof(float)) == sizeof(float)) &&
+               (storage_file_write(file, &timings_size, sizeof(uint32_t)) == sizeof(uint32_t)) &&
+               (storage_file_write_large(file, raw->timings, timings_bytes) == timings_bytes);
+    } else {
+        const InfraredMessage* message = &signal->payload.message;
+        const char* protocol_name = infrared_get_protocol_name(message->protocol);
+        const uint8_t type = INFRARED_SIGNAL_BINARY_TYPE_PARSED;
+        const uint8_t protocol_name_length = strlen(protocol_name);
+
+        return (storage_file_write(file, &type, sizeof(type)) == sizeof(type)) &&
+               (storage_file_write(file, &protocol_name_length, sizeof(uint8_t)) ==
+                sizeof(uint8_t)) &&
+               (storage_file_write(file, protocol_name, protocol_name_length) ==
+                protocol_name_length) &&
+               (storage_file_write(file, &message->address, sizeof(uint32_t)) ==
+                sizeof(uint32_t)) &&
+               (storage_file_write(file, &message->command, sizeof(uint32_t)) ==
+                sizeof(uint32_t));
+    }
+}
+
+static bool infrared_signal_read_binary_message(InfraredSignal* signal, File* file) {
+    char protocol_name[UINT8_MAX + 1];
+    uint8_t protocol_name_length;
+    InfraredMessage message = {0};
+
+    bool success = false;
+
+    do {
+        if(storage_file_read(file, &protocol_name_length, sizeof(uint8_t)) != sizeof(uint8_t))
+            break;
+        if(storage_file_read(file, protocol_name, protocol_name_length) != protocol_name_length)
+            break;
+        protocol_name[protocol_name_length] = '\0';
+
+        message.protocol = infrared_get_protocol_by_name(protocol_name);
+
+        if(storage_file_read(file, &message.address, sizeof(uint32_t)) != sizeof(uint32_t)) break;
+        if(storage_file_read(file, &message.command, sizeof(uint32_t)) != sizeof(uint32_t)) break;
+        if(!infrared_signal_is_message_valid(&message)) break;
+
+        infrared_signal_set_message(signal, &message);
+        success = true;
+    } while(false);
+
+    return success;
+}
+
+static bool infrared_signal_read_binary_raw(InfraredSignal* signal, File* file) {
+    uint32_t timings_size, frequency;
+    float duty_cycle;
+
+    bool success = (storage_file_read(file, &frequency, sizeof(uint32_t)) == sizeof(uint32_t)) &&
+                   (storage_file_read(file, &duty_cycle, sizeof(float)) == sizeof(float)) &&
+                   (storage_file_read(file, &timings_size, sizeof(uint32_t)) == sizeof(uint32_t));
+
+    if(!success || timings_size > MAX_TIMINGS_AMOUNT) {
+        return false;
+    }
+
+    const size_t timings_bytes = timings_size * sizeof(uint32_t);
+    uint32_t* timings = malloc(timings_bytes);
+    success = storage_file_read_large(file, timings, timings_bytes) == timings_bytes;
+
+    if(success) {
+        infrared_signal_set_raw_signal(signal, timings, timings_size, frequency, duty_cycle);
+    }
+
+    free(timings);
+    return success;
+}
+
+bool infrared_signal_read_binary(InfraredSignal* signal, File* file) {
+    uint8_t type;
+    bool success = false;
+
+    if(storage_file_read(file, &type, sizeof(type)) != sizeof(type)) {
+        FURI_LOG_E(TAG, "Failed to read signal type");
+    } else if(type == INFRARED_SIGNAL_BINARY_TYPE_RAW) {
+        success = infrared_signal_read_binary_raw(signal, file);
+    } else if(type == INFRARED_SIGNAL_BINARY_TYPE_PARSED) {
+        success = infrared_signal_read_binary_message(signal, file);
+    } else {
+        FURI_LOG_E(TAG, "Unknown signal type");
+    }
+
+    return success;
+}
+
 void infrared_signal_transmit(InfraredSignal* signal) {
     if(signal->is_raw) {
         InfraredRawSignal* raw_signal = &signal->payload.raw;
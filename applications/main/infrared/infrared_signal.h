@@ -6,6 +6,7 @@
 
 #include <infrared.h>
 #include <flipper_format/flipper_format.h>
+#include <storage/storage.h>
 
 typedef struct InfraredSignal InfraredSignal;
 
@@ -37,9 +38,19 @@ InfraredMessage* infrared_signal_get_message(InfraredSignal* signal);
 
 bool infrared_signal_save(InfraredSignal* signal, FlipperFormat* ff, const char* name);
 bool infrared_signal_read(InfraredSignal* signal, FlipperFormat* ff, FuriString* name);
+bool infrared_signal_read_body(InfraredSignal* signal, FlipperFormat* ff);
 bool infrared_signal_search_and_read(
     InfraredSignal* signal,
     FlipperFormat* ff,
     const FuriString* name);
 
+/* Compact binary form used by compiled .irx databases, little endian:
+ * parsed: uint8 type (0), uint8 protocol name length, protocol name,
+ *         uint32 address, uint32 command
+ * raw:    uint8 type (1), uint32 frequency, float duty cycle,
+ *         uint32 timings count, uint32 timings[]
+ */
+bool infrared_signal_save_binary(InfraredSignal* signal, File* file);
+bool infrared_signal_read_binary(InfraredSignal* signal, File* file);
+
 void infrared_signal_transmit(InfraredSignal* signal);
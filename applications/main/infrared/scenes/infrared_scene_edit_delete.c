@@ -19,9 +19,13 @@ void infrared_scene_edit_delete_on_enter(void* context) {
         dialog_ex_set_header(dialog_ex, "Delete Button?", 64, 0, AlignCenter, AlignTop);
         InfraredRemoteButton* current_button =
             infrared_remote_get_button(remote, current_button_index);
-        InfraredSignal* signal = infrared_remote_button_get_signal(current_button);
+        InfraredSignal* signal = infrared_remote_get_signal(remote, current_button_index);
 
-        if(infrared_signal_is_raw(signal)) {
+        if(!signal) {
+            infrared_text_store_set(
+                infrared, 0, "%s\nUnknown", infrared_remote_button_get_name(current_button));
+
+        } else if(infrared_signal_is_raw(signal)) {
             const InfraredRawSignal* raw = infrared_signal_get_raw_signal(signal);
             infrared_text_store_set(
                 infrared,
@@ -6,6 +6,7 @@
 
 #include <lib/nfc/nfc_types.h>
 #include <lib/nfc/nfc_device.h>
+#include <lib/nfc/helpers/nfc_debug_pcap.h>
 
 static void nfc_cli_print_usage() {
     printf("Usage:\r\n");
@@ -16,6 +17,7 @@ static void nfc_cli_print_usage() {
     printf("\tapdu\t - Send APDU and print response \r\n");
     if(furi_hal_rtc_is_flag_set(FuriHalRtcFlagDebug)) {
         printf("\tfield\t - turn field on\r\n");
+        printf("\tpcap\t - convert debug trace to pcap\r\n");
     }
 }
 
@@ -100,6 +102,21 @@ static void nfc_cli_field(Cli* cli, FuriString* args) {
     furi_hal_nfc_sleep();
 }
 
+static void nfc_cli_pcap(Cli* cli, FuriString* args) {
+    UNUSED(cli);
+    UNUSED(args);
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    uint32_t frames = 0;
+    uint32_t frames_dropped = 0;
+    if(nfc_debug_pcap_export(storage, &frames, &frames_dropped)) {
+        printf("Exported %lu frames, %lu dropped during capture\r\n", frames, frames_dropped);
+    } else {
+        printf("Failed to export debug trace\r\n");
+    }
+    furi_record_close(RECORD_STORAGE);
+}
+
 static void nfc_cli_apdu(Cli* cli, FuriString* args) {
     UNUSED(cli);
     if(furi_hal_nfc_is_busy()) {
@@ -194,6 +211,10 @@ static void nfc_cli(Cli* cli, FuriString* args, void* context) {
                 nfc_cli_field(cli, args);
                 break;
             }
+            if(furi_string_cmp_str(cmd, "pcap") == 0) {
+                nfc_cli_pcap(cli, args);
+                break;
+            }
         }
 
         nfc_cli_print_usage();
@@ -54,6 +54,8 @@ bool nfc_scene_detect_reader_on_event(void* context, SceneManagerEvent event) {
         scene_manager_get_scene_state(nfc->scene_manager, NfcSceneDetectReader);
 
     if(event.type == SceneManagerEventTypeCustom) {
+        detect_reader_set_frames_dropped(
+            nfc->detect_reader, nfc_worker_get_frames_dropped(nfc->worker));
         if(event.event == NfcCustomEventViewExit) {
             nfc_worker_stop(nfc->worker);
             scene_manager_next_scene(nfc->scene_manager, NfcSceneMfkeyNoncesInfo);
@@ -13,6 +13,7 @@ struct DetectReader {
 typedef struct {
     uint16_t nonces;
     uint16_t nonces_max;
+    uint32_t frames_dropped;
     DetectReaderState state;
     FuriString* uid_str;
 } DetectReaderViewModel;
@@ -57,6 +58,10 @@ static void detect_reader_draw_callback(Canvas* canvas, void* model) {
         canvas_set_font(canvas, FontSecondary);
         snprintf(text, sizeof(text), "Nonce pairs: %d/%d", m->nonces, m->nonces_max);
         canvas_draw_str_aligned(canvas, 51, 35, AlignLeft, AlignTop, text);
+        if(m->frames_dropped) {
+            snprintf(text, sizeof(text), "Dropped: %lu", m->frames_dropped);
+            canvas_draw_str_aligned(canvas, 51, 44, AlignLeft, AlignTop, text);
+        }
     }
     // Draw button
     if(m->nonces > 0) {
@@ -124,6 +129,7 @@ void detect_reader_reset(DetectReader* detect_reader) {
         {
             model->nonces = 0;
             model->nonces_max = 0;
+            model->frames_dropped = 0;
             model->state = DetectReaderStateStart;
             furi_string_reset(model->uid_str);
         },
@@ -167,6 +173,16 @@ void detect_reader_set_nonces_collected(DetectReader* detect_reader, uint16_t no
         false);
 }
 
+void detect_reader_set_frames_dropped(DetectReader* detect_reader, uint32_t frames_dropped) {
+    furi_assert(detect_reader);
+
+    with_view_model(
+        detect_reader->view,
+        DetectReaderViewModel * model,
+        { model->frames_dropped = frames_dropped; },
+        true);
+}
+
 void detect_reader_set_state(DetectReader* detect_reader, DetectReaderState state) {
     furi_assert(detect_reader);
     with_view_model(
@@ -31,6 +31,8 @@ void detect_reader_set_nonces_max(DetectReader* detect_reader, uint16_t nonces_m
 
 void detect_reader_set_nonces_collected(DetectReader* detect_reader, uint16_t nonces_collected);
 
+void detect_reader_set_frames_dropped(DetectReader* detect_reader, uint32_t frames_dropped);
+
 void detect_reader_set_state(DetectReader* detect_reader, DetectReaderState state);
 
 void detect_reader_set_uid(DetectReader* detect_reader, uint8_t* uid, uint8_t uid_len);
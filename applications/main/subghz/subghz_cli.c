@@ -380,6 +380,12 @@ void subghz_cli_command_rx(Cli* cli, FuriString* args, void* context) {
     furi_hal_power_suppress_charge_exit();
 
     printf("\r\nPackets received %zu\r\n", instance->packet_count);
+    SubGhzKeystoreLearningCacheStats learning_cache_stats =
+        subghz_keystore_learning_cache_get_stats(subghz_environment_get_keystore(environment));
+    printf(
+        "Learning cache hits %lu, misses %lu\r\n",
+        learning_cache_stats.hits,
+        learning_cache_stats.misses);
 
     // Cleanup
     subghz_receiver_free(receiver);
@@ -563,6 +569,12 @@ void subghz_cli_command_decode_raw(Cli* cli, FuriString* args, void* context) {
         }
 
         printf("\r\nPackets received \033[0;32m%u\033[0m\r\n", instance->packet_count);
+        SubGhzKeystoreLearningCacheStats learning_cache_stats =
+            subghz_keystore_learning_cache_get_stats(subghz_environment_get_keystore(environment));
+        printf(
+            "Learning cache hits %lu, misses %lu\r\n",
+            learning_cache_stats.hits,
+            learning_cache_stats.misses);
 
         // Cleanup
         subghz_receiver_free(receiver);
@@ -28,6 +28,7 @@ Canvas* canvas_init() {
     // Setup u8g2
     u8g2_Setup_st756x_flipper(&canvas->fb, U8G2_R0, u8x8_hw_spi_stm32, u8g2_gpio_and_delay_stm32);
     canvas->orientation = CanvasOrientationHorizontal;
+    canvas->fb_committed = malloc(canvas_get_buffer_size(canvas));
     // Initialize display
     u8g2_InitDisplay(&canvas->fb);
     // Wake up display
@@ -43,6 +44,7 @@ Canvas* canvas_init() {
 void canvas_free(Canvas* canvas) {
     furi_assert(canvas);
     compress_icon_free(canvas->compress_icon);
+    free(canvas->fb_committed);
     free(canvas);
 }
 
@@ -56,9 +58,53 @@ void canvas_reset(Canvas* canvas) {
     canvas_set_font_direction(canvas, CanvasDirectionLeftToRight);
 }
 
+// Column and page address commands sent before each tile run
+#define CANVAS_COMMIT_AREA_OVERHEAD (3)
+
 void canvas_commit(Canvas* canvas) {
     furi_assert(canvas);
-    u8g2_SendBuffer(&canvas->fb);
+
+    if(canvas->commit_orientation != canvas->orientation) {
+        canvas->commit_orientation = canvas->orientation;
+        canvas->fb_committed_valid = false;
+    }
+
+    uint8_t* buffer = u8g2_GetBufferPtr(&canvas->fb);
+    const uint8_t tile_width = u8g2_GetBufferTileWidth(&canvas->fb);
+    const uint8_t tile_height = u8g2_GetBufferTileHeight(&canvas->fb);
+    const size_t page_size = tile_width * 8;
+
+    // Send only changed span of tiles in every page
+    canvas->commit_size = 0;
+    for(uint8_t ty = 0; ty < tile_height; ty++) {
+        uint8_t* page = &buffer[ty * page_size];
+        uint8_t* committed = &canvas->fb_committed[ty * page_size];
+
+        size_t start = 0;
+        size_t end = page_size;
+        if(canvas->fb_committed_valid) {
+            while(start < page_size && page[start] == committed[start]) start++;
+            if(start == page_size) continue;
+            while(page[end - 1] == committed[end - 1]) end--;
+        }
+
+        uint8_t tx = start / 8;
+        uint8_t tw = (end + 7) / 8 - tx;
+        u8g2_UpdateDisplayArea(&canvas->fb, tx, ty, tw, 1);
+        memcpy(&committed[tx * 8], &page[tx * 8], tw * 8);
+        canvas->commit_size += tw * 8 + CANVAS_COMMIT_AREA_OVERHEAD;
+    }
+    canvas->fb_committed_valid = true;
+}
+
+void canvas_invalidate(Canvas* canvas) {
+    furi_assert(canvas);
+    canvas->fb_committed_valid = false;
+}
+
+size_t canvas_get_commit_size(const Canvas* canvas) {
+    furi_assert(canvas);
+    return canvas->commit_size;
 }
 
 uint8_t* canvas_get_buffer(Canvas* canvas) {
@@ -23,6 +23,11 @@ struct Canvas {
     uint8_t width;
     uint8_t height;
     CompressIcon* compress_icon;
+    // Framebuffer content present on display, used to send only changed tiles
+    uint8_t* fb_committed;
+    bool fb_committed_valid;
+    CanvasOrientation commit_orientation;
+    size_t commit_size;
 };
 
 /** Allocate memory and initialize canvas
@@ -53,6 +58,22 @@ uint8_t* canvas_get_buffer(Canvas* canvas);
  */
 size_t canvas_get_buffer_size(const Canvas* canvas);
 
+/** Invalidate display content, next commit sends whole buffer
+ *
+ * @param      canvas  Canvas instance
+ */
+void canvas_invalidate(Canvas* canvas);
+
+/** Get bytes sent to display by last commit
+ *
+ * Includes addressing commands. Zero means frame didn't change.
+ *
+ * @param      canvas  Canvas instance
+ *
+ * @return     bytes count
+ */
+size_t canvas_get_commit_size(const Canvas* canvas);
+
 /** Set drawing region relative to real screen buffer
  *
  * @param      canvas    Canvas instance
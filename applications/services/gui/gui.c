@@ -3,6 +3,7 @@
 #include <assets_icons.h>
 #include <storage/storage.h>
 #include <storage/storage_i.h>
+#include <furi_hal.h>
 
 #define TAG "GuiSrv"
 
@@ -276,6 +277,7 @@ static void gui_redraw(Gui* gui) {
     do {
         if(gui->direct_draw) break;
 
+        uint32_t redraw_start = DWT->CYCCNT;
         canvas_reset(gui->canvas);
 
         if(gui->lockdown) {
@@ -296,14 +298,23 @@ static void gui_redraw(Gui* gui) {
         }
 
         canvas_commit(gui->canvas);
-        for
-            M_EACH(p, gui->canvas_callback_pair, CanvasCallbackPairArray_t) {
-                p->callback(
-                    canvas_get_buffer(gui->canvas),
-                    canvas_get_buffer_size(gui->canvas),
-                    canvas_get_orientation(gui->canvas),
-                    p->context);
-            }
+        size_t commit_size = canvas_get_commit_size(gui->canvas);
+        // Unchanged frame is already known to display and framebuffer callbacks
+        if(commit_size) {
+            for
+                M_EACH(p, gui->canvas_callback_pair, CanvasCallbackPairArray_t) {
+                    p->callback(
+                        canvas_get_buffer(gui->canvas),
+                        canvas_get_buffer_size(gui->canvas),
+                        canvas_get_orientation(gui->canvas),
+                        p->context);
+                }
+        }
+        FURI_LOG_T(
+            TAG,
+            "Redraw %luus, sent %zu bytes",
+            (DWT->CYCCNT - redraw_start) / furi_hal_cortex_instructions_per_microsecond(),
+            commit_size);
     } while(false);
 
     gui_unlock(gui);
@@ -508,6 +519,8 @@ void gui_add_framebuffer_callback(Gui* gui, GuiCanvasCommitCallback callback, vo
     gui_lock(gui);
     furi_assert(!CanvasCallbackPairArray_count(gui->canvas_callback_pair, p));
     CanvasCallbackPairArray_push_back(gui->canvas_callback_pair, p);
+    // New callback needs whole frame even if screen didn't change
+    canvas_invalidate(gui->canvas);
     gui_unlock(gui);
 
     // Request redraw
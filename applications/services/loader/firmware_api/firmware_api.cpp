@@ -10,6 +10,12 @@
 
 static_assert(!has_hash_collisions(elf_api_table), "Detected API method hash collision!");
 
+#ifndef APP_UNIT_TESTS
+constexpr auto elf_api_perfect_hash = perfect_hash_build(elf_api_table);
+
+static_assert(elf_api_perfect_hash.valid, "Failed to build API perfect hash table!");
+#endif
+
 #ifdef APP_UNIT_TESTS
 constexpr HashtableApiInterface mock_elf_api_interface{
     {
@@ -23,14 +29,16 @@ constexpr HashtableApiInterface mock_elf_api_interface{
 
 const ElfApiInterface* const firmware_api_interface = &mock_elf_api_interface;
 #else
-constexpr HashtableApiInterface elf_api_interface{
+constexpr PerfectHashtableApiInterface elf_api_interface{
     {
         .api_version_major = (elf_api_version >> 16),
         .api_version_minor = (elf_api_version & 0xFFFF),
-        .resolver_callback = &elf_resolve_from_hashtable,
+        .resolver_callback = &elf_resolve_from_perfect_hashtable,
     },
-    .table_cbegin = elf_api_table.cbegin(),
-    .table_cend = elf_api_table.cend(),
+    .seeds = elf_api_perfect_hash.seeds.data(),
+    .seed_count = elf_api_perfect_hash.seed_count,
+    .table = elf_api_perfect_hash.table.data(),
+    .table_size = elf_api_perfect_hash.table.size(),
 };
 const ElfApiInterface* const firmware_api_interface = &elf_api_interface;
 #endif
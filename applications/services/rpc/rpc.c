@@ -26,6 +26,12 @@ typedef enum {
 
 #define RPC_ALL_EVENTS (RpcEvtNewData | RpcEvtDisconnect)
 
+/* Fits the largest storage read response with its headers, so bulk transfers are encoded
+ * once. Bigger messages are sized first and streamed through it */
+#define RPC_TX_BUFFER_SIZE (RPC_STORAGE_CHUNK_SIZE_MAX + 128)
+/* Length prefix of message that fits RPC_TX_BUFFER_SIZE is at most 2 byte varint */
+#define RPC_TX_PREFIX_SIZE (2)
+
 DICT_DEF2(RpcHandlerDict, pb_size_t, M_DEFAULT_OPLIST, RpcHandler, M_POD_OPLIST)
 
 typedef struct {
@@ -76,6 +82,8 @@ struct RpcSession {
     bool terminate;
     void** system_contexts;
     bool decode_error;
+    uint8_t* tx_buffer;
+    size_t tx_buffer_size;
 
     FuriMutex* callbacks_mutex;
     RpcSendBytesCallback send_bytes_callback;
@@ -345,6 +353,7 @@ static void rpc_session_thread_pending_callback(void* context, uint32_t arg) {
     free(session->decoded_message);
     RpcHandlerDict_clear(session->handlers);
     furi_stream_buffer_free(session->stream);
+    free(session->tx_buffer);
 
     furi_mutex_acquire(session->callbacks_mutex, FuriWaitForever);
     if(session->terminated_callback) {
@@ -374,6 +383,7 @@ RpcSession* rpc_session_open(Rpc* rpc, RpcOwner owner) {
     RpcSession* session = malloc(sizeof(RpcSession));
     session->callbacks_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
     session->stream = furi_stream_buffer_alloc(RPC_BUFFER_SIZE, 1);
+    session->tx_buffer = malloc(RPC_TX_BUFFER_SIZE);
     session->rpc = rpc;
     session->terminate = false;
     session->decode_error = false;
@@ -435,36 +445,81 @@ void rpc_add_handler(RpcSession* session, pb_size_t message_tag, RpcHandler* han
     RpcHandlerDict_set_at(session->handlers, message_tag, *handler);
 }
 
+static void rpc_send_tx_buffer(RpcSession* session, uint8_t* buffer, size_t size) {
+#if SRV_RPC_DEBUG
+    rpc_debug_print_data("OUTPUT", buffer, size);
+#endif
+
+    if(session->send_bytes_callback) {
+        session->send_bytes_callback(session->context, buffer, size);
+    }
+}
+
+static bool rpc_send_stream_callback(pb_ostream_t* stream, const pb_byte_t* buf, size_t count) {
+    RpcSession* session = stream->state;
+
+    while(count) {
+        size_t chunk = MIN(count, RPC_TX_BUFFER_SIZE - session->tx_buffer_size);
+        memcpy(&session->tx_buffer[session->tx_buffer_size], buf, chunk);
+        session->tx_buffer_size += chunk;
+        buf += chunk;
+        count -= chunk;
+
+        if(session->tx_buffer_size == RPC_TX_BUFFER_SIZE) {
+            rpc_send_tx_buffer(session, session->tx_buffer, session->tx_buffer_size);
+            session->tx_buffer_size = 0;
+        }
+    }
+
+    return true;
+}
+
 void rpc_send(RpcSession* session, PB_Main* message) {
     furi_assert(session);
     furi_assert(message);
 
-    pb_ostream_t ostream = PB_OSTREAM_SIZING;
-
 #if SRV_RPC_DEBUG
     FURI_LOG_I(TAG, "OUTPUT:");
     rpc_debug_print_message(message);
 #endif
 
-    bool result = pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
-    furi_check(result && ostream.bytes_written);
-
-    uint8_t* buffer = malloc(ostream.bytes_written);
-    ostream = pb_ostream_from_buffer(buffer, ostream.bytes_written);
+    // rpc_send is called from several threads, tx buffer is guarded by callbacks mutex
+    furi_mutex_acquire(session->callbacks_mutex, FuriWaitForever);
 
-    pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
+    // Encode message once, right after the space reserved for length prefix
+    uint8_t* body = &session->tx_buffer[RPC_TX_PREFIX_SIZE];
+    pb_ostream_t ostream = pb_ostream_from_buffer(body, RPC_TX_BUFFER_SIZE - RPC_TX_PREFIX_SIZE);
 
-#if SRV_RPC_DEBUG
-    rpc_debug_print_data("OUTPUT", buffer, ostream.bytes_written);
-#endif
+    if(pb_encode(&ostream, &PB_Main_msg, message)) {
+        size_t size = ostream.bytes_written;
+        uint8_t prefix[RPC_TX_PREFIX_SIZE];
+        pb_ostream_t prefix_stream = pb_ostream_from_buffer(prefix, sizeof(prefix));
+        furi_check(pb_encode_varint(&prefix_stream, size));
 
-    furi_mutex_acquire(session->callbacks_mutex, FuriWaitForever);
-    if(session->send_bytes_callback) {
-        session->send_bytes_callback(session->context, buffer, ostream.bytes_written);
+        uint8_t* buffer = body - prefix_stream.bytes_written;
+        memcpy(buffer, prefix, prefix_stream.bytes_written);
+        rpc_send_tx_buffer(session, buffer, prefix_stream.bytes_written + size);
+    } else {
+        // Message is bigger than tx buffer: size it and stream through the buffer
+        ostream = (pb_ostream_t)PB_OSTREAM_SIZING;
+        furi_check(pb_encode(&ostream, &PB_Main_msg, message));
+        size_t size = ostream.bytes_written;
+
+        session->tx_buffer_size = 0;
+        ostream = (pb_ostream_t){
+            .callback = rpc_send_stream_callback,
+            .state = session,
+            .max_size = SIZE_MAX,
+        };
+        furi_check(pb_encode_varint(&ostream, size));
+        furi_check(pb_encode(&ostream, &PB_Main_msg, message));
+        furi_check(ostream.bytes_written > size);
+        if(session->tx_buffer_size) {
+            rpc_send_tx_buffer(session, session->tx_buffer, session->tx_buffer_size);
+        }
     }
-    furi_mutex_release(session->callbacks_mutex);
 
-    free(buffer);
+    furi_mutex_release(session->callbacks_mutex);
 }
 
 void rpc_send_and_release(RpcSession* session, PB_Main* message) {
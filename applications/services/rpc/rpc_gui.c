@@ -1,6 +1,7 @@
 #include "flipper.pb.h"
 #include "rpc_i.h"
 #include "gui.pb.h"
+#include "rpc_gui_delta.h"
 #include <gui/gui_i.h>
 #include <assets_icons.h>
 
@@ -26,6 +27,12 @@ typedef struct {
     // Transmit
     PB_Main* transmit_frame;
     FuriThread* transmit_thread;
+    // Delta streaming: latest framebuffer and its encoder
+    uint8_t* stream_frame;
+    RpcGuiDelta* stream_delta;
+    uint32_t stream_frames;
+    uint32_t stream_bytes;
+    uint32_t stream_start;
 
     bool virtual_display_not_empty;
     bool is_streaming;
@@ -52,17 +59,30 @@ static void rpc_system_gui_screen_stream_frame_callback(
     furi_assert(context);
 
     RpcGuiSystem* rpc_gui = (RpcGuiSystem*)context;
-    uint8_t* buffer = rpc_gui->transmit_frame->content.gui_screen_frame.data->bytes;
-
-    furi_assert(size == rpc_gui->transmit_frame->content.gui_screen_frame.data->size);
-
-    memcpy(buffer, data, size);
+    if(rpc_gui->stream_delta) {
+        // Encoded by transmit thread against the last sent frame
+        memcpy(rpc_gui->stream_frame, data, size);
+    } else {
+        uint8_t* buffer = rpc_gui->transmit_frame->content.gui_screen_frame.data->bytes;
+        furi_assert(size == rpc_gui->transmit_frame->content.gui_screen_frame.data->size);
+        memcpy(buffer, data, size);
+    }
     rpc_gui->transmit_frame->content.gui_screen_frame.orientation =
         rpc_system_gui_screen_orientation_map[orientation];
 
     furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagTransmit);
 }
 
+static void rpc_system_gui_screen_stream_frame_encode(RpcGuiSystem* rpc_gui) {
+    PB_Gui_ScreenFrame* frame = &rpc_gui->transmit_frame->content.gui_screen_frame;
+    size_t size = 0;
+    RpcGuiDeltaFrame type = rpc_gui_delta_encode(
+        rpc_gui->stream_delta, rpc_gui->stream_frame, frame->data->bytes, &size);
+    frame->data->size = size;
+    frame->encoding = (type == RpcGuiDeltaFrameKey) ? PB_Gui_ScreenFrameEncoding_KEYFRAME :
+                                                      PB_Gui_ScreenFrameEncoding_DELTA;
+}
+
 static int32_t rpc_system_gui_screen_stream_frame_transmit_thread(void* context) {
     furi_assert(context);
 
@@ -75,6 +95,9 @@ static int32_t rpc_system_gui_screen_stream_frame_transmit_thread(void* context)
 
         if(flags & RpcGuiWorkerFlagTransmit) {
             transmit_time = furi_get_tick();
+            if(rpc_gui->stream_delta) rpc_system_gui_screen_stream_frame_encode(rpc_gui);
+            rpc_gui->stream_frames++;
+            rpc_gui->stream_bytes += rpc_gui->transmit_frame->content.gui_screen_frame.data->size;
             rpc_send(rpc_gui->session, rpc_gui->transmit_frame);
             transmit_time = furi_get_tick() - transmit_time;
 
@@ -92,6 +115,35 @@ static int32_t rpc_system_gui_screen_stream_frame_transmit_thread(void* context)
     return 0;
 }
 
+static void rpc_system_gui_screen_stream_stop(RpcGuiSystem* rpc_gui) {
+    rpc_gui->is_streaming = false;
+    // Remove GUI framebuffer callback
+    gui_remove_framebuffer_callback(
+        rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, rpc_gui);
+    // Stop and release worker thread
+    furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagExit);
+    furi_thread_join(rpc_gui->transmit_thread);
+    furi_thread_free(rpc_gui->transmit_thread);
+    // Release frame
+    pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
+    free(rpc_gui->transmit_frame);
+    rpc_gui->transmit_frame = NULL;
+    if(rpc_gui->stream_delta) {
+        rpc_gui_delta_free(rpc_gui->stream_delta);
+        free(rpc_gui->stream_frame);
+        rpc_gui->stream_delta = NULL;
+        rpc_gui->stream_frame = NULL;
+    }
+
+    uint32_t duration = furi_get_tick() - rpc_gui->stream_start;
+    FURI_LOG_I(
+        TAG,
+        "Screen stream: %lu frames, %lu bytes per frame, %lu fps",
+        rpc_gui->stream_frames,
+        rpc_gui->stream_frames ? rpc_gui->stream_bytes / rpc_gui->stream_frames : 0,
+        duration ? rpc_gui->stream_frames * furi_kernel_get_tick_frequency() / duration : 0);
+}
+
 static void rpc_system_gui_start_screen_stream_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -109,14 +161,26 @@ static void rpc_system_gui_start_screen_stream_process(const PB_Main* request, v
         rpc_send_and_release_empty(session, request->command_id, PB_CommandStatus_OK);
 
         rpc_gui->is_streaming = true;
+        rpc_gui->stream_frames = 0;
+        rpc_gui->stream_bytes = 0;
+        rpc_gui->stream_start = furi_get_tick();
         size_t framebuffer_size = gui_get_framebuffer_size(rpc_gui->gui);
+        size_t data_size = framebuffer_size;
+        // Negotiated with StartScreenStreamRequest.delta, reported in ScreenFrame.encoding
+        if(request->content.gui_start_screen_stream_request.delta) {
+            rpc_gui->stream_frame = malloc(framebuffer_size);
+            rpc_gui->stream_delta = rpc_gui_delta_alloc(framebuffer_size);
+            data_size = RPC_GUI_DELTA_ENCODED_SIZE_MAX(framebuffer_size);
+        }
         // Reusable Frame
         rpc_gui->transmit_frame = malloc(sizeof(PB_Main));
         rpc_gui->transmit_frame->which_content = PB_Main_gui_screen_frame_tag;
         rpc_gui->transmit_frame->command_status = PB_CommandStatus_OK;
         rpc_gui->transmit_frame->content.gui_screen_frame.data =
-            malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(framebuffer_size));
+            malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(data_size));
         rpc_gui->transmit_frame->content.gui_screen_frame.data->size = framebuffer_size;
+        rpc_gui->transmit_frame->content.gui_screen_frame.encoding =
+            PB_Gui_ScreenFrameEncoding_RAW;
         // Transmission thread for async TX
         rpc_gui->transmit_thread = furi_thread_alloc_ex(
             "GuiRpcWorker", 1024, rpc_system_gui_screen_stream_frame_transmit_thread, rpc_gui);
@@ -138,18 +202,7 @@ static void rpc_system_gui_stop_screen_stream_process(const PB_Main* request, vo
     furi_assert(session);
 
     if(rpc_gui->is_streaming) {
-        rpc_gui->is_streaming = false;
-        // Remove GUI framebuffer callback
-        gui_remove_framebuffer_callback(
-            rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, context);
-        // Stop and release worker thread
-        furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagExit);
-        furi_thread_join(rpc_gui->transmit_thread);
-        furi_thread_free(rpc_gui->transmit_thread);
-        // Release frame
-        pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
-        free(rpc_gui->transmit_frame);
-        rpc_gui->transmit_frame = NULL;
+        rpc_system_gui_screen_stream_stop(rpc_gui);
     }
 
     rpc_send_and_release_empty(session, request->command_id, PB_CommandStatus_OK);
@@ -424,18 +477,7 @@ void rpc_system_gui_free(void* context) {
     view_port_free(rpc_gui->rpc_session_active_viewport);
 
     if(rpc_gui->is_streaming) {
-        rpc_gui->is_streaming = false;
-        // Remove GUI framebuffer callback
-        gui_remove_framebuffer_callback(
-            rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, context);
-        // Stop and release worker thread
-        furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagExit);
-        furi_thread_join(rpc_gui->transmit_thread);
-        furi_thread_free(rpc_gui->transmit_thread);
-        // Release frame
-        pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
-        free(rpc_gui->transmit_frame);
-        rpc_gui->transmit_frame = NULL;
+        rpc_system_gui_screen_stream_stop(rpc_gui);
     }
     furi_record_close(RECORD_GUI);
     free(rpc_gui);
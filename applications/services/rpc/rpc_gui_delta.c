@@ -0,0 +1,80 @@
+#include "rpc_gui_delta.h"
+
+#include <furi.h>
+#include <toolbox/compress.h>
+
+struct RpcGuiDelta {
+    Compress* compress;
+    size_t frame_size;
+    uint8_t* previous;
+    uint8_t* delta;
+    uint32_t frames_since_keyframe;
+    bool keyframe_pending;
+};
+
+RpcGuiDelta* rpc_gui_delta_alloc(size_t frame_size) {
+    furi_assert(frame_size);
+
+    RpcGuiDelta* delta = malloc(sizeof(RpcGuiDelta));
+    // Decoder is not used, keep its buffer minimal
+    delta->compress = compress_alloc(1);
+    delta->frame_size = frame_size;
+    delta->previous = malloc(frame_size);
+    delta->delta = malloc(frame_size);
+    delta->keyframe_pending = true;
+
+    return delta;
+}
+
+void rpc_gui_delta_free(RpcGuiDelta* delta) {
+    furi_assert(delta);
+
+    compress_free(delta->compress);
+    free(delta->previous);
+    free(delta->delta);
+    free(delta);
+}
+
+void rpc_gui_delta_reset(RpcGuiDelta* delta) {
+    furi_assert(delta);
+
+    delta->keyframe_pending = true;
+}
+
+RpcGuiDeltaFrame rpc_gui_delta_encode(
+    RpcGuiDelta* delta,
+    const uint8_t* frame,
+    uint8_t* out,
+    size_t* out_size) {
+    furi_assert(delta);
+    furi_assert(frame);
+    furi_assert(out);
+    furi_assert(out_size);
+
+    RpcGuiDeltaFrame type = RpcGuiDeltaFrameDelta;
+    uint8_t* data = delta->delta;
+    if(delta->keyframe_pending ||
+       delta->frames_since_keyframe >= RPC_GUI_DELTA_KEYFRAME_INTERVAL) {
+        type = RpcGuiDeltaFrameKey;
+        memcpy(delta->previous, frame, delta->frame_size);
+        data = delta->previous;
+        delta->keyframe_pending = false;
+        delta->frames_since_keyframe = 0;
+    } else {
+        for(size_t i = 0; i < delta->frame_size; i++) {
+            delta->delta[i] = frame[i] ^ delta->previous[i];
+            delta->previous[i] = frame[i];
+        }
+        delta->frames_since_keyframe++;
+    }
+
+    furi_check(compress_encode(
+        delta->compress,
+        data,
+        delta->frame_size,
+        out,
+        RPC_GUI_DELTA_ENCODED_SIZE_MAX(delta->frame_size),
+        out_size));
+
+    return type;
+}
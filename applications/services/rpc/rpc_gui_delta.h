@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Encoded frame never exceeds this size, heatshrink output may be larger than input */
+#define RPC_GUI_DELTA_ENCODED_SIZE_MAX(frame_size) ((frame_size)*2)
+
+/** Frames between keyframes */
+#define RPC_GUI_DELTA_KEYFRAME_INTERVAL (64)
+
+/** Screen frame delta encoder
+ *
+ * Frame is XORed with the previous one and compressed, so unchanged pixels
+ * cost almost nothing. Keyframe is the frame compressed as is. Output is in
+ * compress_encode() format and is decoded with compress_decode(), then XORed
+ * with the previous decoded frame unless it is a keyframe.
+ */
+typedef struct RpcGuiDelta RpcGuiDelta;
+
+typedef enum {
+    RpcGuiDeltaFrameKey,
+    RpcGuiDeltaFrameDelta,
+} RpcGuiDeltaFrame;
+
+/** Allocate RpcGuiDelta instance
+ *
+ * @param      frame_size  frame size in bytes
+ *
+ * @return     RpcGuiDelta instance
+ */
+RpcGuiDelta* rpc_gui_delta_alloc(size_t frame_size);
+
+/** Free RpcGuiDelta instance
+ *
+ * @param      delta  RpcGuiDelta instance
+ */
+void rpc_gui_delta_free(RpcGuiDelta* delta);
+
+/** Make next frame a keyframe
+ *
+ * @param      delta  RpcGuiDelta instance
+ */
+void rpc_gui_delta_reset(RpcGuiDelta* delta);
+
+/** Encode frame
+ *
+ * @param      delta     RpcGuiDelta instance
+ * @param      frame     frame to encode, frame_size bytes
+ * @param      out       output buffer, RPC_GUI_DELTA_ENCODED_SIZE_MAX bytes
+ * @param      out_size  pointer to store encoded size
+ *
+ * @return     encoded frame type
+ */
+RpcGuiDeltaFrame
+    rpc_gui_delta_encode(RpcGuiDelta* delta, const uint8_t* frame, uint8_t* out, size_t* out_size);
+
+#ifdef __cplusplus
+}
+#endif
@@ -7,6 +7,9 @@
 #include <flipper.pb.h>
 #include <cli/cli.h>
 
+/* Largest data chunk the client can request with Storage.ReadRequest.chunk_size */
+#define RPC_STORAGE_CHUNK_SIZE_MAX (4096)
+
 typedef void* (*RpcSystemAlloc)(RpcSession* session);
 typedef void (*RpcSystemFree)(void* context);
 typedef void (*PBMessageHandler)(const PB_Main* msg_request, void* context);
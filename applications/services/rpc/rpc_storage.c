@@ -19,6 +19,12 @@
 
 static const size_t MAX_DATA_SIZE = 512;
 
+/* Incoming write chunks are collected and written to card in blocks of this size */
+#define RPC_STORAGE_WRITE_CACHE_SIZE (4096)
+/* Chunks in flight during read: one being sent, one being read from card */
+#define RPC_STORAGE_READ_CHUNKS (2)
+#define RPC_STORAGE_READ_THREAD_STACK_SIZE (1024)
+
 typedef enum {
     RpcStorageStateIdle = 0,
     RpcStorageStateWriting,
@@ -339,6 +345,50 @@ static void rpc_system_storage_list_process(const PB_Main* request, void* contex
     furi_record_close(RECORD_STORAGE);
 }
 
+typedef struct {
+    File* file;
+    size_t chunk_size;
+    size_t size_left;
+    pb_bytes_array_t* chunks[RPC_STORAGE_READ_CHUNKS];
+    FuriMessageQueue* free_queue;
+    FuriMessageQueue* ready_queue;
+} RpcStorageReadAhead;
+
+/* Fills free chunks from file and passes them on, runs ahead of sending */
+static int32_t rpc_system_storage_read_ahead_worker(void* context) {
+    RpcStorageReadAhead* read_ahead = context;
+
+    size_t size_left = read_ahead->size_left;
+    while(true) {
+        pb_bytes_array_t* chunk = NULL;
+        furi_check(
+            furi_message_queue_get(read_ahead->free_queue, &chunk, FuriWaitForever) ==
+            FuriStatusOk);
+
+        size_t read_size = MIN(size_left, read_ahead->chunk_size);
+        chunk->size = read_size ? storage_file_read(read_ahead->file, chunk->bytes, read_size) : 0;
+        size_left -= chunk->size;
+        furi_check(
+            furi_message_queue_put(read_ahead->ready_queue, &chunk, FuriWaitForever) ==
+            FuriStatusOk);
+
+        if((chunk->size != read_size) || (size_left == 0)) break;
+    }
+
+    return 0;
+}
+
+static size_t rpc_system_storage_get_read_chunk_size(const PB_Main* request) {
+    size_t chunk_size = MAX_DATA_SIZE;
+    if(request->content.storage_read_request.chunk_size) {
+        chunk_size = CLAMP(
+            request->content.storage_read_request.chunk_size,
+            RPC_STORAGE_CHUNK_SIZE_MAX,
+            MAX_DATA_SIZE);
+    }
+    return chunk_size;
+}
+
 static void rpc_system_storage_read_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -360,38 +410,66 @@ static void rpc_system_storage_read_process(const PB_Main* request, void* contex
     bool fs_operation_success = storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING);
 
     if(fs_operation_success) {
-        size_t size_left = storage_file_size(file);
-        do {
-            response->command_id = request->command_id;
-            response->which_content = PB_Main_storage_read_response_tag;
-            response->command_status = PB_CommandStatus_OK;
+        RpcStorageReadAhead read_ahead = {
+            .file = file,
+            .chunk_size = rpc_system_storage_get_read_chunk_size(request),
+            .size_left = storage_file_size(file),
+            .free_queue =
+                furi_message_queue_alloc(RPC_STORAGE_READ_CHUNKS, sizeof(pb_bytes_array_t*)),
+            .ready_queue =
+                furi_message_queue_alloc(RPC_STORAGE_READ_CHUNKS, sizeof(pb_bytes_array_t*)),
+        };
+        for(size_t i = 0; i < RPC_STORAGE_READ_CHUNKS; i++) {
+            read_ahead.chunks[i] = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(read_ahead.chunk_size));
+            furi_message_queue_put(read_ahead.free_queue, &read_ahead.chunks[i], 0);
+        }
 
-            size_t read_size = MIN(size_left, MAX_DATA_SIZE);
-            if(read_size) {
-                response->content.storage_read_response.has_file = true;
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(read_size));
-                uint8_t* buffer = &response->content.storage_read_response.file.data->bytes[0];
-                uint16_t* read_size_msg = &response->content.storage_read_response.file.data->size;
+        /* file that fits into chunks in flight is read at once, no need for a thread */
+        FuriThread* thread = NULL;
+        if(read_ahead.size_left > read_ahead.chunk_size * RPC_STORAGE_READ_CHUNKS) {
+            thread = furi_thread_alloc_ex(
+                "RpcStorageRead",
+                RPC_STORAGE_READ_THREAD_STACK_SIZE,
+                rpc_system_storage_read_ahead_worker,
+                &read_ahead);
+            furi_thread_start(thread);
+        } else {
+            rpc_system_storage_read_ahead_worker(&read_ahead);
+        }
 
-                *read_size_msg = storage_file_read(file, buffer, read_size);
-                size_left -= *read_size_msg;
-                fs_operation_success = (*read_size_msg == read_size);
+        size_t size_left = read_ahead.size_left;
+        do {
+            pb_bytes_array_t* chunk = NULL;
+            furi_check(
+                furi_message_queue_get(read_ahead.ready_queue, &chunk, FuriWaitForever) ==
+                FuriStatusOk);
 
-                response->has_next = fs_operation_success && (size_left > 0);
-            } else {
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(0));
-                response->content.storage_read_response.file.data->size = 0;
-                response->content.storage_read_response.has_file = true;
-                response->has_next = false;
-                fs_operation_success = true;
-            }
+            size_t read_size = MIN(size_left, read_ahead.chunk_size);
+            size_left -= chunk->size;
+            fs_operation_success = (chunk->size == read_size);
 
             if(fs_operation_success) {
-                rpc_send_and_release(session, response);
+                response->command_id = request->command_id;
+                response->which_content = PB_Main_storage_read_response_tag;
+                response->command_status = PB_CommandStatus_OK;
+                response->content.storage_read_response.has_file = true;
+                response->content.storage_read_response.file.data = chunk;
+                response->has_next = (size_left > 0);
+                rpc_send(session, response);
             }
+
+            furi_message_queue_put(read_ahead.free_queue, &chunk, 0);
         } while((size_left != 0) && fs_operation_success);
+
+        if(thread) {
+            furi_thread_join(thread);
+            furi_thread_free(thread);
+        }
+        furi_message_queue_free(read_ahead.free_queue);
+        furi_message_queue_free(read_ahead.ready_queue);
+        for(size_t i = 0; i < RPC_STORAGE_READ_CHUNKS; i++) {
+            free(read_ahead.chunks[i]);
+        }
     }
 
     if(!fs_operation_success) {
@@ -437,6 +515,7 @@ static void rpc_system_storage_write_process(const PB_Main* request, void* conte
         rpc_storage->file = storage_file_alloc(rpc_storage->api);
         rpc_storage->current_command_id = request->command_id;
         rpc_storage->state = RpcStorageStateWriting;
+        storage_file_set_cache_size(rpc_storage->file, RPC_STORAGE_WRITE_CACHE_SIZE);
         const char* path = request->content.storage_write_request.path;
         fs_operation_success =
             storage_file_open(rpc_storage->file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS);
@@ -456,6 +535,10 @@ static void rpc_system_storage_write_process(const PB_Main* request, void* conte
         }
 
         send_response = !request->has_next;
+        if(send_response && fs_operation_success) {
+            /* collected data must reach the card before success is reported */
+            fs_operation_success = storage_file_sync(file);
+        }
     }
 
     PB_CommandStatus command_status = PB_CommandStatus_OK;
@@ -50,6 +50,12 @@ typedef struct {
     uint64_t size; /**< file size */
 } FileInfo;
 
+/** Buffer for vectored read and write */
+typedef struct {
+    void* buff; /**< pointer to data */
+    size_t size; /**< data size in bytes */
+} StorageIoVec;
+
 /** Gets the error text from FS_Error
  * @param error_id error id
  * @return const char* error text
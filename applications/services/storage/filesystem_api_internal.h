@@ -13,6 +13,9 @@ typedef enum {
     FileTypeOpenFile, /**< Open file */
 } FileType;
 
+/** Client side file cache, see storage_file_set_cache_size */
+typedef struct StorageFileCache StorageFileCache;
+
 /** Structure that hold file index and returned api errors */
 struct File {
     uint32_t file_id; /**< File ID for internal references */
@@ -20,6 +23,7 @@ struct File {
     FS_Error error_id; /**< Standard API error from FS_Error enum */
     int32_t internal_error_id; /**< Internal API error value */
     void* storage;
+    StorageFileCache* cache; /**< Client side cache, NULL if disabled */
 };
 
 /** File api structure
@@ -96,8 +100,8 @@ typedef struct {
         FS_AccessMode access_mode,
         FS_OpenMode open_mode);
     bool (*const close)(void* context, File* file);
-    uint16_t (*read)(void* context, File* file, void* buff, uint16_t bytes_to_read);
-    uint16_t (*write)(void* context, File* file, const void* buff, uint16_t bytes_to_write);
+    size_t (*read)(void* context, File* file, void* buff, size_t bytes_to_read);
+    size_t (*write)(void* context, File* file, const void* buff, size_t bytes_to_write);
     bool (*const seek)(void* context, File* file, uint32_t offset, bool from_start);
     uint64_t (*tell)(void* context, File* file);
     bool (*const truncate)(void* context, File* file);
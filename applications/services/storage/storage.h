@@ -148,6 +148,40 @@ bool storage_file_sync(File* file);
  */
 bool storage_file_eof(File* file);
 
+/** Reads bytes from a file into a buffer, without 64K limit
+ * Data is transferred in one storage request, sector aligned parts go directly to the card.
+ * @param file pointer to file object.
+ * @param buff pointer to a buffer, for reading
+ * @param bytes_to_read how many bytes to read. Must be less than or equal to the size of the buffer.
+ * @return size_t how many bytes were actually read
+ */
+size_t storage_file_read_large(File* file, void* buff, size_t bytes_to_read);
+
+/** Writes bytes from a buffer to a file, without 64K limit
+ * @param file pointer to file object.
+ * @param buff pointer to buffer, for writing
+ * @param bytes_to_write how many bytes to write. Must be less than or equal to the size of the buffer.
+ * @return size_t how many bytes were actually written
+ */
+size_t storage_file_write_large(File* file, const void* buff, size_t bytes_to_write);
+
+/** Reads bytes from a file into a list of buffers, in one storage request
+ * Buffers are filled in order, reading stops on the first short read.
+ * @param file pointer to file object.
+ * @param iov list of buffers
+ * @param iov_count number of buffers in the list
+ * @return size_t how many bytes were actually read
+ */
+size_t storage_file_readv(File* file, const StorageIoVec* iov, size_t iov_count);
+
+/** Writes bytes from a list of buffers to a file, in one storage request
+ * @param file pointer to file object.
+ * @param iov list of buffers
+ * @param iov_count number of buffers in the list
+ * @return size_t how many bytes were actually written
+ */
+size_t storage_file_writev(File* file, const StorageIoVec* iov, size_t iov_count);
+
 /**
  * @brief Check that file exists
  * 
@@ -168,6 +202,45 @@ bool storage_file_exists(Storage* storage, const char* path);
  */
 bool storage_file_copy_to_file(File* source, File* destination, uint32_t size);
 
+/** File cache statistics */
+typedef struct {
+    uint32_t read_calls; /**< storage_file_read calls */
+    uint32_t read_hits; /**< reads served from the cache without a storage request */
+    uint32_t write_calls; /**< storage_file_write calls */
+    uint32_t write_hits; /**< writes buffered without a storage request */
+    uint32_t requests; /**< requests sent to the storage thread */
+} StorageFileCacheStats;
+
+/**
+ * @brief Enable client side cache for the file
+ * Small reads are served from a read-ahead buffer and small writes are collected
+ * and written in one request. Pending data is written on seek, sync and close,
+ * write errors are reported by them. Cache expects that the file is not changed
+ * by other file objects while it is open.
+ * 
+ * @param file pointer to file object
+ * @param size cache size in bytes, 0 to disable the cache
+ */
+void storage_file_set_cache_size(File* file, uint16_t size);
+
+/**
+ * @brief Enable client side read-ahead cache for the file
+ * Same as storage_file_set_cache_size, but writes are never deferred: they go to
+ * storage at once and report errors as usual, so the cache is safe for any file.
+ * 
+ * @param file pointer to file object
+ * @param size cache size in bytes, 0 to disable the cache
+ */
+void storage_file_set_read_cache_size(File* file, uint16_t size);
+
+/**
+ * @brief Get file cache statistics, counters are reset on open
+ * 
+ * @param file pointer to file object
+ * @param stats pointer to statistics, zeroed if cache is disabled
+ */
+void storage_file_get_cache_stats(File* file, StorageFileCacheStats* stats);
+
 /******************* Dir Functions *******************/
 
 /** Opens a directory to get objects from it
@@ -3,12 +3,11 @@
 #include "storage.h"
 #include "storage_i.h"
 #include "storage_message.h"
-#include <toolbox/stream/file_stream.h>
 #include <toolbox/dir_walk.h>
 #include "toolbox/path.h"
 
 #define MAX_NAME_LENGTH 254
-#define FILE_BUFFER_SIZE 512
+#define FILE_BUFFER_SIZE (4U * 1024U)
 
 #define TAG "StorageAPI"
 
@@ -40,7 +39,7 @@
         }};
 
 #define S_RETURN_BOOL (return_data.bool_value);
-#define S_RETURN_UINT16 (return_data.uint16_value);
+#define S_RETURN_SIZE (return_data.size_value);
 #define S_RETURN_UINT64 (return_data.uint64_value);
 #define S_RETURN_ERROR (return_data.error_value);
 #define S_RETURN_CSTRING (return_data.cstring_value);
@@ -48,6 +47,33 @@
 typedef enum {
     StorageEventFlagFileClose = (1 << 0),
 } StorageEventFlag;
+
+typedef enum {
+    StorageFileCacheModeEmpty,
+    StorageFileCacheModeRead, /**< data holds read-ahead bytes */
+    StorageFileCacheModeWrite, /**< data holds bytes not yet written */
+} StorageFileCacheMode;
+
+struct StorageFileCache {
+    uint8_t* data;
+    uint16_t capacity;
+    uint16_t length;
+    uint16_t position; /**< read position in data */
+    StorageFileCacheMode mode;
+    bool write_behind; /**< collect writes, read-ahead only cache writes through */
+    bool offset_valid;
+    uint64_t offset; /**< r/w pointer position of the storage side file */
+    bool size_valid;
+    uint64_t size;
+    StorageFileCacheStats stats;
+};
+
+static void storage_file_cache_count_request(File* file) {
+    if(file->cache) {
+        file->cache->stats.requests++;
+    }
+}
+
 /****************** FILE ******************/
 
 static bool storage_file_open_internal(
@@ -57,6 +83,7 @@ static bool storage_file_open_internal(
     FS_OpenMode open_mode) {
     S_FILE_API_PROLOGUE;
     S_API_PROLOGUE;
+    storage_file_cache_count_request(file);
 
     SAData data = {
         .fopen = {
@@ -96,6 +123,17 @@ bool storage_file_open(
     FuriPubSubSubscription* subscription = furi_pubsub_subscribe(
         storage_get_pubsub(file->storage), storage_file_close_callback, event);
 
+    if(file->cache) {
+        StorageFileCache* cache = file->cache;
+        cache->mode = StorageFileCacheModeEmpty;
+        cache->length = 0;
+        cache->position = 0;
+        cache->offset_valid = (open_mode != FSOM_OPEN_APPEND);
+        cache->offset = 0;
+        cache->size_valid = false;
+        memset(&cache->stats, 0, sizeof(StorageFileCacheStats));
+    }
+
     do {
         result = storage_file_open_internal(file, path, access_mode, open_mode);
 
@@ -120,9 +158,10 @@ bool storage_file_open(
     return result;
 }
 
-bool storage_file_close(File* file) {
+static bool storage_file_close_internal(File* file) {
     S_FILE_API_PROLOGUE;
     S_API_PROLOGUE;
+    storage_file_cache_count_request(file);
 
     S_API_DATA_FILE;
     S_API_MESSAGE(StorageCommandFileClose);
@@ -138,13 +177,14 @@ bool storage_file_close(File* file) {
     return S_RETURN_BOOL;
 }
 
-uint16_t storage_file_read(File* file, void* buff, uint16_t bytes_to_read) {
+static size_t storage_file_read_internal(File* file, void* buff, size_t bytes_to_read) {
     if(bytes_to_read == 0) {
         return 0;
     }
 
     S_FILE_API_PROLOGUE;
     S_API_PROLOGUE;
+    storage_file_cache_count_request(file);
 
     SAData data = {
         .fread = {
@@ -155,16 +195,17 @@ uint16_t storage_file_read(File* file, void* buff, uint16_t bytes_to_read) {
 
     S_API_MESSAGE(StorageCommandFileRead);
     S_API_EPILOGUE;
-    return S_RETURN_UINT16;
+    return S_RETURN_SIZE;
 }
 
-uint16_t storage_file_write(File* file, const void* buff, uint16_t bytes_to_write) {
+static size_t storage_file_write_internal(File* file, const void* buff, size_t bytes_to_write) {
     if(bytes_to_write == 0) {
         return 0;
     }
 
     S_FILE_API_PROLOGUE;
     S_API_PROLOGUE;
+    storage_file_cache_count_request(file);
 
     SAData data = {
         .fwrite = {
@@ -175,12 +216,13 @@ uint16_t storage_file_write(File* file, const void* buff, uint16_t bytes_to_writ
 
     S_API_MESSAGE(StorageCommandFileWrite);
     S_API_EPILOGUE;
-    return S_RETURN_UINT16;
+    return S_RETURN_SIZE;
 }
 
-bool storage_file_seek(File* file, uint32_t offset, bool from_start) {
+static bool storage_file_seek_internal(File* file, uint32_t offset, bool from_start) {
     S_FILE_API_PROLOGUE;
     S_API_PROLOGUE;
+    storage_file_cache_count_request(file);
 
     SAData data = {
         .fseek = {
@@ -194,18 +236,20 @@ bool storage_file_seek(File* file, uint32_t offset, bool from_start) {
     return S_RETURN_BOOL;
 }
 
-uint64_t storage_file_tell(File* file) {
+static uint64_t storage_file_tell_internal(File* file) {
     S_FILE_API_PROLOGUE;
     S_API_PROLOGUE;
+    storage_file_cache_count_request(file);
     S_API_DATA_FILE;
     S_API_MESSAGE(StorageCommandFileTell);
     S_API_EPILOGUE;
     return S_RETURN_UINT64;
 }
 
-bool storage_file_expand(File* file, uint64_t size) {
+static bool storage_file_expand_internal(File* file, uint64_t size) {
     S_FILE_API_PROLOGUE;
     S_API_PROLOGUE;
+    storage_file_cache_count_request(file);
 
     SAData data = {
         .fexpand = {
@@ -218,42 +262,458 @@ bool storage_file_expand(File* file, uint64_t size) {
     return S_RETURN_BOOL;
 }
 
-bool storage_file_truncate(File* file) {
+static bool storage_file_truncate_internal(File* file) {
     S_FILE_API_PROLOGUE;
     S_API_PROLOGUE;
+    storage_file_cache_count_request(file);
     S_API_DATA_FILE;
     S_API_MESSAGE(StorageCommandFileTruncate);
     S_API_EPILOGUE;
     return S_RETURN_BOOL;
 }
 
-uint64_t storage_file_size(File* file) {
+static uint64_t storage_file_size_internal(File* file) {
     S_FILE_API_PROLOGUE;
     S_API_PROLOGUE;
+    storage_file_cache_count_request(file);
     S_API_DATA_FILE;
     S_API_MESSAGE(StorageCommandFileSize);
     S_API_EPILOGUE;
     return S_RETURN_UINT64;
 }
 
-bool storage_file_sync(File* file) {
+static bool storage_file_sync_internal(File* file) {
     S_FILE_API_PROLOGUE;
     S_API_PROLOGUE;
+    storage_file_cache_count_request(file);
     S_API_DATA_FILE;
     S_API_MESSAGE(StorageCommandFileSync);
     S_API_EPILOGUE;
     return S_RETURN_BOOL;
 }
 
-bool storage_file_eof(File* file) {
+static bool storage_file_eof_internal(File* file) {
     S_FILE_API_PROLOGUE;
     S_API_PROLOGUE;
+    storage_file_cache_count_request(file);
     S_API_DATA_FILE;
     S_API_MESSAGE(StorageCommandFileEof);
     S_API_EPILOGUE;
     return S_RETURN_BOOL;
 }
 
+static size_t
+    storage_file_readv_internal(File* file, const StorageIoVec* iov, size_t iov_count) {
+    if(iov_count == 0) {
+        return 0;
+    }
+
+    S_FILE_API_PROLOGUE;
+    S_API_PROLOGUE;
+    storage_file_cache_count_request(file);
+
+    SAData data = {
+        .fvector = {
+            .file = file,
+            .iov = iov,
+            .iov_count = iov_count,
+        }};
+
+    S_API_MESSAGE(StorageCommandFileReadv);
+    S_API_EPILOGUE;
+    return S_RETURN_SIZE;
+}
+
+static size_t
+    storage_file_writev_internal(File* file, const StorageIoVec* iov, size_t iov_count) {
+    if(iov_count == 0) {
+        return 0;
+    }
+
+    S_FILE_API_PROLOGUE;
+    S_API_PROLOGUE;
+    storage_file_cache_count_request(file);
+
+    SAData data = {
+        .fvector = {
+            .file = file,
+            .iov = iov,
+            .iov_count = iov_count,
+        }};
+
+    S_API_MESSAGE(StorageCommandFileWritev);
+    S_API_EPILOGUE;
+    return S_RETURN_SIZE;
+}
+
+/****************** FILE CACHE ******************/
+
+static uint64_t storage_file_cache_get_position(StorageFileCache* cache) {
+    furi_assert(cache->offset_valid);
+    if(cache->mode == StorageFileCacheModeRead) {
+        return cache->offset - cache->length + cache->position;
+    } else if(cache->mode == StorageFileCacheModeWrite) {
+        return cache->offset + cache->length;
+    } else {
+        return cache->offset;
+    }
+}
+
+static bool storage_file_cache_flush(File* file) {
+    StorageFileCache* cache = file->cache;
+    bool result = true;
+
+    if(cache->mode == StorageFileCacheModeWrite) {
+        uint16_t written = storage_file_write_internal(file, cache->data, cache->length);
+        cache->offset += written;
+        cache->size_valid = false;
+        result = (written == cache->length);
+
+        cache->mode = StorageFileCacheModeEmpty;
+        cache->length = 0;
+        cache->position = 0;
+    }
+
+    return result;
+}
+
+static bool storage_file_cache_unread(File* file) {
+    StorageFileCache* cache = file->cache;
+    bool result = true;
+
+    if(cache->mode == StorageFileCacheModeRead && cache->position < cache->length) {
+        // Move storage side r/w pointer back to the read position
+        if(!cache->offset_valid) {
+            cache->offset = storage_file_tell_internal(file);
+            cache->offset_valid = (file->error_id == FSE_OK);
+        }
+
+        if(cache->offset_valid) {
+            uint64_t position = storage_file_cache_get_position(cache);
+            result = storage_file_seek_internal(file, position, true);
+            cache->offset = position;
+            cache->offset_valid = result;
+        } else {
+            result = false;
+        }
+    }
+
+    cache->mode = StorageFileCacheModeEmpty;
+    cache->length = 0;
+    cache->position = 0;
+    return result;
+}
+
+static bool storage_file_cache_settle(File* file) {
+    if(file->cache->mode == StorageFileCacheModeWrite) {
+        return storage_file_cache_flush(file);
+    } else {
+        return storage_file_cache_unread(file);
+    }
+}
+
+static void storage_file_cache_set(File* file, uint16_t size, bool write_behind) {
+    if(file->cache) {
+        if(storage_file_is_open(file) && !storage_file_is_dir(file)) {
+            storage_file_cache_settle(file);
+        }
+        free(file->cache->data);
+        free(file->cache);
+        file->cache = NULL;
+    }
+
+    if(size) {
+        StorageFileCache* cache = malloc(sizeof(StorageFileCache));
+        cache->data = malloc(size);
+        cache->capacity = size;
+        cache->mode = StorageFileCacheModeEmpty;
+        cache->write_behind = write_behind;
+        // Position is unknown until the next open or tell
+        cache->offset_valid = false;
+        file->cache = cache;
+    }
+}
+
+void storage_file_set_cache_size(File* file, uint16_t size) {
+    furi_assert(file);
+    storage_file_cache_set(file, size, true);
+}
+
+void storage_file_set_read_cache_size(File* file, uint16_t size) {
+    furi_assert(file);
+    storage_file_cache_set(file, size, false);
+}
+
+void storage_file_get_cache_stats(File* file, StorageFileCacheStats* stats) {
+    furi_assert(file);
+    furi_assert(stats);
+
+    if(file->cache) {
+        *stats = file->cache->stats;
+    } else {
+        memset(stats, 0, sizeof(StorageFileCacheStats));
+    }
+}
+
+bool storage_file_close(File* file) {
+    bool result = true;
+
+    if(file->cache) {
+        result = storage_file_cache_flush(file);
+        file->cache->offset_valid = false;
+    }
+
+    return storage_file_close_internal(file) && result;
+}
+
+uint16_t storage_file_read(File* file, void* buff, uint16_t bytes_to_read) {
+    StorageFileCache* cache = file->cache;
+    if(!cache || bytes_to_read == 0) {
+        return storage_file_read_internal(file, buff, bytes_to_read);
+    }
+
+    cache->stats.read_calls++;
+    if(cache->mode == StorageFileCacheModeWrite) {
+        if(!storage_file_cache_flush(file)) return 0;
+    }
+
+    uint8_t* data = buff;
+    uint16_t was_read = 0;
+    bool refilled = false;
+
+    while(was_read < bytes_to_read) {
+        if(cache->mode == StorageFileCacheModeRead && cache->position < cache->length) {
+            uint16_t size = MIN(bytes_to_read - was_read, cache->length - cache->position);
+            memcpy(data + was_read, cache->data + cache->position, size);
+            cache->position += size;
+            was_read += size;
+            continue;
+        }
+
+        // Short read means end of file, do not ask again
+        if(refilled && cache->length < cache->capacity) break;
+
+        uint16_t need_to_read = bytes_to_read - was_read;
+        uint16_t size;
+        if(need_to_read >= cache->capacity) {
+            // Big reads go directly to the destination
+            cache->mode = StorageFileCacheModeEmpty;
+            size = storage_file_read_internal(file, data + was_read, need_to_read);
+            was_read += size;
+            cache->offset += size;
+            break;
+        }
+
+        size = storage_file_read_internal(file, cache->data, cache->capacity);
+        cache->mode = StorageFileCacheModeRead;
+        cache->length = size;
+        cache->position = 0;
+        cache->offset += size;
+        refilled = true;
+        if(size == 0) break;
+    }
+
+    if(!refilled && was_read == bytes_to_read) {
+        cache->stats.read_hits++;
+        file->error_id = FSE_OK;
+    }
+
+    return was_read;
+}
+
+uint16_t storage_file_write(File* file, const void* buff, uint16_t bytes_to_write) {
+    StorageFileCache* cache = file->cache;
+    if(!cache || bytes_to_write == 0) {
+        return storage_file_write_internal(file, buff, bytes_to_write);
+    }
+
+    cache->stats.write_calls++;
+    if(!cache->write_behind) {
+        if(!storage_file_cache_unread(file)) return 0;
+        uint16_t written = storage_file_write_internal(file, buff, bytes_to_write);
+        cache->offset += written;
+        cache->size_valid = false;
+        return written;
+    }
+
+    if(cache->mode != StorageFileCacheModeWrite) {
+        if(!storage_file_cache_unread(file)) return 0;
+        cache->mode = StorageFileCacheModeWrite;
+    }
+
+    if(cache->length + bytes_to_write <= cache->capacity) {
+        memcpy(cache->data + cache->length, buff, bytes_to_write);
+        cache->length += bytes_to_write;
+        cache->size_valid = false;
+        cache->stats.write_hits++;
+        file->error_id = FSE_OK;
+        return bytes_to_write;
+    }
+
+    if(!storage_file_cache_flush(file)) return 0;
+
+    if(bytes_to_write >= cache->capacity) {
+        uint16_t written = storage_file_write_internal(file, buff, bytes_to_write);
+        cache->offset += written;
+        return written;
+    }
+
+    cache->mode = StorageFileCacheModeWrite;
+    memcpy(cache->data, buff, bytes_to_write);
+    cache->length = bytes_to_write;
+    return bytes_to_write;
+}
+
+bool storage_file_seek(File* file, uint32_t offset, bool from_start) {
+    StorageFileCache* cache = file->cache;
+    if(!cache) {
+        return storage_file_seek_internal(file, offset, from_start);
+    }
+
+    // Resolve relative seek to absolute position
+    uint64_t position = offset;
+    if(!from_start) {
+        position += storage_file_tell(file);
+        if(file->error_id != FSE_OK) return false;
+    }
+
+    if(cache->offset_valid) {
+        if(position == storage_file_cache_get_position(cache)) {
+            file->error_id = FSE_OK;
+            return true;
+        }
+
+        // Seek inside of the read-ahead window
+        uint64_t window_start = cache->offset - cache->length;
+        if(cache->mode == StorageFileCacheModeRead && position >= window_start &&
+           position <= cache->offset) {
+            cache->position = position - window_start;
+            file->error_id = FSE_OK;
+            return true;
+        }
+    }
+
+    if(!storage_file_cache_flush(file)) return false;
+    cache->mode = StorageFileCacheModeEmpty;
+    cache->length = 0;
+    cache->position = 0;
+
+    // Storage may stop at end of file, so only trust a position within known size
+    bool result = storage_file_seek_internal(file, position, true);
+    cache->offset = position;
+    cache->offset_valid = result && cache->size_valid && position <= cache->size;
+    return result;
+}
+
+uint64_t storage_file_tell(File* file) {
+    StorageFileCache* cache = file->cache;
+    if(!cache) {
+        return storage_file_tell_internal(file);
+    }
+
+    if(!cache->offset_valid) {
+        cache->offset = storage_file_tell_internal(file);
+        if(file->error_id != FSE_OK) return 0;
+        cache->offset_valid = true;
+    }
+
+    file->error_id = FSE_OK;
+    return storage_file_cache_get_position(cache);
+}
+
+bool storage_file_expand(File* file, uint64_t size) {
+    if(file->cache) {
+        if(!storage_file_cache_settle(file)) return false;
+        file->cache->size_valid = false;
+    }
+    return storage_file_expand_internal(file, size);
+}
+
+bool storage_file_truncate(File* file) {
+    if(file->cache) {
+        if(!storage_file_cache_settle(file)) return false;
+        file->cache->size_valid = false;
+    }
+    return storage_file_truncate_internal(file);
+}
+
+uint64_t storage_file_size(File* file) {
+    StorageFileCache* cache = file->cache;
+    if(!cache) {
+        return storage_file_size_internal(file);
+    }
+
+    if(cache->mode == StorageFileCacheModeWrite) {
+        if(!storage_file_cache_flush(file)) return 0;
+    }
+
+    if(!cache->size_valid) {
+        cache->size = storage_file_size_internal(file);
+        if(file->error_id != FSE_OK) return 0;
+        cache->size_valid = true;
+    }
+
+    file->error_id = FSE_OK;
+    return cache->size;
+}
+
+bool storage_file_sync(File* file) {
+    if(file->cache) {
+        if(!storage_file_cache_flush(file)) return false;
+    }
+    return storage_file_sync_internal(file);
+}
+
+bool storage_file_eof(File* file) {
+    StorageFileCache* cache = file->cache;
+    if(cache) {
+        if(cache->mode == StorageFileCacheModeRead && cache->position < cache->length) {
+            file->error_id = FSE_OK;
+            return false;
+        }
+        if(!storage_file_cache_flush(file)) return false;
+    }
+    return storage_file_eof_internal(file);
+}
+
+size_t storage_file_read_large(File* file, void* buff, size_t bytes_to_read) {
+    StorageIoVec iov = {.buff = buff, .size = bytes_to_read};
+    return storage_file_readv(file, &iov, 1);
+}
+
+size_t storage_file_write_large(File* file, const void* buff, size_t bytes_to_write) {
+    StorageIoVec iov = {.buff = (void*)buff, .size = bytes_to_write};
+    return storage_file_writev(file, &iov, 1);
+}
+
+size_t storage_file_readv(File* file, const StorageIoVec* iov, size_t iov_count) {
+    StorageFileCache* cache = file->cache;
+
+    // Large transfers bypass the cache
+    if(cache && !storage_file_cache_settle(file)) return 0;
+
+    size_t was_read = storage_file_readv_internal(file, iov, iov_count);
+    if(cache) {
+        cache->offset += was_read;
+    }
+
+    return was_read;
+}
+
+size_t storage_file_writev(File* file, const StorageIoVec* iov, size_t iov_count) {
+    StorageFileCache* cache = file->cache;
+
+    if(cache && !storage_file_cache_settle(file)) return 0;
+
+    size_t was_written = storage_file_writev_internal(file, iov, iov_count);
+    if(cache) {
+        cache->offset += was_written;
+        cache->size_valid = false;
+    }
+
+    return was_written;
+}
+
 bool storage_file_exists(Storage* storage, const char* path) {
     bool exist = false;
     FileInfo fileinfo;
@@ -267,15 +727,17 @@ bool storage_file_exists(Storage* storage, const char* path) {
 }
 
 bool storage_file_copy_to_file(File* source, File* destination, uint32_t size) {
-    uint8_t* buffer = malloc(FILE_BUFFER_SIZE);
+    // Multi sector transfers, FatFs moves whole sectors without its window buffer
+    size_t buffer_size = MIN(size, FILE_BUFFER_SIZE);
+    uint8_t* buffer = malloc(MAX(buffer_size, 1U));
 
     while(size) {
-        uint32_t read_size = size > FILE_BUFFER_SIZE ? FILE_BUFFER_SIZE : size;
-        if(storage_file_read(source, buffer, read_size) != read_size) {
+        uint32_t read_size = MIN(size, buffer_size);
+        if(storage_file_read_large(source, buffer, read_size) != read_size) {
             break;
         }
 
-        if(storage_file_write(destination, buffer, read_size) != read_size) {
+        if(storage_file_write_large(destination, buffer, read_size) != read_size) {
             break;
         }
 
@@ -286,6 +748,28 @@ bool storage_file_copy_to_file(File* source, File* destination, uint32_t size) {
     return size == 0;
 }
 
+static FS_Error
+    storage_file_copy_path(Storage* storage, const char* old_path, const char* new_path) {
+    FS_Error error;
+    File* file_from = storage_file_alloc(storage);
+    File* file_to = storage_file_alloc(storage);
+
+    do {
+        if(!storage_file_open(file_from, old_path, FSAM_READ, FSOM_OPEN_EXISTING)) break;
+        if(!storage_file_open(file_to, new_path, FSAM_WRITE, FSOM_CREATE_NEW)) break;
+        storage_file_copy_to_file(file_from, file_to, storage_file_size(file_from));
+    } while(false);
+
+    error = storage_file_get_error(file_from);
+    if(error == FSE_OK) {
+        error = storage_file_get_error(file_to);
+    }
+
+    storage_file_free(file_from);
+    storage_file_free(file_to);
+    return error;
+}
+
 /****************** DIR ******************/
 
 static bool storage_dir_open_internal(File* file, const char* path) {
@@ -586,22 +1070,7 @@ FS_Error storage_common_copy(Storage* storage, const char* old_path, const char*
         if(file_info_is_dir(&fileinfo)) {
             error = storage_copy_recursive(storage, old_path, new_path);
         } else {
-            Stream* stream_from = file_stream_alloc(storage);
-            Stream* stream_to = file_stream_alloc(storage);
-
-            do {
-                if(!file_stream_open(stream_from, old_path, FSAM_READ, FSOM_OPEN_EXISTING)) break;
-                if(!file_stream_open(stream_to, new_path, FSAM_WRITE, FSOM_CREATE_NEW)) break;
-                stream_copy_full(stream_from, stream_to);
-            } while(false);
-
-            error = file_stream_get_error(stream_from);
-            if(error == FSE_OK) {
-                error = file_stream_get_error(stream_to);
-            }
-
-            stream_free(stream_from);
-            stream_free(stream_to);
+            error = storage_file_copy_path(storage, old_path, new_path);
         }
     }
 
@@ -726,24 +1195,7 @@ static FS_Error
                 new_path_tmp = new_path;
             }
             if(copy) {
-                Stream* stream_from = file_stream_alloc(storage);
-                Stream* stream_to = file_stream_alloc(storage);
-
-                do {
-                    if(!file_stream_open(stream_from, old_path, FSAM_READ, FSOM_OPEN_EXISTING))
-                        break;
-                    if(!file_stream_open(stream_to, new_path_tmp, FSAM_WRITE, FSOM_CREATE_NEW))
-                        break;
-                    stream_copy_full(stream_from, stream_to);
-                } while(false);
-
-                error = file_stream_get_error(stream_from);
-                if(error == FSE_OK) {
-                    error = file_stream_get_error(stream_to);
-                }
-
-                stream_free(stream_from);
-                stream_free(stream_to);
+                error = storage_file_copy_path(storage, old_path, new_path_tmp);
             } else {
                 error = storage_common_rename(storage, old_path, new_path_tmp);
             }
@@ -904,11 +1356,17 @@ void storage_file_free(File* file) {
     if(storage_file_is_open(file)) {
         if(storage_file_is_dir(file)) {
             storage_dir_close(file);
-        } else {
-            storage_file_close(file);
+        } else if(!storage_file_close(file) && file->cache && file->cache->write_behind) {
+            // Caller didn't close the file, deferred write error would be lost otherwise
+            FURI_LOG_E(TAG, "File %p: cached data not written", (void*)file);
         }
     }
 
+    if(file->cache) {
+        free(file->cache->data);
+        free(file->cache);
+    }
+
     FURI_LOG_T(TAG, "File/Dir %p free", (void*)((uint32_t)file - SRAM_BASE));
     free(file);
 }
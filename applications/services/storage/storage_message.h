@@ -17,15 +17,21 @@ typedef struct {
 typedef struct {
     File* file;
     void* buff;
-    uint16_t bytes_to_read;
+    size_t bytes_to_read;
 } SADataFRead;
 
 typedef struct {
     File* file;
     const void* buff;
-    uint16_t bytes_to_write;
+    size_t bytes_to_write;
 } SADataFWrite;
 
+typedef struct {
+    File* file;
+    const StorageIoVec* iov;
+    size_t iov_count;
+} SADataFVector;
+
 typedef struct {
     File* file;
     uint32_t offset;
@@ -101,6 +107,7 @@ typedef union {
     SADataFOpen fopen;
     SADataFRead fread;
     SADataFWrite fwrite;
+    SADataFVector fvector;
     SADataFSeek fseek;
     SADataFExpand fexpand;
 
@@ -123,7 +130,7 @@ typedef union {
 
 typedef union {
     bool bool_value;
-    uint16_t uint16_value;
+    size_t size_value;
     uint64_t uint64_value;
     FS_Error error_value;
     const char* cstring_value;
@@ -157,6 +164,8 @@ typedef enum {
 
     StorageCommandFileExpand,
     StorageCommandCommonRename,
+    StorageCommandFileReadv,
+    StorageCommandFileWritev,
 } StorageCommand;
 
 typedef struct {
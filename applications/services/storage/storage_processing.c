@@ -144,9 +144,9 @@ bool storage_process_file_close(Storage* app, File* file) {
     return ret;
 }
 
-static uint16_t
-    storage_process_file_read(Storage* app, File* file, void* buff, uint16_t const bytes_to_read) {
-    uint16_t ret = 0;
+static size_t
+    storage_process_file_read(Storage* app, File* file, void* buff, size_t const bytes_to_read) {
+    size_t ret = 0;
     StorageData* storage = get_storage_by_file(file, app->storage);
 
     if(storage == NULL) {
@@ -158,12 +158,12 @@ static uint16_t
     return ret;
 }
 
-static uint16_t storage_process_file_write(
+static size_t storage_process_file_write(
     Storage* app,
     File* file,
     const void* buff,
-    uint16_t const bytes_to_write) {
-    uint16_t ret = 0;
+    size_t const bytes_to_write) {
+    size_t ret = 0;
     StorageData* storage = get_storage_by_file(file, app->storage);
 
     if(storage == NULL) {
@@ -176,6 +176,51 @@ static uint16_t storage_process_file_write(
     return ret;
 }
 
+static size_t storage_process_file_readv(
+    Storage* app,
+    File* file,
+    const StorageIoVec* iov,
+    size_t const iov_count) {
+    size_t ret = 0;
+    size_t total = 0;
+    StorageData* storage = get_storage_by_file(file, app->storage);
+
+    if(storage == NULL) {
+        file->error_id = FSE_INVALID_PARAMETER;
+    } else {
+        for(size_t i = 0; i < iov_count; i++) {
+            FS_CALL(storage, file.read(storage, file, iov[i].buff, iov[i].size));
+            total += ret;
+            if(ret != iov[i].size) break;
+        }
+    }
+
+    return total;
+}
+
+static size_t storage_process_file_writev(
+    Storage* app,
+    File* file,
+    const StorageIoVec* iov,
+    size_t const iov_count) {
+    size_t ret = 0;
+    size_t total = 0;
+    StorageData* storage = get_storage_by_file(file, app->storage);
+
+    if(storage == NULL) {
+        file->error_id = FSE_INVALID_PARAMETER;
+    } else {
+        storage_data_timestamp(storage);
+        for(size_t i = 0; i < iov_count; i++) {
+            FS_CALL(storage, file.write(storage, file, iov[i].buff, iov[i].size));
+            total += ret;
+            if(ret != iov[i].size) break;
+        }
+    }
+
+    return total;
+}
+
 static bool storage_process_file_seek(
     Storage* app,
     File* file,
@@ -564,19 +609,33 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
             storage_process_file_close(app, message->data->fopen.file);
         break;
     case StorageCommandFileRead:
-        message->return_data->uint16_value = storage_process_file_read(
+        message->return_data->size_value = storage_process_file_read(
             app,
             message->data->fread.file,
             message->data->fread.buff,
             message->data->fread.bytes_to_read);
         break;
     case StorageCommandFileWrite:
-        message->return_data->uint16_value = storage_process_file_write(
+        message->return_data->size_value = storage_process_file_write(
             app,
             message->data->fwrite.file,
             message->data->fwrite.buff,
             message->data->fwrite.bytes_to_write);
         break;
+    case StorageCommandFileReadv:
+        message->return_data->size_value = storage_process_file_readv(
+            app,
+            message->data->fvector.file,
+            message->data->fvector.iov,
+            message->data->fvector.iov_count);
+        break;
+    case StorageCommandFileWritev:
+        message->return_data->size_value = storage_process_file_writev(
+            app,
+            message->data->fvector.file,
+            message->data->fvector.iov,
+            message->data->fvector.iov_count);
+        break;
     case StorageCommandFileSeek:
         message->return_data->bool_value = storage_process_file_seek(
             app,
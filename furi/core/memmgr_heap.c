@@ -62,6 +62,13 @@ task.h is included from an application file. */
 /* Assumes 8bit bytes! */
 #define heapBITS_PER_BYTE ((size_t)8)
 
+/* Freed blocks with up to this many data bytes are kept in per size lists
+for O(1) reuse instead of going back to the address ordered free list. */
+#define heapSMALL_BLOCK_MAX_DATA_SIZE ((size_t)64)
+#define heapSMALL_BLOCK_CLASS_COUNT (heapSMALL_BLOCK_MAX_DATA_SIZE / portBYTE_ALIGNMENT)
+/* Limit memory held by small block lists, they do not coalesce. */
+#define heapSMALL_BLOCK_CLASS_CAPACITY ((size_t)16)
+
 /* Heap start end symbols provided by linker */
 extern const void __heap_start__;
 extern const void __heap_end__;
@@ -90,6 +97,17 @@ static void prvInsertBlockIntoFreeList(BlockLink_t* pxBlockToInsert);
  */
 static void prvHeapInit(void);
 
+/*
+ * Return the tail of an allocated block to the free list if it is big enough
+ * to make a block of its own.
+ */
+static void prvTrimAllocatedBlock(BlockLink_t* pxBlock, size_t xWantedSize);
+
+/*
+ * Move all cached small blocks back into the free list so they can coalesce.
+ */
+static void prvFlushSmallBlocks(void);
+
 /*-----------------------------------------------------------*/
 
 /* The size of the structure placed at the beginning of each allocated memory
@@ -111,6 +129,22 @@ application.  When the bit is free the block is still part of the free heap
 space. */
 static size_t xBlockAllocatedBit = 0;
 
+/* Small block lists, indexed by data size in portBYTE_ALIGNMENT steps. Blocks
+in the lists are free (allocated bit is clear) and counted in
+xFreeBytesRemaining, but are not part of the address ordered free list. */
+static BlockLink_t* pxSmallBlocks[heapSMALL_BLOCK_CLASS_COUNT] = {0};
+static size_t xSmallBlocksCount[heapSMALL_BLOCK_CLASS_COUNT] = {0};
+
+/* Allocator statistics, reported by memmgr_heap_printf_free_blocks */
+static struct {
+    uint32_t alloc_count;
+    uint32_t alloc_small_count;
+    uint64_t alloc_cycles;
+    uint32_t alloc_cycles_max;
+    uint32_t realloc_in_place_count;
+    uint32_t realloc_move_count;
+} memmgr_heap_stats = {0};
+
 /* Furi heap extension */
 #include <m-dict.h>
 
@@ -238,15 +272,48 @@ size_t memmgr_heap_get_max_free_block() {
 
 void memmgr_heap_printf_free_blocks() {
     BlockLink_t* pxBlock;
+    size_t free_blocks = 0;
+    size_t free_size = 0;
+    size_t max_free_size = 0;
     //TODO enable when we can do printf with a locked scheduler
     //vTaskSuspendAll();
 
     pxBlock = xStart.pxNextFreeBlock;
     while(pxBlock->pxNextFreeBlock != NULL) {
         printf("A %p S %lu\r\n", (void*)pxBlock, (uint32_t)pxBlock->xBlockSize);
+        free_blocks++;
+        free_size += pxBlock->xBlockSize;
+        max_free_size = MAX(max_free_size, pxBlock->xBlockSize);
         pxBlock = pxBlock->pxNextFreeBlock;
     }
 
+    // Fragmentation: share of free memory that is not in the biggest block
+    printf(
+        "Free blocks %u, free %u, max %u, fragmentation %u%%\r\n",
+        free_blocks,
+        free_size,
+        max_free_size,
+        free_size ? 100 - (max_free_size * 100 / free_size) : 0);
+
+    printf("Small blocks cached:");
+    for(size_t i = 0; i < heapSMALL_BLOCK_CLASS_COUNT; i++) {
+        printf(" %u:%u", (i + 1) * portBYTE_ALIGNMENT, xSmallBlocksCount[i]);
+    }
+    printf("\r\n");
+
+    printf(
+        "Allocs %lu, small %lu, cycles avg %lu max %lu\r\n",
+        memmgr_heap_stats.alloc_count,
+        memmgr_heap_stats.alloc_small_count,
+        memmgr_heap_stats.alloc_count ?
+            (uint32_t)(memmgr_heap_stats.alloc_cycles / memmgr_heap_stats.alloc_count) :
+            0,
+        memmgr_heap_stats.alloc_cycles_max);
+    printf(
+        "Realloc in place %lu, moved %lu\r\n",
+        memmgr_heap_stats.realloc_in_place_count,
+        memmgr_heap_stats.realloc_move_count);
+
     //xTaskResumeAll();
 }
 
@@ -339,7 +406,8 @@ static void print_heap_free(void* ptr) {
 void* pvPortMalloc(size_t xWantedSize) {
     BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
     void* pvReturn = NULL;
-    size_t to_wipe = xWantedSize;
+    size_t to_wipe = 0;
+    uint32_t cycles = DWT->CYCCNT;
 
     if(FURI_IS_IRQ_MODE()) {
         furi_crash("memmgt in ISR");
@@ -391,7 +459,27 @@ void* pvPortMalloc(size_t xWantedSize) {
                 mtCOVERAGE_TEST_MARKER();
             }
 
-            if((xWantedSize > 0) && (xWantedSize <= xFreeBytesRemaining)) {
+            size_t xSmallClass = (xWantedSize - xHeapStructSize) / portBYTE_ALIGNMENT - 1;
+            if((xWantedSize > 0) && (xWantedSize <= xFreeBytesRemaining) &&
+               (xSmallClass < heapSMALL_BLOCK_CLASS_COUNT) && (pxSmallBlocks[xSmallClass])) {
+                /* Fast path: exact fit from the small block list. */
+                pxBlock = pxSmallBlocks[xSmallClass];
+                pxSmallBlocks[xSmallClass] = pxBlock->pxNextFreeBlock;
+                xSmallBlocksCount[xSmallClass]--;
+
+                pvReturn = (void*)(((uint8_t*)pxBlock) + xHeapStructSize);
+                xFreeBytesRemaining -= pxBlock->xBlockSize;
+                if(xFreeBytesRemaining < xMinimumEverFreeBytesRemaining) {
+                    xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                }
+
+                pxBlock->xBlockSize |= xBlockAllocatedBit;
+                pxBlock->pxNextFreeBlock = NULL;
+                memmgr_heap_stats.alloc_small_count++;
+#ifdef HEAP_PRINT_DEBUG
+                print_heap_block = pxBlock;
+#endif
+            } else if((xWantedSize > 0) && (xWantedSize <= xFreeBytesRemaining)) {
                 /* Traverse the list from the start (lowest address) block until
                 one of adequate size is found. */
                 pxPreviousBlock = &xStart;
@@ -401,6 +489,19 @@ void* pvPortMalloc(size_t xWantedSize) {
                     pxBlock = pxBlock->pxNextFreeBlock;
                 }
 
+                /* Cached small blocks may be what is missing for a big enough
+                block, give them back and try again. */
+                if(pxBlock == pxEnd) {
+                    prvFlushSmallBlocks();
+                    pxPreviousBlock = &xStart;
+                    pxBlock = xStart.pxNextFreeBlock;
+                    while((pxBlock->xBlockSize < xWantedSize) &&
+                          (pxBlock->pxNextFreeBlock != NULL)) {
+                        pxPreviousBlock = pxBlock;
+                        pxBlock = pxBlock->pxNextFreeBlock;
+                    }
+                }
+
                 /* If the end marker was reached then a block of adequate size
                 was not found. */
                 if(pxBlock != pxEnd) {
@@ -461,6 +562,19 @@ void* pvPortMalloc(size_t xWantedSize) {
         }
 
         traceMALLOC(pvReturn, xWantedSize);
+
+        if(pvReturn) {
+            /* Wipe the whole block, not only the requested size, so growing
+            it in place never exposes stale data. */
+            to_wipe = (pxBlock->xBlockSize & ~xBlockAllocatedBit) - xHeapStructSize;
+        }
+
+        cycles = DWT->CYCCNT - cycles;
+        memmgr_heap_stats.alloc_count++;
+        memmgr_heap_stats.alloc_cycles += cycles;
+        if(cycles > memmgr_heap_stats.alloc_cycles_max) {
+            memmgr_heap_stats.alloc_cycles_max = cycles;
+        }
     }
     (void)xTaskResumeAll();
 
@@ -528,7 +642,17 @@ void vPortFree(void* pv) {
                     xFreeBytesRemaining += pxLink->xBlockSize;
                     traceFREE(pv, pxLink->xBlockSize);
                     memset(pv, 0, pxLink->xBlockSize - xHeapStructSize);
-                    prvInsertBlockIntoFreeList(((BlockLink_t*)pxLink));
+
+                    size_t xSmallClass =
+                        (pxLink->xBlockSize - xHeapStructSize) / portBYTE_ALIGNMENT - 1;
+                    if((xSmallClass < heapSMALL_BLOCK_CLASS_COUNT) &&
+                       (xSmallBlocksCount[xSmallClass] < heapSMALL_BLOCK_CLASS_CAPACITY)) {
+                        pxLink->pxNextFreeBlock = pxSmallBlocks[xSmallClass];
+                        pxSmallBlocks[xSmallClass] = pxLink;
+                        xSmallBlocksCount[xSmallClass]++;
+                    } else {
+                        prvInsertBlockIntoFreeList(((BlockLink_t*)pxLink));
+                    }
                 }
                 (void)xTaskResumeAll();
             } else {
@@ -545,6 +669,102 @@ void vPortFree(void* pv) {
 }
 /*-----------------------------------------------------------*/
 
+void* pvPortRealloc(void* pv, size_t xWantedSize) {
+    BlockLink_t* pxLink;
+    size_t xOldDataSize, xNewDataSize;
+    size_t xBlockSize = xWantedSize;
+    bool in_place = false;
+
+    if(FURI_IS_IRQ_MODE()) {
+        furi_crash("memmgt in ISR");
+    }
+
+    if(pv == NULL) {
+        return pvPortMalloc(xWantedSize);
+    }
+
+    if(xWantedSize == 0) {
+        vPortFree(pv);
+        return NULL;
+    }
+
+    pxLink = (void*)(((uint8_t*)pv) - xHeapStructSize);
+    configASSERT((pxLink->xBlockSize & xBlockAllocatedBit) != 0);
+    configASSERT(pxLink->pxNextFreeBlock == NULL);
+    furi_check((pxLink->xBlockSize & xBlockAllocatedBit) != 0);
+
+    /* Same size math as in pvPortMalloc */
+    xBlockSize += xHeapStructSize;
+    if((xBlockSize & portBYTE_ALIGNMENT_MASK) != 0x00) {
+        xBlockSize += (portBYTE_ALIGNMENT - (xBlockSize & portBYTE_ALIGNMENT_MASK));
+    }
+
+    vTaskSuspendAll();
+    {
+        size_t xCurrentSize = pxLink->xBlockSize & ~xBlockAllocatedBit;
+        xOldDataSize = xCurrentSize - xHeapStructSize;
+
+        if((xWantedSize & xBlockAllocatedBit) != 0 || xBlockSize < xWantedSize) {
+            /* Too big, let pvPortMalloc deal with it */
+        } else if(xBlockSize <= xCurrentSize) {
+            prvTrimAllocatedBlock(pxLink, xBlockSize);
+            in_place = true;
+        } else {
+            /* Find the free block right after this one, the list is address ordered */
+            BlockLink_t* pxPreviousBlock = &xStart;
+            BlockLink_t* pxBlock = xStart.pxNextFreeBlock;
+            BlockLink_t* pxFollowing = (void*)(((uint8_t*)pxLink) + xCurrentSize);
+            while(pxBlock < pxFollowing) {
+                pxPreviousBlock = pxBlock;
+                pxBlock = pxBlock->pxNextFreeBlock;
+            }
+
+            if((pxBlock == pxFollowing) && (pxBlock != pxEnd) &&
+               (xCurrentSize + pxBlock->xBlockSize >= xBlockSize)) {
+                /* Absorb the following free block and return what is left of it */
+                pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+                xFreeBytesRemaining -= pxBlock->xBlockSize;
+                pxLink->xBlockSize = (xCurrentSize + pxBlock->xBlockSize) | xBlockAllocatedBit;
+                prvTrimAllocatedBlock(pxLink, xBlockSize);
+
+                if(xFreeBytesRemaining < xMinimumEverFreeBytesRemaining) {
+                    xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                }
+                in_place = true;
+            }
+        }
+
+        if(in_place) {
+            traceFREE(pv, xCurrentSize);
+            traceMALLOC(pv, pxLink->xBlockSize & ~xBlockAllocatedBit);
+            memmgr_heap_stats.realloc_in_place_count++;
+        } else {
+            memmgr_heap_stats.realloc_move_count++;
+        }
+        xNewDataSize = (pxLink->xBlockSize & ~xBlockAllocatedBit) - xHeapStructSize;
+    }
+    (void)xTaskResumeAll();
+
+    if(in_place) {
+#ifdef HEAP_PRINT_DEBUG
+        print_heap_free(pxLink);
+        print_heap_malloc(pxLink, xNewDataSize + xHeapStructSize);
+#endif
+        /* Absorbed memory may hold a block header and stale data */
+        if(xNewDataSize > xOldDataSize) {
+            memset(((uint8_t*)pv) + xOldDataSize, 0, xNewDataSize - xOldDataSize);
+        }
+        return pv;
+    }
+
+    void* pvReturn = pvPortMalloc(xWantedSize);
+    memcpy(pvReturn, pv, MIN(xOldDataSize, xWantedSize));
+    vPortFree(pv);
+
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
 size_t xPortGetTotalHeapSize(void) {
     return (size_t)&__heap_end__ - (size_t)&__heap_start__;
 }
@@ -657,3 +877,39 @@ static void prvInsertBlockIntoFreeList(BlockLink_t* pxBlockToInsert) {
         mtCOVERAGE_TEST_MARKER();
     }
 }
+/*-----------------------------------------------------------*/
+
+static void prvTrimAllocatedBlock(BlockLink_t* pxBlock, size_t xWantedSize) {
+    BlockLink_t* pxNewBlockLink;
+    size_t xCurrentSize = pxBlock->xBlockSize & ~xBlockAllocatedBit;
+
+    if((xCurrentSize - xWantedSize) > heapMINIMUM_BLOCK_SIZE) {
+        pxNewBlockLink = (void*)(((uint8_t*)pxBlock) + xWantedSize);
+        configASSERT((((size_t)pxNewBlockLink) & portBYTE_ALIGNMENT_MASK) == 0);
+
+        pxNewBlockLink->xBlockSize = xCurrentSize - xWantedSize;
+        pxBlock->xBlockSize = xWantedSize | xBlockAllocatedBit;
+
+        /* Free memory is kept wiped, same as in vPortFree */
+        memset(
+            ((uint8_t*)pxNewBlockLink) + xHeapStructSize,
+            0,
+            pxNewBlockLink->xBlockSize - xHeapStructSize);
+        xFreeBytesRemaining += pxNewBlockLink->xBlockSize;
+        prvInsertBlockIntoFreeList(pxNewBlockLink);
+    } else {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvFlushSmallBlocks(void) {
+    for(size_t i = 0; i < heapSMALL_BLOCK_CLASS_COUNT; i++) {
+        while(pxSmallBlocks[i]) {
+            BlockLink_t* pxBlock = pxSmallBlocks[i];
+            pxSmallBlocks[i] = pxBlock->pxNextFreeBlock;
+            prvInsertBlockIntoFreeList(pxBlock);
+        }
+        xSmallBlocksCount[i] = 0;
+    }
+}
@@ -32,6 +32,31 @@ bool elf_resolve_from_hashtable(
     return result;
 }
 
+bool elf_resolve_from_perfect_hashtable(
+    const ElfApiInterface* interface,
+    uint32_t hash,
+    Elf32_Addr* address) {
+    const PerfectHashtableApiInterface* hashtable_interface =
+        static_cast<const PerfectHashtableApiInterface*>(interface);
+
+    if(!hashtable_interface->table_size) {
+        return false;
+    }
+
+    const uint32_t bucket = sym_perfect_hash_bucket(hash, hashtable_interface->seed_count);
+    const uint32_t slot = sym_perfect_hash_slot(
+        hash, hashtable_interface->seeds[bucket], hashtable_interface->table_size);
+    const sym_entry* entry = &hashtable_interface->table[slot];
+
+    if(entry->hash != hash) {
+        FURI_LOG_W(TAG, "Can't find symbol with hash %lx @ %p!", hash, hashtable_interface->table);
+        return false;
+    }
+
+    *address = entry->address;
+    return true;
+}
+
 uint32_t elf_symbolname_hash(const char* s) {
     return elf_gnu_hash(s);
 }
\ No newline at end of file
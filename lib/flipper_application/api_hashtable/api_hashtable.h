@@ -28,6 +28,18 @@ bool elf_resolve_from_hashtable(
     uint32_t hash,
     Elf32_Addr* address);
 
+/**
+ * @brief Resolver for API entries using a compile-time minimal perfect hash table
+ * @param interface pointer to PerfectHashtableApiInterface
+ * @param hash gnu hash of function name
+ * @param address output for function address
+ * @return true if the table contains a function
+ */
+bool elf_resolve_from_perfect_hashtable(
+    const ElfApiInterface* interface,
+    uint32_t hash,
+    Elf32_Addr* address);
+
 uint32_t elf_symbolname_hash(const char* s);
 
 #ifdef __cplusplus
@@ -45,6 +57,18 @@ struct HashtableApiInterface : public ElfApiInterface {
     const sym_entry *table_cbegin, *table_cend;
 };
 
+/**
+ * @brief  PerfectHashtableApiInterface is an implementation of ElfApiInterface
+ * that uses a minimal perfect hash table to resolve function addresses.
+ * seeds and table must come from perfect_hash_build
+ */
+struct PerfectHashtableApiInterface : public ElfApiInterface {
+    const uint16_t* seeds;
+    uint32_t seed_count;
+    const sym_entry* table;
+    uint32_t table_size;
+};
+
 #define API_METHOD(x, ret_type, args_type)                                                     \
     sym_entry {                                                                                \
         .hash = elf_gnu_hash(#x), .address = (uint32_t)(static_cast<ret_type(*) args_type>(x)) \
@@ -86,4 +110,121 @@ constexpr bool has_hash_collisions(const std::array<sym_entry, N>& api_methods)
     return false;
 }
 
+/**
+ * @brief Mix symbol hash with a seed for perfect hash bucket and slot selection
+ * @param hash gnu hash of symbol name
+ * @param seed seed value, 0 is used for bucket selection
+ * @return mixed hash value
+ */
+constexpr uint32_t sym_perfect_hash_mix(uint32_t hash, uint32_t seed) {
+    uint32_t h = hash ^ (seed * 0x9E3779B9UL);
+    h ^= h >> 16;
+    h *= 0x85EBCA6BUL;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35UL;
+    h ^= h >> 16;
+    return h;
+}
+
+constexpr uint32_t sym_perfect_hash_bucket(uint32_t hash, uint32_t seed_count) {
+    return sym_perfect_hash_mix(hash, 0) % seed_count;
+}
+
+constexpr uint32_t sym_perfect_hash_slot(uint32_t hash, uint16_t seed, uint32_t table_size) {
+    return sym_perfect_hash_mix(hash, (uint32_t)seed + 1) % table_size;
+}
+
+/**
+ * @brief Minimal perfect hash over API table
+ * Every symbol belongs to one of seed_count buckets, seed of the bucket
+ * maps its symbols to distinct slots of the table. Lookup costs one seed
+ * read and one table read, no probing.
+ */
+template <std::size_t N>
+struct sym_perfect_hash {
+    static constexpr std::size_t seed_count = (N + 1) / 2;
+
+    std::array<uint16_t, seed_count> seeds;
+    std::array<sym_entry, N> table;
+    bool valid;
+};
+
+/* Compile-time construction of minimal perfect hash for API table.
+ * Buckets are placed largest first, each one gets the first seed that maps
+ * all its entries to free slots. With 2 entries per bucket on average this
+ * takes ~13 tries per entry for the firmware API table.
+ * Usage: constexpr auto api_hash = perfect_hash_build(api_methods);
+ *        static_assert(api_hash.valid, "Perfect hash construction failed");
+ */
+template <std::size_t N>
+constexpr auto perfect_hash_build(const std::array<sym_entry, N>& api_methods) {
+    static_assert(N > 0 && N <= UINT16_MAX, "Unsupported API table size");
+    using PerfectHash = sym_perfect_hash<N>;
+    constexpr std::size_t seed_count = PerfectHash::seed_count;
+
+    PerfectHash result{};
+    std::array<uint16_t, seed_count + 1> bucket_start{};
+    std::array<uint16_t, seed_count> bucket_size{};
+    std::array<uint16_t, N> bucket_items{};
+    std::array<uint32_t, N> bucket_slots{};
+    std::array<bool, N> slot_used{};
+
+    /* Group entries by bucket */
+    for(std::size_t i = 0; i < N; ++i) {
+        bucket_start[sym_perfect_hash_bucket(api_methods[i].hash, seed_count) + 1]++;
+    }
+
+    std::size_t max_bucket_size = 0;
+    for(std::size_t b = 0; b < seed_count; ++b) {
+        if(bucket_start[b + 1] > max_bucket_size) {
+            max_bucket_size = bucket_start[b + 1];
+        }
+        bucket_start[b + 1] += bucket_start[b];
+    }
+
+    for(std::size_t i = 0; i < N; ++i) {
+        const uint32_t bucket = sym_perfect_hash_bucket(api_methods[i].hash, seed_count);
+        bucket_items[bucket_start[bucket] + bucket_size[bucket]++] = i;
+    }
+
+    /* Place buckets, largest first while the table is still mostly empty */
+    for(std::size_t size = max_bucket_size; size > 0; --size) {
+        for(std::size_t b = 0; b < seed_count; ++b) {
+            if(bucket_size[b] != size) continue;
+
+            bool placed = false;
+            for(uint32_t seed = 0; seed <= UINT16_MAX && !placed; ++seed) {
+                std::size_t k = 0;
+                for(; k < size; ++k) {
+                    const uint32_t hash = api_methods[bucket_items[bucket_start[b] + k]].hash;
+                    const uint32_t slot = sym_perfect_hash_slot(hash, seed, N);
+                    if(slot_used[slot]) break;
+                    slot_used[slot] = true;
+                    bucket_slots[k] = slot;
+                }
+
+                if(k == size) {
+                    placed = true;
+                    result.seeds[b] = seed;
+                    for(k = 0; k < size; ++k) {
+                        result.table[bucket_slots[k]] =
+                            api_methods[bucket_items[bucket_start[b] + k]];
+                    }
+                } else {
+                    while(k > 0) {
+                        slot_used[bucket_slots[--k]] = false;
+                    }
+                }
+            }
+
+            if(!placed) {
+                return result;
+            }
+        }
+    }
+
+    result.valid = true;
+    return result;
+}
+
 #endif
\ No newline at end of file
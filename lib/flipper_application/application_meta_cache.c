@@ -0,0 +1,253 @@
+#include "application_meta_cache.h"
+
+#include <furi.h>
+
+#define TAG "FapMetaCache"
+
+#define APPLICATION_META_CACHE_DIR EXT_PATH("apps_data")
+#define APPLICATION_META_CACHE_MAGIC 0x434D4146 // "FAMC"
+#define APPLICATION_META_CACHE_VERSION 1
+#define APPLICATION_META_CACHE_RECORDS_MAX 1024
+#define APPLICATION_META_CACHE_READ_BATCH 8
+#define APPLICATION_META_CACHE_HASH_INIT 2166136261UL
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+} __attribute__((packed)) ApplicationMetaCacheHeader;
+
+/**
+ * Keys of all records in cache file are kept in memory, so a lookup costs a
+ * single record read. Record index in file is the key index.
+ */
+typedef struct {
+    FuriMutex* mutex;
+    bool loaded;
+    ApplicationMetaCacheKey* keys;
+    size_t count;
+} ApplicationMetaCache;
+
+static ApplicationMetaCache meta_cache = {0};
+
+static FuriMutex* application_meta_cache_get_mutex() {
+    if(!meta_cache.mutex) {
+        FuriMutex* mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+        FURI_CRITICAL_ENTER();
+        if(!meta_cache.mutex) {
+            meta_cache.mutex = mutex;
+            mutex = NULL;
+        }
+        FURI_CRITICAL_EXIT();
+        if(mutex) furi_mutex_free(mutex);
+    }
+    return meta_cache.mutex;
+}
+
+// FNV-1a
+static uint32_t application_meta_cache_hash(const char* path) {
+    uint32_t hash = APPLICATION_META_CACHE_HASH_INIT;
+    while(*path) {
+        hash = (hash ^ (uint8_t)*path++) * 16777619UL;
+    }
+    return hash;
+}
+
+static size_t application_meta_cache_record_offset(size_t index) {
+    return sizeof(ApplicationMetaCacheHeader) + index * sizeof(ApplicationMetaCacheRecord);
+}
+
+static void application_meta_cache_load(Storage* storage) {
+    free(meta_cache.keys);
+    meta_cache.keys = NULL;
+    meta_cache.count = 0;
+    meta_cache.loaded = true;
+
+    File* file = storage_file_alloc(storage);
+    ApplicationMetaCacheRecord* batch =
+        malloc(sizeof(ApplicationMetaCacheRecord) * APPLICATION_META_CACHE_READ_BATCH);
+
+    do {
+        if(!storage_file_open(file, APPLICATION_META_CACHE_PATH, FSAM_READ, FSOM_OPEN_EXISTING))
+            break;
+
+        ApplicationMetaCacheHeader header;
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header) ||
+           header.magic != APPLICATION_META_CACHE_MAGIC ||
+           header.version != APPLICATION_META_CACHE_VERSION) {
+            FURI_LOG_W(TAG, "Invalid cache, discarding");
+            break;
+        }
+
+        // Torn record at the end is ignored
+        size_t count = (storage_file_size(file) - sizeof(header)) /
+                       sizeof(ApplicationMetaCacheRecord);
+        count = MIN(count, (size_t)APPLICATION_META_CACHE_RECORDS_MAX);
+        if(!count) break;
+
+        meta_cache.keys = malloc(sizeof(ApplicationMetaCacheKey) * count);
+        while(meta_cache.count < count) {
+            size_t batch_count =
+                MIN(count - meta_cache.count, (size_t)APPLICATION_META_CACHE_READ_BATCH);
+            size_t batch_size = sizeof(ApplicationMetaCacheRecord) * batch_count;
+            if(storage_file_read(file, batch, batch_size) != batch_size) break;
+            for(size_t i = 0; i < batch_count; i++) {
+                meta_cache.keys[meta_cache.count++] = batch[i].key;
+            }
+        }
+    } while(false);
+
+    FURI_LOG_D(TAG, "Loaded %zu records", meta_cache.count);
+
+    free(batch);
+    storage_file_close(file);
+    storage_file_free(file);
+}
+
+static bool application_meta_cache_find_index(uint32_t path_hash, size_t* index) {
+    for(size_t i = 0; i < meta_cache.count; i++) {
+        if(meta_cache.keys[i].path_hash == path_hash) {
+            *index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool application_meta_cache_read_record(
+    Storage* storage,
+    size_t index,
+    ApplicationMetaCacheRecord* record) {
+    File* file = storage_file_alloc(storage);
+    bool success =
+        storage_file_open(file, APPLICATION_META_CACHE_PATH, FSAM_READ, FSOM_OPEN_EXISTING) &&
+        storage_file_seek(file, application_meta_cache_record_offset(index), true) &&
+        storage_file_read(file, record, sizeof(ApplicationMetaCacheRecord)) ==
+            sizeof(ApplicationMetaCacheRecord);
+    storage_file_close(file);
+    storage_file_free(file);
+    return success;
+}
+
+bool application_meta_cache_find(
+    Storage* storage,
+    const char* path,
+    ApplicationMetaCacheRecord* record) {
+    furi_assert(storage);
+    furi_assert(path);
+    furi_assert(record);
+
+    memset(record, 0, sizeof(ApplicationMetaCacheRecord));
+
+    // Missing and empty files are never cached, update ignores zero size key
+    FileInfo file_info;
+    uint32_t timestamp = 0;
+    if(storage_common_stat(storage, path, &file_info) != FSE_OK || !file_info.size ||
+       storage_common_timestamp(storage, path, &timestamp) != FSE_OK) {
+        return false;
+    }
+
+    ApplicationMetaCacheKey key = {
+        .path_hash = application_meta_cache_hash(path),
+        .file_size = file_info.size,
+        .file_timestamp = timestamp,
+    };
+
+    bool found = false;
+    FuriMutex* mutex = application_meta_cache_get_mutex();
+    furi_mutex_acquire(mutex, FuriWaitForever);
+
+    if(!meta_cache.loaded) {
+        application_meta_cache_load(storage);
+    }
+
+    size_t index = 0;
+    if(application_meta_cache_find_index(key.path_hash, &index) &&
+       memcmp(&meta_cache.keys[index], &key, sizeof(key)) == 0) {
+        found = application_meta_cache_read_record(storage, index, record) &&
+                memcmp(&record->key, &key, sizeof(key)) == 0;
+        if(!found) {
+            // File doesn't match keys in memory, SD card was changed
+            meta_cache.loaded = false;
+        }
+    }
+
+    furi_mutex_release(mutex);
+
+    if(!found) {
+        memset(record, 0, sizeof(ApplicationMetaCacheRecord));
+        record->key = key;
+    }
+
+    return found;
+}
+
+void application_meta_cache_update(Storage* storage, const ApplicationMetaCacheRecord* record) {
+    furi_assert(storage);
+    furi_assert(record);
+
+    if(!record->key.file_size) return;
+
+    FuriMutex* mutex = application_meta_cache_get_mutex();
+    furi_mutex_acquire(mutex, FuriWaitForever);
+
+    if(!meta_cache.loaded) {
+        application_meta_cache_load(storage);
+    }
+
+    size_t index = 0;
+    bool replace = application_meta_cache_find_index(record->key.path_hash, &index);
+    if(!replace) {
+        if(meta_cache.count >= APPLICATION_META_CACHE_RECORDS_MAX) {
+            // Records of removed applications are never pruned, start over
+            FURI_LOG_I(TAG, "Cache is full, resetting");
+            meta_cache.count = 0;
+        }
+        index = meta_cache.count;
+    }
+
+    File* file = storage_file_alloc(storage);
+    bool success = false;
+    do {
+        if(!storage_file_open(
+               file, APPLICATION_META_CACHE_PATH, FSAM_READ_WRITE, FSOM_OPEN_ALWAYS)) {
+            storage_simply_mkdir(storage, APPLICATION_META_CACHE_DIR);
+            if(!storage_file_open(
+                   file, APPLICATION_META_CACHE_PATH, FSAM_READ_WRITE, FSOM_OPEN_ALWAYS))
+                break;
+        }
+
+        if(!meta_cache.count) {
+            ApplicationMetaCacheHeader header = {
+                .magic = APPLICATION_META_CACHE_MAGIC,
+                .version = APPLICATION_META_CACHE_VERSION,
+            };
+            if(!storage_file_truncate(file) ||
+               storage_file_write(file, &header, sizeof(header)) != sizeof(header))
+                break;
+        }
+
+        if(!storage_file_seek(file, application_meta_cache_record_offset(index), true)) break;
+        if(storage_file_write(file, record, sizeof(ApplicationMetaCacheRecord)) !=
+           sizeof(ApplicationMetaCacheRecord))
+            break;
+
+        success = true;
+    } while(false);
+
+    storage_file_close(file);
+    storage_file_free(file);
+
+    if(success) {
+        if(!replace) {
+            meta_cache.keys =
+                realloc(meta_cache.keys, sizeof(ApplicationMetaCacheKey) * (meta_cache.count + 1));
+            meta_cache.count++;
+        }
+        meta_cache.keys[index] = record->key;
+    } else {
+        FURI_LOG_E(TAG, "Failed to update cache");
+        meta_cache.loaded = false;
+    }
+
+    furi_mutex_release(mutex);
+}
@@ -0,0 +1,69 @@
+/**
+ * @file application_meta_cache.h
+ * Flipper application metadata cache
+ *
+ * Name and icon of every FAP seen by file browsers and menus are kept in a
+ * persistent index on SD card, so listing a folder of applications does not
+ * parse every ELF again. Records are keyed by path hash, file size and
+ * timestamp, a changed FAP misses the cache and its record is replaced.
+ */
+#pragma once
+
+#include <storage/storage.h>
+#include "application_manifest.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define APPLICATION_META_CACHE_PATH EXT_PATH("apps_data/.fap_meta.cache")
+
+typedef enum {
+    ApplicationMetaCacheFlagValid = (1 << 0), /**< manifest was loaded */
+    ApplicationMetaCacheFlagHasIcon = (1 << 1),
+} ApplicationMetaCacheFlag;
+
+#pragma pack(push, 1)
+
+typedef struct {
+    uint32_t path_hash;
+    uint32_t file_size;
+    uint32_t file_timestamp;
+} ApplicationMetaCacheKey;
+
+typedef struct {
+    ApplicationMetaCacheKey key;
+    uint16_t api_version_major;
+    uint16_t api_version_minor;
+    uint8_t flags;
+    char name[FAP_MANIFEST_MAX_APP_NAME_LENGTH];
+    uint8_t icon[FAP_MANIFEST_MAX_ICON_SIZE];
+} ApplicationMetaCacheRecord;
+
+#pragma pack(pop)
+
+/**
+ * @brief Find application metadata in cache
+ *
+ * @param storage Storage instance
+ * @param path Path to FAP file
+ * @param record Record to fill. On miss only record key is filled, it is ready
+ *               for application_meta_cache_update() once the rest is loaded.
+ * @return true if record was found and is up to date
+ */
+bool application_meta_cache_find(
+    Storage* storage,
+    const char* path,
+    ApplicationMetaCacheRecord* record);
+
+/**
+ * @brief Add or replace application metadata in cache
+ *
+ * @param storage Storage instance
+ * @param record Record with key filled by application_meta_cache_find()
+ */
+void application_meta_cache_update(Storage* storage, const ApplicationMetaCacheRecord* record);
+
+#ifdef __cplusplus
+}
+#endif
@@ -13,6 +13,12 @@
 #define RESOLVER_THREAD_YIELD_STEP 30
 #define FAST_RELOCATION_VERSION 1
 
+#define RELOCATION_CACHE_EXTENSION ".rcache"
+#define RELOCATION_CACHE_MAGIC 0x43524C45 // "ELRC"
+#define RELOCATION_CACHE_VERSION 1
+#define ELF_HASH_INIT 2166136261UL
+#define ELF_FILE_CACHE_SIZE 512
+
 // #define ELF_DEBUG_LOG 1
 
 #ifndef ELF_DEBUG_LOG
@@ -36,10 +42,37 @@ typedef struct {
     uint32_t addr;
 } __attribute__((packed)) JMPTrampoline;
 
+/**
+ * Relocation cache file header, followed by ELFRelocationCacheSymbol records.
+ * Everything before symbol_count is the cache key.
+ */
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t reserved;
+    uint16_t api_version_major;
+    uint16_t api_version_minor;
+    uint16_t reserved2;
+    uint32_t file_size;
+    uint32_t file_timestamp;
+    uint32_t content_hash;
+    uint32_t symbol_count;
+    uint32_t symbols_hash;
+} __attribute__((packed)) ELFRelocationCacheHeader;
+
 /**************************************************************************************************/
 /********************************************* Caches *********************************************/
 /**************************************************************************************************/
 
+// FNV-1a
+static uint32_t elf_hash_update(uint32_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = data;
+    for(size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 16777619UL;
+    }
+    return hash;
+}
+
 static bool address_cache_get(AddressCache_t cache, int symEntry, Elf32_Addr* symAddr) {
     Elf32_Addr* addr = AddressCache_get(cache, symEntry);
     if(addr) {
@@ -399,6 +432,21 @@ static bool elf_relocate(ELFFile* elf, ELFSection* s) {
 
                 symAddr = elf_address_of(elf, &sym, furi_string_get_cstr(symbol_name));
                 address_cache_put(elf->relocation_cache, symEntry, symAddr);
+
+                // Remember how symbol was resolved for the relocation cache
+                if(symAddr != ELF_INVALID_ADDRESS) {
+                    bool is_section = (sym.st_shndx != SHN_UNDEF);
+                    ELFRelocationCacheSymbol cache_symbol = {
+                        .sym_entry = symEntry,
+                        .hash_or_section_index =
+                            is_section ? sym.st_shndx :
+                                         elf_symbolname_hash(furi_string_get_cstr(symbol_name)),
+                        .value = sym.st_value,
+                        .is_section = is_section,
+                    };
+                    ELFRelocationCacheSymbolArray_push_back(
+                        elf->relocation_cache_symbols, cache_symbol);
+                }
             }
 
             if(symAddr != ELF_INVALID_ADDRESS) {
@@ -475,6 +523,9 @@ static bool elf_load_section_data(ELFFile* elf, ELFSection* section, Elf32_Shdr*
         return false;
     }
 
+    elf->content_hash =
+        elf_hash_update(elf->content_hash, section->data, section_header->sh_size);
+
     FURI_LOG_D(TAG, "0x%p", section->data);
     return true;
 }
@@ -697,6 +748,124 @@ static bool elf_relocate_section(ELFFile* elf, ELFSection* section) {
     return true;
 }
 
+static bool elf_relocation_cache_is_needed(ELFFile* elf) {
+    ELFSectionDict_it_t it;
+    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
+        const ELFSectionDict_itref_t* itref = ELFSectionDict_cref(it);
+        if(itref->value.rel_count && !itref->value.fast_rel) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool elf_relocation_cache_get_key(ELFFile* elf, ELFRelocationCacheHeader* header) {
+    uint32_t timestamp = 0;
+    if(storage_common_timestamp(elf->storage, furi_string_get_cstr(elf->path), &timestamp) !=
+       FSE_OK) {
+        return false;
+    }
+
+    memset(header, 0, sizeof(ELFRelocationCacheHeader));
+    header->magic = RELOCATION_CACHE_MAGIC;
+    header->version = RELOCATION_CACHE_VERSION;
+    header->api_version_major = elf->api_interface->api_version_major;
+    header->api_version_minor = elf->api_interface->api_version_minor;
+    header->file_size = storage_file_size(elf->fd);
+    header->file_timestamp = timestamp;
+    header->content_hash = elf->content_hash;
+    return true;
+}
+
+/**
+ * Prefill relocation address cache with symbols resolved on a previous launch,
+ * so relocation does not have to read symbol names from the file.
+ */
+static bool elf_relocation_cache_load(ELFFile* elf, FuriString* cache_path) {
+    bool result = false;
+    ELFRelocationCacheHeader key, header;
+    ELFRelocationCacheSymbol* symbols = NULL;
+    File* file = storage_file_alloc(elf->storage);
+
+    do {
+        if(!elf_relocation_cache_get_key(elf, &key)) break;
+        if(!storage_file_open(
+               file, furi_string_get_cstr(cache_path), FSAM_READ, FSOM_OPEN_EXISTING))
+            break;
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(memcmp(&header, &key, offsetof(ELFRelocationCacheHeader, symbol_count)) != 0) {
+            FURI_LOG_I(TAG, "Relocation cache is outdated");
+            break;
+        }
+
+        size_t symbols_size = header.symbol_count * sizeof(ELFRelocationCacheSymbol);
+        if(storage_file_size(file) != sizeof(header) + symbols_size) break;
+
+        symbols = malloc(symbols_size);
+        if(storage_file_read_large(file, symbols, symbols_size) != symbols_size) break;
+        if(elf_hash_update(ELF_HASH_INIT, symbols, symbols_size) != header.symbols_hash) break;
+
+        for(uint32_t i = 0; i < header.symbol_count; i++) {
+            Elf32_Addr address = ELF_INVALID_ADDRESS;
+            if(symbols[i].is_section) {
+                ELFSection* section = elf_section_of(elf, symbols[i].hash_or_section_index);
+                if(section) {
+                    address = ((Elf32_Addr)section->data) + symbols[i].value;
+                }
+            } else {
+                address = elf_address_of_by_hash(elf, symbols[i].hash_or_section_index);
+            }
+
+            // Unresolved symbols are looked up the slow way
+            if(address != ELF_INVALID_ADDRESS) {
+                address_cache_put(elf->relocation_cache, symbols[i].sym_entry, address);
+            }
+        }
+
+        FURI_LOG_I(TAG, "Relocation cache: %lu symbols", header.symbol_count);
+        result = true;
+    } while(false);
+
+    if(symbols) {
+        free(symbols);
+    }
+    storage_file_free(file);
+    return result;
+}
+
+static void elf_relocation_cache_save(ELFFile* elf, FuriString* cache_path) {
+    ELFRelocationCacheHeader header;
+    size_t symbol_count = ELFRelocationCacheSymbolArray_size(elf->relocation_cache_symbols);
+    if(symbol_count == 0 || !elf_relocation_cache_get_key(elf, &header)) {
+        return;
+    }
+
+    const ELFRelocationCacheSymbol* symbols =
+        ELFRelocationCacheSymbolArray_cget(elf->relocation_cache_symbols, 0);
+    size_t symbols_size = symbol_count * sizeof(ELFRelocationCacheSymbol);
+    header.symbol_count = symbol_count;
+    header.symbols_hash = elf_hash_update(ELF_HASH_INIT, symbols, symbols_size);
+
+    bool result = false;
+    File* file = storage_file_alloc(elf->storage);
+    do {
+        if(!storage_file_open(
+               file, furi_string_get_cstr(cache_path), FSAM_WRITE, FSOM_CREATE_ALWAYS))
+            break;
+        if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(storage_file_write_large(file, symbols, symbols_size) != symbols_size) break;
+        result = storage_file_close(file);
+    } while(false);
+    storage_file_free(file);
+
+    if(result) {
+        FURI_LOG_I(TAG, "Relocation cache saved: %u symbols", symbol_count);
+    } else {
+        storage_common_remove(elf->storage, furi_string_get_cstr(cache_path));
+    }
+}
+
 static void elf_file_call_section_list(ELFSection* section, bool reverse_order) {
     if(section && section->size) {
         const uint32_t* start = section->data;
@@ -723,6 +892,12 @@ static void elf_file_call_section_list(ELFSection* section, bool reverse_order)
 ELFFile* elf_file_alloc(Storage* storage, const ElfApiInterface* api_interface) {
     ELFFile* elf = malloc(sizeof(ELFFile));
     elf->fd = storage_file_alloc(storage);
+    // Relocation entries are read one by one
+    storage_file_set_cache_size(elf->fd, ELF_FILE_CACHE_SIZE);
+    elf->storage = storage;
+    elf->path = furi_string_alloc();
+    elf->content_hash = ELF_HASH_INIT;
+    ELFRelocationCacheSymbolArray_init(elf->relocation_cache_symbols);
     elf->api_interface = api_interface;
     ELFSectionDict_init(elf->sections);
     AddressCache_init(elf->trampoline_cache);
@@ -772,6 +947,9 @@ void elf_file_free(ELFFile* elf) {
         free(elf->debug_link_info.debug_link);
     }
 
+    ELFRelocationCacheSymbolArray_clear(elf->relocation_cache_symbols);
+    furi_string_free(elf->path);
+
     elf_file_maybe_release_fd(elf);
     free(elf);
 }
@@ -788,6 +966,7 @@ bool elf_file_open(ELFFile* elf, const char* path) {
         return false;
     }
 
+    furi_string_set(elf->path, path);
     elf->entry = h.e_entry;
     elf->sections_count = h.e_shnum;
     elf->section_table = h.e_shoff;
@@ -810,6 +989,10 @@ bool elf_file_load_section_table(ELFFile* elf) {
             break;
         }
 
+        // Section table and loaded data are the relocation cache key
+        elf->content_hash =
+            elf_hash_update(elf->content_hash, &section_header, sizeof(section_header));
+
         FURI_LOG_D(
             TAG, "Preloading data for section #%d %s", section_idx, furi_string_get_cstr(name));
         SectionType section_type = elf_preload_section(elf, section_idx, &section_header, name);
@@ -869,6 +1052,15 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
 
     AddressCache_init(elf->relocation_cache);
 
+    // Symbols resolved on a previous launch, only needed without fast relocations
+    bool relocation_cache_loaded = false;
+    FuriString* relocation_cache_path = NULL;
+    if(elf_relocation_cache_is_needed(elf)) {
+        relocation_cache_path = furi_string_alloc_printf(
+            "%s" RELOCATION_CACHE_EXTENSION, furi_string_get_cstr(elf->path));
+        relocation_cache_loaded = elf_relocation_cache_load(elf, relocation_cache_path);
+    }
+
     for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
         ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
         FURI_LOG_D(TAG, "Relocating section '%s'", itref->key);
@@ -878,6 +1070,16 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
         }
     }
 
+    if(relocation_cache_path) {
+        if(status != ELFFileLoadStatusSuccess) {
+            storage_common_remove(elf->storage, furi_string_get_cstr(relocation_cache_path));
+        } else if(!relocation_cache_loaded) {
+            elf_relocation_cache_save(elf, relocation_cache_path);
+        }
+        furi_string_free(relocation_cache_path);
+    }
+    ELFRelocationCacheSymbolArray_reset(elf->relocation_cache_symbols);
+
     /* Fixing up entry point */
     if(status == ELFFileLoadStatusSuccess) {
         ELFSection* text_section = elf_file_get_section(elf, ".text");
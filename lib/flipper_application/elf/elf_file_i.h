@@ -1,6 +1,7 @@
 #pragma once
 #include "elf_file.h"
 #include <m-dict.h>
+#include <m-array.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +29,18 @@ struct ELFSection {
 
 DICT_DEF2(ELFSectionDict, const char*, M_CSTR_OPLIST, ELFSection, M_POD_OPLIST)
 
+/**
+ * Resolved relocation symbol, stored in the relocation cache file
+ */
+typedef struct {
+    uint32_t sym_entry; /**< index in .symtab */
+    uint32_t hash_or_section_index; /**< API symbol name hash or section index */
+    uint32_t value; /**< offset in section for section symbols */
+    uint8_t is_section;
+} __attribute__((packed)) ELFRelocationCacheSymbol;
+
+ARRAY_DEF(ELFRelocationCacheSymbolArray, ELFRelocationCacheSymbol, M_POD_OPLIST)
+
 struct ELFFile {
     size_t sections_count;
     off_t section_table;
@@ -43,6 +56,11 @@ struct ELFFile {
     AddressCache_t trampoline_cache;
 
     File* fd;
+    Storage* storage;
+    FuriString* path;
+    uint32_t content_hash;
+    ELFRelocationCacheSymbolArray_t relocation_cache_symbols;
+
     const ElfApiInterface* api_interface;
     ELFDebugLinkInfo debug_link_info;
 
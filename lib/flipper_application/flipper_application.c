@@ -2,6 +2,7 @@
 #include "elf/elf_file.h"
 #include <notification/notification_messages.h>
 #include "application_assets.h"
+#include "application_meta_cache.h"
 #include <loader/firmware_api/firmware_api.h>
 #include <storage/storage_processing.h>
 
@@ -314,14 +315,21 @@ bool flipper_application_load_name_and_icon(
     uint8_t** icon_ptr,
     FuriString* item_name) {
     bool load_success = true;
+    bool cache_hit = false;
 
-    StorageData* storage_data;
-    if(storage_get_data(storage, path, &storage_data) == FSE_OK &&
-       storage_path_already_open(path, storage_data)) {
-        load_success = false;
+    ApplicationMetaCacheRecord* record = malloc(sizeof(ApplicationMetaCacheRecord));
+    if(application_meta_cache_find(storage, furi_string_get_cstr(path), record)) {
+        cache_hit = true;
+        load_success = record->flags & ApplicationMetaCacheFlagValid;
+    } else {
+        StorageData* storage_data;
+        if(storage_get_data(storage, path, &storage_data) == FSE_OK &&
+           storage_path_already_open(path, storage_data)) {
+            load_success = false;
+        }
     }
 
-    if(load_success) {
+    if(load_success && !cache_hit) {
         load_success = false;
 
         FlipperApplication* app = flipper_application_alloc(storage, firmware_api_interface);
@@ -332,19 +340,35 @@ bool flipper_application_load_name_and_icon(
         if(preload_res == FlipperApplicationPreloadStatusSuccess ||
            preload_res == FlipperApplicationPreloadStatusApiMismatch) {
             const FlipperApplicationManifest* manifest = flipper_application_get_manifest(app);
-            if(manifest->has_icon && icon_ptr != NULL && *icon_ptr != NULL) {
-                memcpy(*icon_ptr, manifest->icon, FAP_MANIFEST_MAX_ICON_SIZE);
+            record->flags = ApplicationMetaCacheFlagValid;
+            record->api_version_major = manifest->base.api_version.major;
+            record->api_version_minor = manifest->base.api_version.minor;
+            memcpy(record->name, manifest->name, FAP_MANIFEST_MAX_APP_NAME_LENGTH);
+            if(manifest->has_icon) {
+                record->flags |= ApplicationMetaCacheFlagHasIcon;
+                memcpy(record->icon, manifest->icon, FAP_MANIFEST_MAX_ICON_SIZE);
             }
-            furi_string_set(item_name, manifest->name);
             load_success = true;
         } else {
             FURI_LOG_E(TAG, "Failed to preload %s", furi_string_get_cstr(path));
         }
 
+        // Unspecified error may be transient, everything else is a property of the file
+        if(preload_res != FlipperApplicationPreloadStatusUnspecifiedError) {
+            application_meta_cache_update(storage, record);
+        }
+
         flipper_application_free(app);
     }
 
-    if(!load_success) {
+    if(load_success) {
+        if((record->flags & ApplicationMetaCacheFlagHasIcon) && icon_ptr != NULL &&
+           *icon_ptr != NULL) {
+            memcpy(*icon_ptr, record->icon, FAP_MANIFEST_MAX_ICON_SIZE);
+        }
+        furi_string_set_strn(
+            item_name, record->name, strnlen(record->name, FAP_MANIFEST_MAX_APP_NAME_LENGTH));
+    } else {
         size_t offset = furi_string_search_rchar(path, '/');
         if(offset != FURI_STRING_FAILURE) {
             furi_string_set_n(item_name, path, offset + 1, furi_string_size(path) - offset - 1);
@@ -353,5 +377,7 @@ bool flipper_application_load_name_and_icon(
         }
     }
 
+    free(record);
+
     return load_success;
 }
@@ -12,6 +12,8 @@
 struct FlipperFormat {
     Stream* stream;
     bool strict_mode;
+    bool indexed_mode;
+    FlipperStreamIndex* index;
 };
 
 static const char* const flipper_format_filetype_key = "Filetype";
@@ -21,6 +23,43 @@ Stream* flipper_format_get_raw_stream(FlipperFormat* flipper_format) {
     return flipper_format->stream;
 }
 
+static void flipper_format_index_drop(FlipperFormat* flipper_format) {
+    if(flipper_format->index) {
+        flipper_format_stream_index_free(flipper_format->index);
+        flipper_format->index = NULL;
+    }
+}
+
+static FlipperStreamIndex* flipper_format_get_index(FlipperFormat* flipper_format) {
+    if(!flipper_format->indexed_mode) return NULL;
+
+    if(flipper_format->index &&
+       !flipper_format_stream_index_is_valid(flipper_format->index, flipper_format->stream)) {
+        flipper_format_index_drop(flipper_format);
+    }
+    if(!flipper_format->index) {
+        flipper_format->index = flipper_format_stream_index_alloc(flipper_format->stream);
+    }
+
+    return flipper_format->index;
+}
+
+static bool flipper_format_read_value_line(
+    FlipperFormat* flipper_format,
+    const char* key,
+    FlipperStreamValue type,
+    void* data,
+    size_t data_size) {
+    return flipper_format_stream_read_value_line_ex(
+        flipper_format->stream,
+        flipper_format_get_index(flipper_format),
+        key,
+        type,
+        data,
+        data_size,
+        flipper_format->strict_mode);
+}
+
 /********************************** Public **********************************/
 
 FlipperFormat* flipper_format_string_alloc() {
@@ -104,16 +143,19 @@ bool flipper_format_file_open_new(FlipperFormat* flipper_format, const char* pat
 
 bool flipper_format_file_close(FlipperFormat* flipper_format) {
     furi_assert(flipper_format);
+    flipper_format_index_drop(flipper_format);
     return file_stream_close(flipper_format->stream);
 }
 
 bool flipper_format_buffered_file_close(FlipperFormat* flipper_format) {
     furi_assert(flipper_format);
+    flipper_format_index_drop(flipper_format);
     return buffered_file_stream_close(flipper_format->stream);
 }
 
 void flipper_format_free(FlipperFormat* flipper_format) {
     furi_assert(flipper_format);
+    flipper_format_index_drop(flipper_format);
     stream_free(flipper_format->stream);
     free(flipper_format);
 }
@@ -122,6 +164,12 @@ void flipper_format_set_strict_mode(FlipperFormat* flipper_format, bool strict_m
     flipper_format->strict_mode = strict_mode;
 }
 
+void flipper_format_set_indexed_mode(FlipperFormat* flipper_format, bool indexed_mode) {
+    furi_assert(flipper_format);
+    flipper_format->indexed_mode = indexed_mode;
+    if(!indexed_mode) flipper_format_index_drop(flipper_format);
+}
+
 bool flipper_format_rewind(FlipperFormat* flipper_format) {
     furi_assert(flipper_format);
     return stream_rewind(flipper_format->stream);
@@ -135,7 +183,8 @@ bool flipper_format_seek_to_end(FlipperFormat* flipper_format) {
 bool flipper_format_key_exist(FlipperFormat* flipper_format, const char* key) {
     size_t pos = stream_tell(flipper_format->stream);
     stream_seek(flipper_format->stream, 0, StreamOffsetFromStart);
-    bool result = flipper_format_stream_seek_to_key(flipper_format->stream, key, false);
+    bool result = flipper_format_stream_seek_to_key_ex(
+        flipper_format->stream, flipper_format_get_index(flipper_format), key, false);
     stream_seek(flipper_format->stream, pos, StreamOffsetFromStart);
 
     return result;
@@ -174,14 +223,17 @@ bool flipper_format_get_value_count(
     const char* key,
     uint32_t* count) {
     furi_assert(flipper_format);
-    return flipper_format_stream_get_value_count(
-        flipper_format->stream, key, count, flipper_format->strict_mode);
+    return flipper_format_stream_get_value_count_ex(
+        flipper_format->stream,
+        flipper_format_get_index(flipper_format),
+        key,
+        count,
+        flipper_format->strict_mode);
 }
 
 bool flipper_format_read_string(FlipperFormat* flipper_format, const char* key, FuriString* data) {
     furi_assert(flipper_format);
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream, key, FlipperStreamValueStr, data, 1, flipper_format->strict_mode);
+    return flipper_format_read_value_line(flipper_format, key, FlipperStreamValueStr, data, 1);
 }
 
 bool flipper_format_write_string(FlipperFormat* flipper_format, const char* key, FuriString* data) {
@@ -217,13 +269,8 @@ bool flipper_format_read_hex_uint64(
     uint64_t* data,
     const uint16_t data_size) {
     furi_assert(flipper_format);
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
-        key,
-        FlipperStreamValueHexUint64,
-        data,
-        data_size,
-        flipper_format->strict_mode);
+    return flipper_format_read_value_line(
+        flipper_format, key, FlipperStreamValueHexUint64, data, data_size);
 }
 
 bool flipper_format_write_hex_uint64(
@@ -248,13 +295,8 @@ bool flipper_format_read_uint32(
     uint32_t* data,
     const uint16_t data_size) {
     furi_assert(flipper_format);
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
-        key,
-        FlipperStreamValueUint32,
-        data,
-        data_size,
-        flipper_format->strict_mode);
+    return flipper_format_read_value_line(
+        flipper_format, key, FlipperStreamValueUint32, data, data_size);
 }
 
 bool flipper_format_write_uint32(
@@ -278,13 +320,8 @@ bool flipper_format_read_int32(
     const char* key,
     int32_t* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
-        key,
-        FlipperStreamValueInt32,
-        data,
-        data_size,
-        flipper_format->strict_mode);
+    return flipper_format_read_value_line(
+        flipper_format, key, FlipperStreamValueInt32, data, data_size);
 }
 
 bool flipper_format_write_int32(
@@ -308,13 +345,8 @@ bool flipper_format_read_bool(
     const char* key,
     bool* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
-        key,
-        FlipperStreamValueBool,
-        data,
-        data_size,
-        flipper_format->strict_mode);
+    return flipper_format_read_value_line(
+        flipper_format, key, FlipperStreamValueBool, data, data_size);
 }
 
 bool flipper_format_write_bool(
@@ -338,13 +370,8 @@ bool flipper_format_read_float(
     const char* key,
     float* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
-        key,
-        FlipperStreamValueFloat,
-        data,
-        data_size,
-        flipper_format->strict_mode);
+    return flipper_format_read_value_line(
+        flipper_format, key, FlipperStreamValueFloat, data, data_size);
 }
 
 bool flipper_format_write_float(
@@ -368,13 +395,8 @@ bool flipper_format_read_hex(
     const char* key,
     uint8_t* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
-        key,
-        FlipperStreamValueHex,
-        data,
-        data_size,
-        flipper_format->strict_mode);
+    return flipper_format_read_value_line(
+        flipper_format, key, FlipperStreamValueHex, data, data_size);
 }
 
 bool flipper_format_write_hex(
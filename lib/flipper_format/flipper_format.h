@@ -203,6 +203,17 @@ void flipper_format_free(FlipperFormat* flipper_format);
  */
 void flipper_format_set_strict_mode(FlipperFormat* flipper_format, bool strict_mode);
 
+/**
+ * Set FlipperFormat key index mode.
+ * In indexed mode offsets of all keys are collected in one pass on the first read,
+ * following reads seek directly to the key instead of scanning the file.
+ * Index is rebuilt after any change of the underlying stream. False by default.
+ * Useful for big files and for reading keys out of order.
+ * @param flipper_format Pointer to a FlipperFormat instance
+ * @param indexed_mode True to enable key index
+ */
+void flipper_format_set_indexed_mode(FlipperFormat* flipper_format, bool indexed_mode);
+
 /**
  * Rewind the RW pointer.
  * @param flipper_format Pointer to a FlipperFormat instance
@@ -1,9 +1,31 @@
 #include <inttypes.h>
 #include <toolbox/hex.h>
+#include <toolbox/stream/stream_i.h>
 #include <core/check.h>
+#include <core/common_defines.h>
+#include <m-array.h>
 #include "flipper_format_stream.h"
 #include "flipper_format_stream_i.h"
 
+#define FLIPPER_FORMAT_STREAM_INDEX_HASH_INIT 2166136261UL
+#define FLIPPER_FORMAT_STREAM_INDEX_HASH_PRIME 16777619UL
+
+typedef struct {
+    uint32_t hash;
+    uint32_t line_start;
+    uint32_t delimiter;
+} FlipperStreamIndexEntry;
+
+ARRAY_DEF(FlipperStreamIndexEntryArray, FlipperStreamIndexEntry, M_POD_OPLIST);
+
+struct FlipperStreamIndex {
+    // Keys in file order
+    FlipperStreamIndexEntryArray_t entries;
+    // Same keys sorted by hash, duplicate keys keep file order
+    FlipperStreamIndexEntry* by_hash;
+    uint32_t generation;
+};
+
 static inline bool flipper_format_stream_is_space(char c) {
     return c == ' ' || c == '\t' || c == flipper_format_eolr;
 }
@@ -97,6 +119,256 @@ static bool flipper_format_stream_read_valid_key(Stream* stream, FuriString* key
     return found;
 }
 
+static inline uint32_t flipper_format_stream_index_hash(uint32_t hash, uint8_t data) {
+    return (hash ^ data) * FLIPPER_FORMAT_STREAM_INDEX_HASH_PRIME;
+}
+
+static uint32_t flipper_format_stream_index_hash_cstr(const char* key) {
+    uint32_t hash = FLIPPER_FORMAT_STREAM_INDEX_HASH_INIT;
+    while(*key) {
+        hash = flipper_format_stream_index_hash(hash, *key++);
+    }
+    return hash;
+}
+
+static int flipper_format_stream_index_compare(const void* a, const void* b) {
+    const FlipperStreamIndexEntry* entry_a = a;
+    const FlipperStreamIndexEntry* entry_b = b;
+    if(entry_a->hash != entry_b->hash) return entry_a->hash < entry_b->hash ? -1 : 1;
+    if(entry_a->line_start != entry_b->line_start)
+        return entry_a->line_start < entry_b->line_start ? -1 : 1;
+    return 0;
+}
+
+FlipperStreamIndex* flipper_format_stream_index_alloc(Stream* stream) {
+    const size_t buffer_size = 64;
+    uint8_t buffer[buffer_size];
+
+    size_t position = stream_tell(stream);
+    if(!stream_rewind(stream)) return NULL;
+
+    FlipperStreamIndex* index = malloc(sizeof(FlipperStreamIndex));
+    FlipperStreamIndexEntryArray_init(index->entries);
+    index->generation = stream->generation;
+
+    // Same state machine as flipper_format_stream_read_valid_key, but over the whole stream
+    bool accumulate = true;
+    bool new_line = true;
+    uint32_t hash = FLIPPER_FORMAT_STREAM_INDEX_HASH_INIT;
+    uint32_t line_start = 0;
+    uint32_t offset = 0;
+
+    while(true) {
+        size_t was_read = stream_read(stream, buffer, buffer_size);
+        if(was_read == 0) break;
+
+        for(size_t i = 0; i < was_read; i++) {
+            uint8_t data = buffer[i];
+            if(data == flipper_format_eoln) {
+                accumulate = true;
+                new_line = true;
+                hash = FLIPPER_FORMAT_STREAM_INDEX_HASH_INIT;
+                line_start = offset + i + 1;
+            } else if(data == flipper_format_eolr) {
+                // ignore
+            } else if(data == flipper_format_comment && new_line) {
+                accumulate = false;
+                new_line = false;
+            } else if(data == flipper_format_delimiter) {
+                if(new_line) {
+                    accumulate = false;
+                    new_line = false;
+                } else if(accumulate) {
+                    FlipperStreamIndexEntry* entry =
+                        FlipperStreamIndexEntryArray_push_new(index->entries);
+                    entry->hash = hash;
+                    entry->line_start = line_start;
+                    entry->delimiter = offset + i;
+                    // the rest of the line is a value
+                    accumulate = false;
+                }
+            } else {
+                new_line = false;
+                if(accumulate) hash = flipper_format_stream_index_hash(hash, data);
+            }
+        }
+        offset += was_read;
+    }
+
+    size_t count = FlipperStreamIndexEntryArray_size(index->entries);
+    index->by_hash = malloc(sizeof(FlipperStreamIndexEntry) * MAX(count, 1U));
+    if(count) {
+        memcpy(
+            index->by_hash,
+            FlipperStreamIndexEntryArray_cget(index->entries, 0),
+            sizeof(FlipperStreamIndexEntry) * count);
+        // qsort is not stable, hence line_start is a part of the sort key
+        qsort(
+            index->by_hash,
+            count,
+            sizeof(FlipperStreamIndexEntry),
+            flipper_format_stream_index_compare);
+    }
+
+    if(!stream_seek(stream, position, StreamOffsetFromStart)) {
+        flipper_format_stream_index_free(index);
+        index = NULL;
+    }
+
+    return index;
+}
+
+void flipper_format_stream_index_free(FlipperStreamIndex* index) {
+    furi_assert(index);
+    FlipperStreamIndexEntryArray_clear(index->entries);
+    free(index->by_hash);
+    free(index);
+}
+
+bool flipper_format_stream_index_is_valid(FlipperStreamIndex* index, Stream* stream) {
+    furi_assert(index);
+    return index->generation == stream->generation;
+}
+
+size_t flipper_format_stream_index_get_count(FlipperStreamIndex* index) {
+    furi_assert(index);
+    return FlipperStreamIndexEntryArray_size(index->entries);
+}
+
+/**
+ * Index lookups are equal to a scan only if the scan would start at a line boundary:
+ * the beginning of a line or its EOL, which is where every read leaves the stream.
+ */
+static bool flipper_format_stream_index_get_start(Stream* stream, size_t* start) {
+    size_t position = stream_tell(stream);
+    *start = position;
+    if(position == 0 || stream_eof(stream)) return true;
+
+    uint8_t around[2];
+    if(!stream_seek(stream, -1, StreamOffsetFromCurrent)) return false;
+    size_t was_read = stream_read(stream, around, sizeof(around));
+    if(!stream_seek(stream, position, StreamOffsetFromStart)) return false;
+
+    if(was_read == 0) return false;
+    if(around[0] == flipper_format_eoln) return true;
+    return (was_read == sizeof(around)) && (around[1] == flipper_format_eoln);
+}
+
+static bool flipper_format_stream_index_key_equal(
+    Stream* stream,
+    const FlipperStreamIndexEntry* entry,
+    const char* key) {
+    const size_t buffer_size = 32;
+    uint8_t buffer[buffer_size];
+    size_t key_size = strlen(key);
+    size_t matched = 0;
+    size_t left = entry->delimiter - entry->line_start;
+
+    if(!stream_seek(stream, entry->line_start, StreamOffsetFromStart)) return false;
+
+    while(left) {
+        size_t was_read = stream_read(stream, buffer, MIN(left, buffer_size));
+        if(was_read == 0) return false;
+
+        for(size_t i = 0; i < was_read; i++) {
+            if(buffer[i] == flipper_format_eolr) continue;
+            if((matched >= key_size) || (buffer[i] != (uint8_t)key[matched])) return false;
+            matched++;
+        }
+        left -= was_read;
+    }
+
+    return matched == key_size;
+}
+
+/** Position the stream like a scan that found the entry, value follows after ": " */
+static bool flipper_format_stream_index_seek_to_value(
+    Stream* stream,
+    const FlipperStreamIndexEntry* entry) {
+    if(!stream_seek(stream, entry->delimiter, StreamOffsetFromStart)) return false;
+    return stream_seek(stream, 2, StreamOffsetFromCurrent);
+}
+
+static bool flipper_format_stream_index_seek_to_key(
+    Stream* stream,
+    FlipperStreamIndex* index,
+    size_t start,
+    const char* key,
+    bool strict_mode) {
+    size_t count = FlipperStreamIndexEntryArray_size(index->entries);
+    if(count == 0) {
+        stream_seek(stream, 0, StreamOffsetFromEnd);
+        return false;
+    }
+
+    const FlipperStreamIndexEntry* entries = FlipperStreamIndexEntryArray_cget(index->entries, 0);
+    uint32_t hash = flipper_format_stream_index_hash_cstr(key);
+
+    if(strict_mode) {
+        // Only the next key matters
+        size_t low = 0;
+        size_t high = count;
+        while(low < high) {
+            size_t mid = (low + high) / 2;
+            if(entries[mid].line_start < start) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+
+        if(low == count) {
+            stream_seek(stream, 0, StreamOffsetFromEnd);
+            return false;
+        }
+
+        const FlipperStreamIndexEntry* entry = &entries[low];
+        if(entry->hash == hash && flipper_format_stream_index_key_equal(stream, entry, key)) {
+            return flipper_format_stream_index_seek_to_value(stream, entry);
+        }
+        stream_seek(stream, entry->delimiter, StreamOffsetFromStart);
+        return false;
+    }
+
+    // First entry with this hash at or after start
+    size_t low = 0;
+    size_t high = count;
+    while(low < high) {
+        size_t mid = (low + high) / 2;
+        const FlipperStreamIndexEntry* entry = &index->by_hash[mid];
+        if(entry->hash < hash || (entry->hash == hash && entry->line_start < start)) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    for(; low < count; low++) {
+        const FlipperStreamIndexEntry* entry = &index->by_hash[low];
+        if(entry->hash != hash) break;
+        if(flipper_format_stream_index_key_equal(stream, entry, key)) {
+            return flipper_format_stream_index_seek_to_value(stream, entry);
+        }
+    }
+
+    stream_seek(stream, 0, StreamOffsetFromEnd);
+    return false;
+}
+
+bool flipper_format_stream_seek_to_key_ex(
+    Stream* stream,
+    FlipperStreamIndex* index,
+    const char* key,
+    bool strict_mode) {
+    size_t start;
+    if(index && flipper_format_stream_index_is_valid(index, stream) &&
+       flipper_format_stream_index_get_start(stream, &start)) {
+        return flipper_format_stream_index_seek_to_key(stream, index, start, key, strict_mode);
+    }
+
+    return flipper_format_stream_seek_to_key(stream, key, strict_mode);
+}
+
 bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool strict_mode) {
     bool found = false;
     FuriString* read_key;
@@ -342,10 +614,22 @@ bool flipper_format_stream_read_value_line(
     void* _data,
     size_t data_size,
     bool strict_mode) {
+    return flipper_format_stream_read_value_line_ex(
+        stream, NULL, key, type, _data, data_size, strict_mode);
+}
+
+bool flipper_format_stream_read_value_line_ex(
+    Stream* stream,
+    FlipperStreamIndex* index,
+    const char* key,
+    FlipperStreamValue type,
+    void* _data,
+    size_t data_size,
+    bool strict_mode) {
     bool result = false;
 
     do {
-        if(!flipper_format_stream_seek_to_key(stream, key, strict_mode)) break;
+        if(!flipper_format_stream_seek_to_key_ex(stream, index, key, strict_mode)) break;
 
         if(type == FlipperStreamValueStr) {
             FuriString* data = (FuriString*)_data;
@@ -441,6 +725,15 @@ bool flipper_format_stream_get_value_count(
     const char* key,
     uint32_t* count,
     bool strict_mode) {
+    return flipper_format_stream_get_value_count_ex(stream, NULL, key, count, strict_mode);
+}
+
+bool flipper_format_stream_get_value_count_ex(
+    Stream* stream,
+    FlipperStreamIndex* index,
+    const char* key,
+    uint32_t* count,
+    bool strict_mode) {
     bool result = false;
     bool last = false;
 
@@ -449,7 +742,7 @@ bool flipper_format_stream_get_value_count(
 
     uint32_t position = stream_tell(stream);
     do {
-        if(!flipper_format_stream_seek_to_key(stream, key, strict_mode)) break;
+        if(!flipper_format_stream_seek_to_key_ex(stream, index, key, strict_mode)) break;
         *count = 0;
 
         result = true;
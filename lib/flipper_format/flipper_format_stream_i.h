@@ -29,6 +29,75 @@ bool flipper_format_stream_write_eol(Stream* stream);
  */
 bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool strict_mode);
 
+typedef struct FlipperStreamIndex FlipperStreamIndex;
+
+/**
+ * Build key index of the stream in one pass. Stream position is preserved.
+ * Index stays valid until the stream is changed.
+ * @param stream 
+ * @return FlipperStreamIndex* or NULL on stream error
+ */
+FlipperStreamIndex* flipper_format_stream_index_alloc(Stream* stream);
+
+/**
+ * Free key index
+ * @param index 
+ */
+void flipper_format_stream_index_free(FlipperStreamIndex* index);
+
+/**
+ * Check that the stream was not changed since the index was built
+ * @param index 
+ * @param stream 
+ * @return true index can be used
+ */
+bool flipper_format_stream_index_is_valid(FlipperStreamIndex* index, Stream* stream);
+
+/**
+ * Get the number of indexed keys, duplicates included
+ * @param index 
+ * @return size_t 
+ */
+size_t flipper_format_stream_index_get_count(FlipperStreamIndex* index);
+
+/**
+ * Same as flipper_format_stream_seek_to_key, but uses the index when it is valid
+ * and the stream is at a line boundary.
+ * @param stream 
+ * @param index may be NULL
+ * @param key 
+ * @param strict_mode 
+ * @return true key is found
+ * @return false key is not found
+ */
+bool flipper_format_stream_seek_to_key_ex(
+    Stream* stream,
+    FlipperStreamIndex* index,
+    const char* key,
+    bool strict_mode);
+
+/**
+ * Same as flipper_format_stream_read_value_line, with optional index
+ */
+bool flipper_format_stream_read_value_line_ex(
+    Stream* stream,
+    FlipperStreamIndex* index,
+    const char* key,
+    FlipperStreamValue type,
+    void* _data,
+    size_t data_size,
+    bool strict_mode);
+
+/**
+ * Same as flipper_format_stream_get_value_count, with optional index
+ */
+bool flipper_format_stream_get_value_count_ex(
+    Stream* stream,
+    FlipperStreamIndex* index,
+    const char* key,
+    uint32_t* count,
+    bool strict_mode);
+
 #ifdef __cplusplus
 }
 #endif
@@ -6,14 +6,11 @@
 
 static void infrared_common_decoder_reset_state(InfraredCommonDecoder* decoder);
 
-static inline size_t consume_samples(uint32_t* array, size_t len, size_t shift) {
-    furi_assert(len >= shift);
-    len -= shift;
-    for(size_t i = 0; i < len; ++i) {
-        array[i] = array[i + shift];
-    }
-
-    return len;
+static inline void consume_samples(InfraredCommonDecoder* decoder, size_t shift) {
+    furi_assert(decoder->timings_cnt >= shift);
+    decoder->timings_head =
+        (decoder->timings_head + shift) & (INFRARED_COMMON_DECODER_TIMINGS_SIZE - 1);
+    decoder->timings_cnt -= shift;
 }
 
 static inline void accumulate_lsb(InfraredCommonDecoder* decoder, bool bit) {
@@ -41,7 +38,7 @@ static bool infrared_check_preamble(InfraredCommonDecoder* decoder) {
 
     // align to start at Mark timing
     if(!start_level) {
-        decoder->timings_cnt = consume_samples(decoder->timings, decoder->timings_cnt, 1);
+        consume_samples(decoder, 1);
     }
 
     if(decoder->protocol->timings.preamble_mark == 0) {
@@ -53,12 +50,15 @@ static bool infrared_check_preamble(InfraredCommonDecoder* decoder) {
         uint16_t preamble_mark = decoder->protocol->timings.preamble_mark;
         uint16_t preamble_space = decoder->protocol->timings.preamble_space;
 
-        if((MATCH_TIMING(decoder->timings[0], preamble_mark, preamble_tolerance)) &&
-           (MATCH_TIMING(decoder->timings[1], preamble_space, preamble_tolerance))) {
+        uint32_t mark = infrared_common_decoder_get_timing(decoder, 0);
+        uint32_t space = infrared_common_decoder_get_timing(decoder, 1);
+
+        if((MATCH_TIMING(mark, preamble_mark, preamble_tolerance)) &&
+           (MATCH_TIMING(space, preamble_space, preamble_tolerance))) {
             result = true;
         }
 
-        decoder->timings_cnt = consume_samples(decoder->timings, decoder->timings_cnt, 2);
+        consume_samples(decoder, 2);
     }
 
     return result;
@@ -77,7 +77,7 @@ static InfraredStatus infrared_common_decode_bits(InfraredCommonDecoder* decoder
 
     while(decoder->timings_cnt && (status == InfraredStatusOk)) {
         bool level = (decoder->level + decoder->timings_cnt + 1) % 2;
-        uint32_t timing = decoder->timings[0];
+        uint32_t timing = infrared_common_decoder_get_timing(decoder, 0);
 
         if(timings->min_split_time && !level) {
             if(timing > timings->min_split_time) {
@@ -101,7 +101,7 @@ static InfraredStatus infrared_common_decode_bits(InfraredCommonDecoder* decoder
         if(status == InfraredStatusError) {
             break;
         }
-        decoder->timings_cnt = consume_samples(decoder->timings, decoder->timings_cnt, 1);
+        consume_samples(decoder, 1);
 
         /* check if largest protocol version can be decoded */
         if(level && (decoder->protocol->databit_len[0] == decoder->databit_cnt) && //-V1051
@@ -229,9 +229,11 @@ InfraredMessage*
     }
     decoder->level = level; // start with low level (Space timing)
 
-    decoder->timings[decoder->timings_cnt] = duration;
+    furi_check(decoder->timings_cnt < INFRARED_COMMON_DECODER_TIMINGS_SIZE);
+    decoder->timings
+        [(decoder->timings_head + decoder->timings_cnt) &
+         (INFRARED_COMMON_DECODER_TIMINGS_SIZE - 1)] = duration;
     decoder->timings_cnt++;
-    furi_check(decoder->timings_cnt <= sizeof(decoder->timings));
 
     while(1) {
         switch(decoder->state) {
@@ -303,11 +305,22 @@ void infrared_common_decoder_reset_state(InfraredCommonDecoder* decoder) {
     decoder->message.protocol = InfraredProtocolUnknown;
     if(decoder->protocol->timings.preamble_mark == 0) {
         if(decoder->timings_cnt > 0) {
-            decoder->timings_cnt = consume_samples(decoder->timings, decoder->timings_cnt, 1);
+            consume_samples(decoder, 1);
         }
     }
 }
 
+/**
+ * Idle decoder has nothing pending and its last timing was Space, so lone Space
+ * or Mark which doesn't match preamble would leave it in the very same state.
+ */
+bool infrared_common_decoder_is_idle(const InfraredCommonDecoder* decoder) {
+    furi_assert(decoder);
+
+    return (decoder->state == InfraredCommonDecoderStateWaitPreamble) &&
+           (decoder->timings_cnt == 0) && !decoder->level;
+}
+
 void infrared_common_decoder_reset(InfraredCommonDecoder* decoder) {
     furi_assert(decoder);
 
@@ -6,6 +6,9 @@
 
 #define MATCH_TIMING(x, v, delta) (((x) < ((v) + (delta))) && ((x) > ((v) - (delta))))
 
+/* Pending timings ring size, has to be power of 2 */
+#define INFRARED_COMMON_DECODER_TIMINGS_SIZE 8
+
 typedef struct InfraredCommonDecoder InfraredCommonDecoder;
 typedef struct InfraredCommonEncoder InfraredCommonEncoder;
 
@@ -43,9 +46,10 @@ typedef enum {
 struct InfraredCommonDecoder {
     const InfraredCommonProtocolSpec* protocol;
     void* context;
-    uint32_t timings[6];
+    uint32_t timings[INFRARED_COMMON_DECODER_TIMINGS_SIZE];
     InfraredMessage message;
     InfraredCommonStateDecoder state;
+    uint8_t timings_head;
     uint8_t timings_cnt;
     bool switch_detect;
     bool level;
@@ -65,6 +69,13 @@ struct InfraredCommonEncoder {
     uint8_t data[];
 };
 
+/** Get pending timing, index 0 is the oldest one */
+static inline uint32_t
+    infrared_common_decoder_get_timing(const InfraredCommonDecoder* decoder, size_t index) {
+    return decoder->timings
+        [(decoder->timings_head + index) & (INFRARED_COMMON_DECODER_TIMINGS_SIZE - 1)];
+}
+
 InfraredMessage*
     infrared_common_decode(InfraredCommonDecoder* decoder, bool level, uint32_t duration);
 InfraredStatus
@@ -75,6 +86,7 @@ void* infrared_common_decoder_alloc(const InfraredCommonProtocolSpec* protocol);
 void infrared_common_decoder_free(InfraredCommonDecoder* decoder);
 void infrared_common_decoder_reset(InfraredCommonDecoder* decoder);
 InfraredMessage* infrared_common_decoder_check_ready(InfraredCommonDecoder* decoder);
+bool infrared_common_decoder_is_idle(const InfraredCommonDecoder* decoder);
 
 InfraredStatus
     infrared_common_encode(InfraredCommonEncoder* encoder, uint32_t* duration, bool* polarity);
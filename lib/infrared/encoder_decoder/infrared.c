@@ -13,12 +13,22 @@
 #include "kaseikyo/infrared_protocol_kaseikyo.h"
 #include "rca/infrared_protocol_rca.h"
 
+#include "nec/infrared_protocol_nec_i.h"
+#include "samsung/infrared_protocol_samsung_i.h"
+#include "rc5/infrared_protocol_rc5_i.h"
+#include "rc6/infrared_protocol_rc6_i.h"
+#include "sirc/infrared_protocol_sirc_i.h"
+#include "kaseikyo/infrared_protocol_kaseikyo_i.h"
+#include "rca/infrared_protocol_rca_i.h"
+
 typedef struct {
     InfraredAlloc alloc;
     InfraredDecode decode;
     InfraredDecoderReset reset;
     InfraredFree free;
     InfraredDecoderCheckReady check_ready;
+    InfraredDecoderIsIdle is_idle;
+    const InfraredTimings* timings;
 } InfraredDecoders;
 
 typedef struct {
@@ -28,8 +38,17 @@ typedef struct {
     InfraredFree free;
 } InfraredEncoders;
 
+/*
+ * Most of the time all decoders but one (or all of them) wait for preamble.
+ * Instead of feeding every edge to every decoder, Mark is matched against all
+ * preambles at once and only decoders which are busy, have no preamble at all
+ * or whose preamble mark matched get the edge.
+ */
 struct InfraredDecoderHandler {
     void** ctx;
+    uint32_t busy; /* decoders that have to get every edge */
+    uint32_t gated; /* decoders that can skip edges while idle */
+    bool level;
 };
 
 struct InfraredEncoderHandler {
@@ -50,6 +69,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_nec_decode,
              .reset = infrared_decoder_nec_reset,
              .check_ready = infrared_decoder_nec_check_ready,
+             .is_idle = infrared_decoder_nec_is_idle,
+             .timings = &infrared_protocol_nec.timings,
              .free = infrared_decoder_nec_free},
         .encoder =
             {.alloc = infrared_encoder_nec_alloc,
@@ -64,6 +85,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_samsung32_decode,
              .reset = infrared_decoder_samsung32_reset,
              .check_ready = infrared_decoder_samsung32_check_ready,
+             .is_idle = infrared_decoder_samsung32_is_idle,
+             .timings = &infrared_protocol_samsung32.timings,
              .free = infrared_decoder_samsung32_free},
         .encoder =
             {.alloc = infrared_encoder_samsung32_alloc,
@@ -78,6 +101,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_rc5_decode,
              .reset = infrared_decoder_rc5_reset,
              .check_ready = infrared_decoder_rc5_check_ready,
+             .is_idle = infrared_decoder_rc5_is_idle,
+             .timings = &infrared_protocol_rc5.timings,
              .free = infrared_decoder_rc5_free},
         .encoder =
             {.alloc = infrared_encoder_rc5_alloc,
@@ -92,6 +117,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_rc6_decode,
              .reset = infrared_decoder_rc6_reset,
              .check_ready = infrared_decoder_rc6_check_ready,
+             .is_idle = infrared_decoder_rc6_is_idle,
+             .timings = &infrared_protocol_rc6.timings,
              .free = infrared_decoder_rc6_free},
         .encoder =
             {.alloc = infrared_encoder_rc6_alloc,
@@ -106,6 +133,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_sirc_decode,
              .reset = infrared_decoder_sirc_reset,
              .check_ready = infrared_decoder_sirc_check_ready,
+             .is_idle = infrared_decoder_sirc_is_idle,
+             .timings = &infrared_protocol_sirc.timings,
              .free = infrared_decoder_sirc_free},
         .encoder =
             {.alloc = infrared_encoder_sirc_alloc,
@@ -120,6 +149,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_kaseikyo_decode,
              .reset = infrared_decoder_kaseikyo_reset,
              .check_ready = infrared_decoder_kaseikyo_check_ready,
+             .is_idle = infrared_decoder_kaseikyo_is_idle,
+             .timings = &infrared_protocol_kaseikyo.timings,
              .free = infrared_decoder_kaseikyo_free},
         .encoder =
             {.alloc = infrared_encoder_kaseikyo_alloc,
@@ -134,6 +165,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_rca_decode,
              .reset = infrared_decoder_rca_reset,
              .check_ready = infrared_decoder_rca_check_ready,
+             .is_idle = infrared_decoder_rca_is_idle,
+             .timings = &infrared_protocol_rca.timings,
              .free = infrared_decoder_rca_free},
         .encoder =
             {.alloc = infrared_encoder_rca_alloc,
@@ -147,6 +180,36 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
 static int infrared_find_index_by_protocol(InfraredProtocol protocol);
 static const InfraredProtocolVariant* infrared_get_variant_by_protocol(InfraredProtocol protocol);
 
+_Static_assert(
+    COUNT_OF(infrared_encoder_decoder) <= 32,
+    "Too many decoders for InfraredDecoderHandler masks");
+
+static void infrared_update_busy(InfraredDecoderHandler* handler, size_t index) {
+    const uint32_t bit = 1UL << index;
+
+    if(handler->gated & bit) {
+        if(infrared_encoder_decoder[index].decoder.is_idle(handler->ctx[index])) {
+            handler->busy &= ~bit;
+        } else {
+            handler->busy |= bit;
+        }
+    }
+}
+
+static uint32_t infrared_match_preamble(InfraredDecoderHandler* handler, uint32_t duration) {
+    uint32_t matched = 0;
+
+    for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
+        const InfraredTimings* timings = infrared_encoder_decoder[i].decoder.timings;
+        if((handler->gated & (1UL << i)) &&
+           MATCH_TIMING(duration, timings->preamble_mark, timings->preamble_tolerance)) {
+            matched |= 1UL << i;
+        }
+    }
+
+    return matched;
+}
+
 const InfraredMessage*
     infrared_decode(InfraredDecoderHandler* handler, bool level, uint32_t duration) {
     furi_assert(handler);
@@ -154,12 +217,28 @@ const InfraredMessage*
     InfraredMessage* message = NULL;
     InfraredMessage* result = NULL;
 
+    if(level == handler->level) {
+        /* Same level twice resets decoders, idle ones too */
+        for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
+            if((handler->gated & ~handler->busy) & (1UL << i)) {
+                infrared_encoder_decoder[i].decoder.reset(handler->ctx[i]);
+            }
+        }
+    }
+    handler->level = level;
+
+    uint32_t dispatch = ~handler->gated | handler->busy;
+    if(level) {
+        dispatch |= infrared_match_preamble(handler, duration);
+    }
+
     for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
-        if(infrared_encoder_decoder[i].decoder.decode) {
+        if((dispatch & (1UL << i)) && infrared_encoder_decoder[i].decoder.decode) {
             message = infrared_encoder_decoder[i].decoder.decode(handler->ctx[i], level, duration);
             if(!result && message) {
                 result = message;
             }
+            infrared_update_busy(handler, i);
         }
     }
 
@@ -171,11 +250,17 @@ InfraredDecoderHandler* infrared_alloc_decoder(void) {
     handler->ctx = malloc(sizeof(void*) * COUNT_OF(infrared_encoder_decoder));
 
     for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
+        const InfraredDecoders* decoder = &infrared_encoder_decoder[i].decoder;
         handler->ctx[i] = 0;
-        if(infrared_encoder_decoder[i].decoder.alloc)
-            handler->ctx[i] = infrared_encoder_decoder[i].decoder.alloc();
+        if(decoder->alloc) handler->ctx[i] = decoder->alloc();
+        if(decoder->is_idle && decoder->timings && decoder->timings->preamble_mark) {
+            handler->gated |= 1UL << i;
+        }
     }
 
+    /* Matches initial level of decoders */
+    handler->level = true;
+
     infrared_reset_decoder(handler);
     return handler;
 }
@@ -197,6 +282,7 @@ void infrared_reset_decoder(InfraredDecoderHandler* handler) {
     for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
         if(infrared_encoder_decoder[i].decoder.reset)
             infrared_encoder_decoder[i].decoder.reset(handler->ctx[i]);
+        infrared_update_busy(handler, i);
     }
 }
 
@@ -212,6 +298,7 @@ const InfraredMessage* infrared_check_decoder_ready(InfraredDecoderHandler* hand
             if(!result && message) {
                 result = message;
             }
+            infrared_update_busy(handler, i);
         }
     }
 
@@ -66,11 +66,15 @@ InfraredStatus infrared_decoder_nec_decode_repeat(InfraredCommonDecoder* decoder
 
     if(decoder->timings_cnt < 4) return InfraredStatusOk;
 
-    if((decoder->timings[0] > INFRARED_NEC_REPEAT_PAUSE_MIN) &&
-       (decoder->timings[0] < INFRARED_NEC_REPEAT_PAUSE_MAX) &&
-       MATCH_TIMING(decoder->timings[1], INFRARED_NEC_REPEAT_MARK, preamble_tolerance) &&
-       MATCH_TIMING(decoder->timings[2], INFRARED_NEC_REPEAT_SPACE, preamble_tolerance) &&
-       MATCH_TIMING(decoder->timings[3], decoder->protocol->timings.bit1_mark, bit_tolerance)) {
+    uint32_t pause = infrared_common_decoder_get_timing(decoder, 0);
+    uint32_t repeat_mark = infrared_common_decoder_get_timing(decoder, 1);
+    uint32_t repeat_space = infrared_common_decoder_get_timing(decoder, 2);
+    uint32_t bit1_mark = decoder->protocol->timings.bit1_mark;
+
+    if((pause > INFRARED_NEC_REPEAT_PAUSE_MIN) && (pause < INFRARED_NEC_REPEAT_PAUSE_MAX) &&
+       MATCH_TIMING(repeat_mark, INFRARED_NEC_REPEAT_MARK, preamble_tolerance) &&
+       MATCH_TIMING(repeat_space, INFRARED_NEC_REPEAT_SPACE, preamble_tolerance) &&
+       MATCH_TIMING(infrared_common_decoder_get_timing(decoder, 3), bit1_mark, bit_tolerance)) {
         status = InfraredStatusReady;
         decoder->timings_cnt = 0;
     } else {
@@ -95,3 +99,7 @@ void infrared_decoder_nec_free(void* decoder) {
 void infrared_decoder_nec_reset(void* decoder) {
     infrared_common_decoder_reset(decoder);
 }
+
+bool infrared_decoder_nec_is_idle(void* decoder) {
+    return infrared_common_decoder_is_idle(decoder);
+}
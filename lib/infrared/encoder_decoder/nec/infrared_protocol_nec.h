@@ -20,6 +20,7 @@ void* infrared_decoder_nec_alloc(void);
 void infrared_decoder_nec_reset(void* decoder);
 void infrared_decoder_nec_free(void* decoder);
 InfraredMessage* infrared_decoder_nec_check_ready(void* decoder);
+bool infrared_decoder_nec_is_idle(void* decoder);
 InfraredMessage* infrared_decoder_nec_decode(void* decoder, bool level, uint32_t duration);
 
 void* infrared_encoder_nec_alloc(void);
@@ -27,6 +27,7 @@ void* infrared_decoder_rc6_alloc(void);
 void infrared_decoder_rc6_reset(void* decoder);
 void infrared_decoder_rc6_free(void* decoder);
 InfraredMessage* infrared_decoder_rc6_check_ready(void* ctx);
+bool infrared_decoder_rc6_is_idle(void* decoder);
 InfraredMessage* infrared_decoder_rc6_decode(void* decoder, bool level, uint32_t duration);
 
 void* infrared_encoder_rc6_alloc(void);
@@ -43,3 +43,7 @@ void infrared_decoder_rca_free(void* decoder) {
 void infrared_decoder_rca_reset(void* decoder) {
     infrared_common_decoder_reset(decoder);
 }
+
+bool infrared_decoder_rca_is_idle(void* decoder) {
+    return infrared_common_decoder_is_idle(decoder);
+}
@@ -36,13 +36,19 @@ InfraredStatus infrared_decoder_samsung32_decode_repeat(InfraredCommonDecoder* d
 
     if(decoder->timings_cnt < 6) return InfraredStatusOk;
 
-    if((decoder->timings[0] > INFRARED_SAMSUNG_REPEAT_PAUSE_MIN) &&
-       (decoder->timings[0] < INFRARED_SAMSUNG_REPEAT_PAUSE_MAX) &&
-       MATCH_TIMING(decoder->timings[1], INFRARED_SAMSUNG_REPEAT_MARK, preamble_tolerance) &&
-       MATCH_TIMING(decoder->timings[2], INFRARED_SAMSUNG_REPEAT_SPACE, preamble_tolerance) &&
-       MATCH_TIMING(decoder->timings[3], decoder->protocol->timings.bit1_mark, bit_tolerance) &&
-       MATCH_TIMING(decoder->timings[4], decoder->protocol->timings.bit1_space, bit_tolerance) &&
-       MATCH_TIMING(decoder->timings[5], decoder->protocol->timings.bit1_mark, bit_tolerance)) {
+    uint32_t pause = infrared_common_decoder_get_timing(decoder, 0);
+    uint32_t repeat_mark = infrared_common_decoder_get_timing(decoder, 1);
+    uint32_t repeat_space = infrared_common_decoder_get_timing(decoder, 2);
+    uint32_t bit1_mark = decoder->protocol->timings.bit1_mark;
+    uint32_t bit1_space = decoder->protocol->timings.bit1_space;
+
+    if((pause > INFRARED_SAMSUNG_REPEAT_PAUSE_MIN) &&
+       (pause < INFRARED_SAMSUNG_REPEAT_PAUSE_MAX) &&
+       MATCH_TIMING(repeat_mark, INFRARED_SAMSUNG_REPEAT_MARK, preamble_tolerance) &&
+       MATCH_TIMING(repeat_space, INFRARED_SAMSUNG_REPEAT_SPACE, preamble_tolerance) &&
+       MATCH_TIMING(infrared_common_decoder_get_timing(decoder, 3), bit1_mark, bit_tolerance) &&
+       MATCH_TIMING(infrared_common_decoder_get_timing(decoder, 4), bit1_space, bit_tolerance) &&
+       MATCH_TIMING(infrared_common_decoder_get_timing(decoder, 5), bit1_mark, bit_tolerance)) {
         status = InfraredStatusReady;
         decoder->timings_cnt = 0;
     } else {
@@ -67,3 +73,7 @@ void infrared_decoder_samsung32_free(void* decoder) {
 void infrared_decoder_samsung32_reset(void* decoder) {
     infrared_common_decoder_reset(decoder);
 }
+
+bool infrared_decoder_samsung32_is_idle(void* decoder) {
+    return infrared_common_decoder_is_idle(decoder);
+}
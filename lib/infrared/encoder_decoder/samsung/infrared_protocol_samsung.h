@@ -20,6 +20,7 @@ void* infrared_decoder_samsung32_alloc(void);
 void infrared_decoder_samsung32_reset(void* decoder);
 void infrared_decoder_samsung32_free(void* decoder);
 InfraredMessage* infrared_decoder_samsung32_check_ready(void* ctx);
+bool infrared_decoder_samsung32_is_idle(void* decoder);
 InfraredMessage* infrared_decoder_samsung32_decode(void* decoder, bool level, uint32_t duration);
 
 InfraredStatus
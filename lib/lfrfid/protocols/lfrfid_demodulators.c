@@ -0,0 +1,161 @@
+#include <furi.h>
+#include <toolbox/manchester_decoder.h>
+#include <lfrfid/tools/fsk_demod.h>
+#include "lfrfid_demodulators.h"
+
+#define FSK_JITTER_TIME (20)
+#define FSK_MIN_TIME (64 - FSK_JITTER_TIME)
+#define FSK_MAX_TIME (80 + FSK_JITTER_TIME)
+
+#define MANCHESTER_RF32_SHORT_TIME (128)
+#define MANCHESTER_RF32_LONG_TIME (256)
+#define MANCHESTER_RF32_JITTER_TIME (60)
+
+#define MANCHESTER_RF32_SHORT_TIME_LOW (MANCHESTER_RF32_SHORT_TIME - MANCHESTER_RF32_JITTER_TIME)
+#define MANCHESTER_RF32_SHORT_TIME_HIGH (MANCHESTER_RF32_SHORT_TIME + MANCHESTER_RF32_JITTER_TIME)
+#define MANCHESTER_RF32_LONG_TIME_LOW (MANCHESTER_RF32_LONG_TIME - MANCHESTER_RF32_JITTER_TIME)
+#define MANCHESTER_RF32_LONG_TIME_HIGH (MANCHESTER_RF32_LONG_TIME + MANCHESTER_RF32_JITTER_TIME)
+
+#define PSK_US_PER_BIT (255)
+#define PSK_PHASE_SHIFT_TIME (120)
+
+/*********************** FSK ***********************/
+
+typedef struct {
+    FSKDemod* fsk_demod;
+    LFRFIDFSKSymbols symbols;
+} LFRFIDDemodulatorFSK;
+
+static LFRFIDDemodulatorFSK* lfrfid_demodulator_fsk_alloc(void) {
+    LFRFIDDemodulatorFSK* demodulator = malloc(sizeof(LFRFIDDemodulatorFSK));
+    // Periods per bit are protocol specific, so report whole runs
+    demodulator->fsk_demod = fsk_demod_alloc(FSK_MIN_TIME, 1, FSK_MAX_TIME, 1);
+    return demodulator;
+}
+
+static void lfrfid_demodulator_fsk_free(LFRFIDDemodulatorFSK* demodulator) {
+    fsk_demod_free(demodulator->fsk_demod);
+    free(demodulator);
+}
+
+static const LFRFIDFSKSymbols*
+    lfrfid_demodulator_fsk_feed(LFRFIDDemodulatorFSK* demodulator, bool level, uint32_t duration) {
+    uint32_t count;
+    fsk_demod_feed(demodulator->fsk_demod, level, duration, &demodulator->symbols.value, &count);
+    if(count == 0) return NULL;
+
+    demodulator->symbols.pulses = count;
+    return &demodulator->symbols;
+}
+
+const ProtocolDemodulator lfrfid_demodulator_fsk = {
+    .alloc = (ProtocolAlloc)lfrfid_demodulator_fsk_alloc,
+    .free = (ProtocolFree)lfrfid_demodulator_fsk_free,
+    .start = NULL,
+    .feed = (ProtocolDemodulatorFeed)lfrfid_demodulator_fsk_feed,
+};
+
+/*********************** MANCHESTER ***********************/
+
+typedef struct {
+    ManchesterState state;
+    LFRFIDManchesterSymbols symbols;
+} LFRFIDDemodulatorManchester;
+
+static LFRFIDDemodulatorManchester* lfrfid_demodulator_manchester_alloc(void) {
+    LFRFIDDemodulatorManchester* demodulator = malloc(sizeof(LFRFIDDemodulatorManchester));
+    return demodulator;
+}
+
+static void lfrfid_demodulator_manchester_free(LFRFIDDemodulatorManchester* demodulator) {
+    free(demodulator);
+}
+
+static void lfrfid_demodulator_manchester_start(LFRFIDDemodulatorManchester* demodulator) {
+    manchester_advance(demodulator->state, ManchesterEventReset, &demodulator->state, NULL);
+}
+
+static const LFRFIDManchesterSymbols* lfrfid_demodulator_manchester_rf32_feed(
+    LFRFIDDemodulatorManchester* demodulator,
+    bool level,
+    uint32_t duration) {
+    ManchesterEvent event = ManchesterEventReset;
+
+    if(duration > MANCHESTER_RF32_SHORT_TIME_LOW && duration < MANCHESTER_RF32_SHORT_TIME_HIGH) {
+        if(!level) {
+            event = ManchesterEventShortHigh;
+        } else {
+            event = ManchesterEventShortLow;
+        }
+    } else if(
+        duration > MANCHESTER_RF32_LONG_TIME_LOW && duration < MANCHESTER_RF32_LONG_TIME_HIGH) {
+        if(!level) {
+            event = ManchesterEventLongHigh;
+        } else {
+            event = ManchesterEventLongLow;
+        }
+    }
+
+    if(event == ManchesterEventReset) return NULL;
+
+    bool data_ok = manchester_advance(
+        demodulator->state, event, &demodulator->state, &demodulator->symbols.bit);
+    return data_ok ? &demodulator->symbols : NULL;
+}
+
+const ProtocolDemodulator lfrfid_demodulator_manchester_rf32 = {
+    .alloc = (ProtocolAlloc)lfrfid_demodulator_manchester_alloc,
+    .free = (ProtocolFree)lfrfid_demodulator_manchester_free,
+    .start = (ProtocolDemodulatorStart)lfrfid_demodulator_manchester_start,
+    .feed = (ProtocolDemodulatorFeed)lfrfid_demodulator_manchester_rf32_feed,
+};
+
+/*********************** PSK ***********************/
+
+typedef struct {
+    LFRFIDPSKSymbols symbols;
+} LFRFIDDemodulatorPSK;
+
+static LFRFIDDemodulatorPSK* lfrfid_demodulator_psk_alloc(void) {
+    LFRFIDDemodulatorPSK* demodulator = malloc(sizeof(LFRFIDDemodulatorPSK));
+    return demodulator;
+}
+
+static void lfrfid_demodulator_psk_free(LFRFIDDemodulatorPSK* demodulator) {
+    free(demodulator);
+}
+
+static const LFRFIDPSKSymbols*
+    lfrfid_demodulator_psk_feed(LFRFIDDemodulatorPSK* demodulator, bool level, uint32_t duration) {
+    LFRFIDPSKSymbols* symbols = &demodulator->symbols;
+    symbols->level = level;
+    symbols->bit_count = 0;
+    symbols->corrupted_bit_count = 0;
+
+    if(duration > (PSK_US_PER_BIT / 2)) {
+        symbols->bit_count = (duration + PSK_US_PER_BIT / 2) / PSK_US_PER_BIT;
+    }
+
+    if(duration > (PSK_US_PER_BIT / 4)) {
+        // Try to decode wrong phase synced data
+        if(level) {
+            duration += PSK_PHASE_SHIFT_TIME;
+        } else {
+            if(duration > PSK_PHASE_SHIFT_TIME) {
+                duration -= PSK_PHASE_SHIFT_TIME;
+            }
+        }
+
+        symbols->corrupted_bit_count = (duration + PSK_US_PER_BIT / 2) / PSK_US_PER_BIT;
+    }
+
+    if(symbols->bit_count == 0 && symbols->corrupted_bit_count == 0) return NULL;
+    return symbols;
+}
+
+const ProtocolDemodulator lfrfid_demodulator_psk = {
+    .alloc = (ProtocolAlloc)lfrfid_demodulator_psk_alloc,
+    .free = (ProtocolFree)lfrfid_demodulator_psk_free,
+    .start = NULL,
+    .feed = (ProtocolDemodulatorFeed)lfrfid_demodulator_psk_feed,
+};
@@ -0,0 +1,45 @@
+#pragma once
+#include <toolbox/protocols/protocol.h>
+
+/**
+ * Demodulators shared by LF RFID protocols, see ProtocolDemodulator.
+ * Protocol dict runs each of them once per edge, instead of every protocol
+ * demodulating the same edge stream on its own.
+ */
+
+/** FSK2a, RF/8 and RF/10 periods */
+typedef struct {
+    bool value; /** true for RF/10 periods */
+    uint32_t pulses; /** periods count in the run */
+} LFRFIDFSKSymbols;
+
+/** Manchester, RF/32 bitrate */
+typedef struct {
+    bool bit;
+} LFRFIDManchesterSymbols;
+
+/** PSK1, RF/2 carrier and 255us bits */
+typedef struct {
+    bool level;
+    uint32_t bit_count; /** bits in the edge */
+    uint32_t corrupted_bit_count; /** bits in the edge, for wrong phase synced data */
+} LFRFIDPSKSymbols;
+
+extern const ProtocolDemodulator lfrfid_demodulator_fsk;
+extern const ProtocolDemodulator lfrfid_demodulator_manchester_rf32;
+extern const ProtocolDemodulator lfrfid_demodulator_psk;
+
+/**
+ * @brief Get bit count of FSK run
+ *
+ * @param symbols FSK run
+ * @param low_pulses RF/8 periods per bit
+ * @param hi_pulses RF/10 periods per bit
+ * @return uint32_t
+ */
+static inline uint32_t lfrfid_fsk_symbols_bit_count(
+    const LFRFIDFSKSymbols* symbols,
+    uint32_t low_pulses,
+    uint32_t hi_pulses) {
+    return symbols->pulses / (symbols->value ? hi_pulses : low_pulses);
+}
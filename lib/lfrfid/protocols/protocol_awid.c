@@ -1,13 +1,9 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
-#include <lfrfid/tools/fsk_demod.h>
 #include <lfrfid/tools/fsk_osc.h>
 #include <lfrfid/tools/bit_lib.h>
 #include "lfrfid_protocols.h"
-
-#define JITTER_TIME (20)
-#define MIN_TIME (64 - JITTER_TIME)
-#define MAX_TIME (80 + JITTER_TIME)
+#include "lfrfid_demodulators.h"
 
 #define AWID_DECODED_DATA_SIZE (9)
 
@@ -15,32 +11,29 @@
 #define AWID_ENCODED_DATA_SIZE (((AWID_ENCODED_BIT_SIZE) / 8) + 1)
 #define AWID_ENCODED_DATA_LAST (AWID_ENCODED_DATA_SIZE - 1)
 
-typedef struct {
-    FSKDemod* fsk_demod;
-} ProtocolAwidDecoder;
-
 typedef struct {
     FSKOsc* fsk_osc;
     uint8_t encoded_index;
 } ProtocolAwidEncoder;
 
 typedef struct {
-    ProtocolAwidDecoder decoder;
     ProtocolAwidEncoder encoder;
     uint8_t encoded_data[AWID_ENCODED_DATA_SIZE];
+    BitLibWindow encoded_window;
+    uint8_t encoded_window_buffer[BIT_LIB_WINDOW_BUFFER_SIZE(AWID_ENCODED_DATA_SIZE)];
     uint8_t data[AWID_DECODED_DATA_SIZE];
 } ProtocolAwid;
 
 ProtocolAwid* protocol_awid_alloc(void) {
     ProtocolAwid* protocol = malloc(sizeof(ProtocolAwid));
-    protocol->decoder.fsk_demod = fsk_demod_alloc(MIN_TIME, 6, MAX_TIME, 5);
     protocol->encoder.fsk_osc = fsk_osc_alloc(8, 10, 50);
+    bit_lib_window_init(
+        &protocol->encoded_window, protocol->encoded_window_buffer, AWID_ENCODED_DATA_SIZE);
 
     return protocol;
 };
 
 void protocol_awid_free(ProtocolAwid* protocol) {
-    fsk_demod_free(protocol->decoder.fsk_demod);
     fsk_osc_free(protocol->encoder.fsk_osc);
     free(protocol);
 };
@@ -51,9 +44,12 @@ uint8_t* protocol_awid_get_data(ProtocolAwid* protocol) {
 
 void protocol_awid_decoder_start(ProtocolAwid* protocol) {
     memset(protocol->encoded_data, 0, AWID_ENCODED_DATA_SIZE);
+    bit_lib_window_reset(&protocol->encoded_window);
 };
 
-static bool protocol_awid_can_be_decoded(uint8_t* data) {
+static bool protocol_awid_can_be_decoded(ProtocolAwid* protocol) {
+    const BitLibWindow* window = &protocol->encoded_window;
+    uint8_t* data = protocol->encoded_data;
     bool result = false;
 
     // Index map
@@ -71,7 +67,12 @@ static bool protocol_awid_can_be_decoded(uint8_t* data) {
 
     do {
         // check preamble and spacing
-        if(data[0] != 0b00000001 || data[AWID_ENCODED_DATA_LAST] != 0b00000001) break;
+        if(bit_lib_window_get_bits(window, 0, 8) != 0b00000001 ||
+           bit_lib_window_get_bits(window, AWID_ENCODED_DATA_LAST * 8, 8) != 0b00000001)
+            break;
+
+        // the rest is checked on a plain copy
+        bit_lib_window_copy(window, data);
 
         // check odd parity for every 4 bits starting from the second byte
         bool parity_error = bit_lib_test_parity(data, 8, 88, BitLibParityOdd, 4);
@@ -93,16 +94,15 @@ static void protocol_awid_decode(uint8_t* encoded_data, uint8_t* decoded_data) {
     bit_lib_copy_bits(decoded_data, 0, 66, encoded_data, 8);
 }
 
-bool protocol_awid_decoder_feed(ProtocolAwid* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
+bool protocol_awid_decoder_feed(ProtocolAwid* protocol, const LFRFIDFSKSymbols* symbols) {
+    bool value = symbols->value;
+    uint32_t count = lfrfid_fsk_symbols_bit_count(symbols, 6, 5);
     bool result = false;
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     if(count > 0) {
         for(size_t i = 0; i < count; i++) {
-            bit_lib_push_bit(protocol->encoded_data, AWID_ENCODED_DATA_SIZE, value);
-            if(protocol_awid_can_be_decoded(protocol->encoded_data)) {
+            bit_lib_window_push_bit(&protocol->encoded_window, value);
+            if(protocol_awid_can_be_decoded(protocol)) {
                 protocol_awid_decode(protocol->encoded_data, protocol->data);
 
                 result = true;
@@ -242,7 +242,8 @@ const ProtocolBase protocol_awid = {
     .decoder =
         {
             .start = (ProtocolDecoderStart)protocol_awid_decoder_start,
-            .feed = (ProtocolDecoderFeed)protocol_awid_decoder_feed,
+            .demodulator = &lfrfid_demodulator_fsk,
+            .feed_demodulated = (ProtocolDecoderFeedDemodulated)protocol_awid_decoder_feed,
         },
     .encoder =
         {
@@ -1,14 +1,10 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
-#include <lfrfid/tools/fsk_demod.h>
 #include <lfrfid/tools/fsk_osc.h>
 #include "lfrfid_protocols.h"
+#include "lfrfid_demodulators.h"
 #include <lfrfid/tools/bit_lib.h>
 
-#define JITTER_TIME (20)
-#define MIN_TIME (64 - JITTER_TIME)
-#define MAX_TIME (80 + JITTER_TIME)
-
 #define FDXA_DATA_SIZE 10
 #define FDXA_PREAMBLE_SIZE 2
 
@@ -20,10 +16,6 @@
 #define FDXA_PREAMBLE_0 0x55
 #define FDXA_PREAMBLE_1 0x1D
 
-typedef struct {
-    FSKDemod* fsk_demod;
-} ProtocolFDXADecoder;
-
 typedef struct {
     FSKOsc* fsk_osc;
     uint8_t encoded_index;
@@ -31,23 +23,24 @@ typedef struct {
 } ProtocolFDXAEncoder;
 
 typedef struct {
-    ProtocolFDXADecoder decoder;
     ProtocolFDXAEncoder encoder;
     uint8_t encoded_data[FDXA_ENCODED_DATA_SIZE];
+    BitLibWindow encoded_window;
+    uint8_t encoded_window_buffer[BIT_LIB_WINDOW_BUFFER_SIZE(FDXA_ENCODED_DATA_SIZE)];
     uint8_t data[FDXA_DECODED_DATA_SIZE];
     size_t protocol_size;
 } ProtocolFDXA;
 
 ProtocolFDXA* protocol_fdx_a_alloc(void) {
     ProtocolFDXA* protocol = malloc(sizeof(ProtocolFDXA));
-    protocol->decoder.fsk_demod = fsk_demod_alloc(MIN_TIME, 6, MAX_TIME, 5);
     protocol->encoder.fsk_osc = fsk_osc_alloc(8, 10, 50);
+    bit_lib_window_init(
+        &protocol->encoded_window, protocol->encoded_window_buffer, FDXA_ENCODED_DATA_SIZE);
 
     return protocol;
 };
 
 void protocol_fdx_a_free(ProtocolFDXA* protocol) {
-    fsk_demod_free(protocol->decoder.fsk_demod);
     fsk_osc_free(protocol->encoder.fsk_osc);
     free(protocol);
 };
@@ -58,6 +51,7 @@ uint8_t* protocol_fdx_a_get_data(ProtocolFDXA* protocol) {
 
 void protocol_fdx_a_decoder_start(ProtocolFDXA* protocol) {
     memset(protocol->encoded_data, 0, FDXA_ENCODED_DATA_SIZE);
+    bit_lib_window_reset(&protocol->encoded_window);
 };
 
 static bool protocol_fdx_a_decode(const uint8_t* from, uint8_t* to) {
@@ -87,13 +81,19 @@ static void protocol_fdx_a_fix_parity(ProtocolFDXA* protocol) {
     }
 }
 
-static bool protocol_fdx_a_can_be_decoded(const uint8_t* data) {
+static bool protocol_fdx_a_can_be_decoded(ProtocolFDXA* protocol) {
+    const BitLibWindow* window = &protocol->encoded_window;
+    uint8_t* data = protocol->encoded_data;
+
     // check preamble
-    if(data[0] != FDXA_PREAMBLE_0 || data[1] != FDXA_PREAMBLE_1 || data[12] != FDXA_PREAMBLE_0 ||
-       data[13] != FDXA_PREAMBLE_1) {
+    const uint16_t preamble = (FDXA_PREAMBLE_0 << 8) | FDXA_PREAMBLE_1;
+    if(bit_lib_window_get_bits_16(window, 0, 16) != preamble ||
+       bit_lib_window_get_bits_16(window, 96, 16) != preamble) {
         return false;
     }
 
+    bit_lib_window_copy(window, data);
+
     // check for manchester encoding
     uint8_t decoded_data[FDXA_DECODED_DATA_SIZE];
     if(!protocol_fdx_a_decode(data, decoded_data)) return false;
@@ -107,16 +107,15 @@ static bool protocol_fdx_a_can_be_decoded(const uint8_t* data) {
     return (parity_sum == 0);
 }
 
-bool protocol_fdx_a_decoder_feed(ProtocolFDXA* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
+bool protocol_fdx_a_decoder_feed(ProtocolFDXA* protocol, const LFRFIDFSKSymbols* symbols) {
+    bool value = symbols->value;
+    uint32_t count = lfrfid_fsk_symbols_bit_count(symbols, 6, 5);
     bool result = false;
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     if(count > 0) {
         for(size_t i = 0; i < count; i++) {
-            bit_lib_push_bit(protocol->encoded_data, FDXA_ENCODED_DATA_SIZE, value);
-            if(protocol_fdx_a_can_be_decoded(protocol->encoded_data)) {
+            bit_lib_window_push_bit(&protocol->encoded_window, value);
+            if(protocol_fdx_a_can_be_decoded(protocol)) {
                 protocol_fdx_a_decode(protocol->encoded_data, protocol->data);
                 result = true;
             }
@@ -239,7 +238,8 @@ const ProtocolBase protocol_fdx_a = {
     .decoder =
         {
             .start = (ProtocolDecoderStart)protocol_fdx_a_decoder_start,
-            .feed = (ProtocolDecoderFeed)protocol_fdx_a_decoder_feed,
+            .demodulator = &lfrfid_demodulator_fsk,
+            .feed_demodulated = (ProtocolDecoderFeedDemodulated)protocol_fdx_a_decoder_feed,
         },
     .encoder =
         {
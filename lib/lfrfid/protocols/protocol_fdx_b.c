@@ -28,11 +28,15 @@ typedef struct {
     bool last_level;
     size_t encoded_index;
     uint8_t encoded_data[FDX_B_ENCODED_BYTE_FULL_SIZE];
+    BitLibWindow encoded_window;
+    uint8_t encoded_window_buffer[BIT_LIB_WINDOW_BUFFER_SIZE(FDX_B_ENCODED_BYTE_FULL_SIZE)];
     uint8_t data[FDXB_DECODED_DATA_SIZE];
 } ProtocolFDXB;
 
 ProtocolFDXB* protocol_fdx_b_alloc(void) {
     ProtocolFDXB* protocol = malloc(sizeof(ProtocolFDXB));
+    bit_lib_window_init(
+        &protocol->encoded_window, protocol->encoded_window_buffer, FDX_B_ENCODED_BYTE_FULL_SIZE);
     return protocol;
 };
 
@@ -46,10 +50,12 @@ uint8_t* protocol_fdx_b_get_data(ProtocolFDXB* proto) {
 
 void protocol_fdx_b_decoder_start(ProtocolFDXB* protocol) {
     memset(protocol->encoded_data, 0, FDX_B_ENCODED_BYTE_FULL_SIZE);
+    bit_lib_window_reset(&protocol->encoded_window);
     protocol->last_short = false;
 };
 
 static bool protocol_fdx_b_can_be_decoded(ProtocolFDXB* protocol) {
+    const BitLibWindow* window = &protocol->encoded_window;
     bool result = false;
 
     /*
@@ -72,9 +78,11 @@ static bool protocol_fdx_b_can_be_decoded(ProtocolFDXB* protocol) {
 
     do {
         // check 11 bits preamble
-        if(bit_lib_get_bits_16(protocol->encoded_data, 0, 11) != 0b10000000000) break;
+        if(bit_lib_window_get_bits_16(window, 0, 11) != 0b10000000000) break;
         // check next 11 bits preamble
-        if(bit_lib_get_bits_16(protocol->encoded_data, 128, 11) != 0b10000000000) break;
+        if(bit_lib_window_get_bits_16(window, 128, 11) != 0b10000000000) break;
+
+        bit_lib_window_copy(window, protocol->encoded_data);
         // check control bits
         if(!bit_lib_test_parity(protocol->encoded_data, 3, 13 * 9, BitLibParityAlways1, 9)) break;
 
@@ -157,13 +165,13 @@ bool protocol_fdx_b_decoder_feed(ProtocolFDXB* protocol, bool level, uint32_t du
             protocol->last_short = true;
         } else {
             pushed = true;
-            bit_lib_push_bit(protocol->encoded_data, FDX_B_ENCODED_BYTE_FULL_SIZE, false);
+            bit_lib_window_push_bit(&protocol->encoded_window, false);
             protocol->last_short = false;
         }
     } else if(duration >= FDX_B_LONG_TIME_LOW && duration <= FDX_B_LONG_TIME_HIGH) {
         if(protocol->last_short == false) {
             pushed = true;
-            bit_lib_push_bit(protocol->encoded_data, FDX_B_ENCODED_BYTE_FULL_SIZE, true);
+            bit_lib_window_push_bit(&protocol->encoded_window, true);
         } else {
             // reset
             protocol->last_short = false;
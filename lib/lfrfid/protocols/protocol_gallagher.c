@@ -1,8 +1,8 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
-#include <toolbox/manchester_decoder.h>
 #include <lfrfid/tools/bit_lib.h>
 #include "lfrfid_protocols.h"
+#include "lfrfid_demodulators.h"
 
 #define GALLAGHER_CLOCK_PER_BIT (32)
 
@@ -14,27 +14,20 @@
     (GALLAGHER_ENCODED_BYTE_SIZE + GALLAGHER_PREAMBLE_BYTE_SIZE)
 #define GALLAGHER_DECODED_DATA_SIZE 8
 
-#define GALLAGHER_READ_SHORT_TIME (128)
-#define GALLAGHER_READ_LONG_TIME (256)
-#define GALLAGHER_READ_JITTER_TIME (60)
-
-#define GALLAGHER_READ_SHORT_TIME_LOW (GALLAGHER_READ_SHORT_TIME - GALLAGHER_READ_JITTER_TIME)
-#define GALLAGHER_READ_SHORT_TIME_HIGH (GALLAGHER_READ_SHORT_TIME + GALLAGHER_READ_JITTER_TIME)
-#define GALLAGHER_READ_LONG_TIME_LOW (GALLAGHER_READ_LONG_TIME - GALLAGHER_READ_JITTER_TIME)
-#define GALLAGHER_READ_LONG_TIME_HIGH (GALLAGHER_READ_LONG_TIME + GALLAGHER_READ_JITTER_TIME)
-
 typedef struct {
     uint8_t data[GALLAGHER_DECODED_DATA_SIZE];
     uint8_t encoded_data[GALLAGHER_ENCODED_BYTE_FULL_SIZE];
+    BitLibWindow encoded_window;
+    uint8_t encoded_window_buffer[BIT_LIB_WINDOW_BUFFER_SIZE(GALLAGHER_ENCODED_BYTE_FULL_SIZE)];
 
     uint8_t encoded_data_index;
     bool encoded_polarity;
-
-    ManchesterState decoder_manchester_state;
 } ProtocolGallagher;
 
 ProtocolGallagher* protocol_gallagher_alloc(void) {
     ProtocolGallagher* proto = malloc(sizeof(ProtocolGallagher));
+    bit_lib_window_init(
+        &proto->encoded_window, proto->encoded_window_buffer, GALLAGHER_ENCODED_BYTE_FULL_SIZE);
     return (void*)proto;
 };
 
@@ -124,11 +117,15 @@ static void protocol_gallagher_decode(ProtocolGallagher* protocol) {
 }
 
 static bool protocol_gallagher_can_be_decoded(ProtocolGallagher* protocol) {
+    const BitLibWindow* window = &protocol->encoded_window;
+
     // check 16 bits preamble
-    if(bit_lib_get_bits_16(protocol->encoded_data, 0, 16) != 0b0111111111101010) return false;
+    if(bit_lib_window_get_bits_16(window, 0, 16) != 0b0111111111101010) return false;
 
     // check next 16 bits preamble
-    if(bit_lib_get_bits_16(protocol->encoded_data, 96, 16) != 0b0111111111101010) return false;
+    if(bit_lib_window_get_bits_16(window, 96, 16) != 0b0111111111101010) return false;
+
+    bit_lib_window_copy(window, protocol->encoded_data);
 
     uint8_t checksum_arr[8] = {0};
     for(int i = 0, pos = 0; i < 8; i++) {
@@ -147,45 +144,19 @@ static bool protocol_gallagher_can_be_decoded(ProtocolGallagher* protocol) {
 
 void protocol_gallagher_decoder_start(ProtocolGallagher* protocol) {
     memset(protocol->encoded_data, 0, GALLAGHER_ENCODED_BYTE_FULL_SIZE);
-    manchester_advance(
-        protocol->decoder_manchester_state,
-        ManchesterEventReset,
-        &protocol->decoder_manchester_state,
-        NULL);
+    bit_lib_window_reset(&protocol->encoded_window);
 };
 
-bool protocol_gallagher_decoder_feed(ProtocolGallagher* protocol, bool level, uint32_t duration) {
+bool protocol_gallagher_decoder_feed(
+    ProtocolGallagher* protocol,
+    const LFRFIDManchesterSymbols* symbols) {
     bool result = false;
 
-    ManchesterEvent event = ManchesterEventReset;
-
-    if(duration > GALLAGHER_READ_SHORT_TIME_LOW && duration < GALLAGHER_READ_SHORT_TIME_HIGH) {
-        if(!level) {
-            event = ManchesterEventShortHigh;
-        } else {
-            event = ManchesterEventShortLow;
-        }
-    } else if(duration > GALLAGHER_READ_LONG_TIME_LOW && duration < GALLAGHER_READ_LONG_TIME_HIGH) {
-        if(!level) {
-            event = ManchesterEventLongHigh;
-        } else {
-            event = ManchesterEventLongLow;
-        }
-    }
-
-    if(event != ManchesterEventReset) {
-        bool data;
-        bool data_ok = manchester_advance(
-            protocol->decoder_manchester_state, event, &protocol->decoder_manchester_state, &data);
+    bit_lib_window_push_bit(&protocol->encoded_window, symbols->bit);
 
-        if(data_ok) {
-            bit_lib_push_bit(protocol->encoded_data, GALLAGHER_ENCODED_BYTE_FULL_SIZE, data);
-
-            if(protocol_gallagher_can_be_decoded(protocol)) {
-                protocol_gallagher_decode(protocol);
-                result = true;
-            }
-        }
+    if(protocol_gallagher_can_be_decoded(protocol)) {
+        protocol_gallagher_decode(protocol);
+        result = true;
     }
 
     return result;
@@ -291,7 +262,8 @@ const ProtocolBase protocol_gallagher = {
     .decoder =
         {
             .start = (ProtocolDecoderStart)protocol_gallagher_decoder_start,
-            .feed = (ProtocolDecoderFeed)protocol_gallagher_decoder_feed,
+            .demodulator = &lfrfid_demodulator_manchester_rf32,
+            .feed_demodulated = (ProtocolDecoderFeedDemodulated)protocol_gallagher_decoder_feed,
         },
     .encoder =
         {
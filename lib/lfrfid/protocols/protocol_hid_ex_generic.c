@@ -1,14 +1,10 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
-#include <lfrfid/tools/fsk_demod.h>
 #include <lfrfid/tools/fsk_osc.h>
 #include "lfrfid_protocols.h"
+#include "lfrfid_demodulators.h"
 #include <lfrfid/tools/bit_lib.h>
 
-#define JITTER_TIME (20)
-#define MIN_TIME (64 - JITTER_TIME)
-#define MAX_TIME (80 + JITTER_TIME)
-
 #define HID_DATA_SIZE 23
 #define HID_PREAMBLE_SIZE 1
 
@@ -19,10 +15,6 @@
 
 #define HID_PREAMBLE 0x1D
 
-typedef struct {
-    FSKDemod* fsk_demod;
-} ProtocolHIDExDecoder;
-
 typedef struct {
     FSKOsc* fsk_osc;
     uint8_t encoded_index;
@@ -30,23 +22,24 @@ typedef struct {
 } ProtocolHIDExEncoder;
 
 typedef struct {
-    ProtocolHIDExDecoder decoder;
     ProtocolHIDExEncoder encoder;
     uint8_t encoded_data[HID_ENCODED_DATA_SIZE];
+    BitLibWindow encoded_window;
+    uint8_t encoded_window_buffer[BIT_LIB_WINDOW_BUFFER_SIZE(HID_ENCODED_DATA_SIZE)];
     uint8_t data[HID_DECODED_DATA_SIZE];
     size_t protocol_size;
 } ProtocolHIDEx;
 
 ProtocolHIDEx* protocol_hid_ex_generic_alloc(void) {
     ProtocolHIDEx* protocol = malloc(sizeof(ProtocolHIDEx));
-    protocol->decoder.fsk_demod = fsk_demod_alloc(MIN_TIME, 6, MAX_TIME, 5);
     protocol->encoder.fsk_osc = fsk_osc_alloc(8, 10, 50);
+    bit_lib_window_init(
+        &protocol->encoded_window, protocol->encoded_window_buffer, HID_ENCODED_DATA_SIZE);
 
     return protocol;
 };
 
 void protocol_hid_ex_generic_free(ProtocolHIDEx* protocol) {
-    fsk_demod_free(protocol->decoder.fsk_demod);
     fsk_osc_free(protocol->encoder.fsk_osc);
     free(protocol);
 };
@@ -57,14 +50,22 @@ uint8_t* protocol_hid_ex_generic_get_data(ProtocolHIDEx* protocol) {
 
 void protocol_hid_ex_generic_decoder_start(ProtocolHIDEx* protocol) {
     memset(protocol->encoded_data, 0, HID_ENCODED_DATA_SIZE);
+    bit_lib_window_reset(&protocol->encoded_window);
 };
 
-static bool protocol_hid_ex_generic_can_be_decoded(const uint8_t* data) {
+static bool protocol_hid_ex_generic_can_be_decoded(ProtocolHIDEx* protocol) {
+    const BitLibWindow* window = &protocol->encoded_window;
+    uint8_t* data = protocol->encoded_data;
+
     // check preamble
-    if(data[0] != HID_PREAMBLE || data[HID_PREAMBLE_SIZE + HID_DATA_SIZE] != HID_PREAMBLE) {
+    if(bit_lib_window_get_bits(window, 0, 8) != HID_PREAMBLE ||
+       bit_lib_window_get_bits(window, (HID_PREAMBLE_SIZE + HID_DATA_SIZE) * 8, 8) !=
+           HID_PREAMBLE) {
         return false;
     }
 
+    bit_lib_window_copy(window, data);
+
     // check for manchester encoding
     for(size_t i = HID_PREAMBLE_SIZE; i < (HID_PREAMBLE_SIZE + HID_DATA_SIZE); i++) {
         for(size_t n = 0; n < 4; n++) {
@@ -93,16 +94,17 @@ static void protocol_hid_ex_generic_decode(const uint8_t* from, uint8_t* to) {
     }
 }
 
-bool protocol_hid_ex_generic_decoder_feed(ProtocolHIDEx* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
+bool protocol_hid_ex_generic_decoder_feed(
+    ProtocolHIDEx* protocol,
+    const LFRFIDFSKSymbols* symbols) {
+    bool value = symbols->value;
+    uint32_t count = lfrfid_fsk_symbols_bit_count(symbols, 6, 5);
     bool result = false;
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     if(count > 0) {
         for(size_t i = 0; i < count; i++) {
-            bit_lib_push_bit(protocol->encoded_data, HID_ENCODED_DATA_SIZE, value);
-            if(protocol_hid_ex_generic_can_be_decoded(protocol->encoded_data)) {
+            bit_lib_window_push_bit(&protocol->encoded_window, value);
+            if(protocol_hid_ex_generic_can_be_decoded(protocol)) {
                 protocol_hid_ex_generic_decode(protocol->encoded_data, protocol->data);
                 result = true;
             }
@@ -210,7 +212,9 @@ const ProtocolBase protocol_hid_ex_generic = {
     .decoder =
         {
             .start = (ProtocolDecoderStart)protocol_hid_ex_generic_decoder_start,
-            .feed = (ProtocolDecoderFeed)protocol_hid_ex_generic_decoder_feed,
+            .demodulator = &lfrfid_demodulator_fsk,
+            .feed_demodulated =
+                (ProtocolDecoderFeedDemodulated)protocol_hid_ex_generic_decoder_feed,
         },
     .encoder =
         {
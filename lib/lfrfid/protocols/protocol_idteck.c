@@ -2,6 +2,7 @@
 #include <toolbox/protocols/protocol.h>
 #include <lfrfid/tools/bit_lib.h>
 #include "lfrfid_protocols.h"
+#include "lfrfid_demodulators.h"
 
 // Example: 4944544B 351FBE4B
 // 01001001 01000100 01010100 01001011       00110101 00011111 10111110 01001011
@@ -18,7 +19,6 @@
 #define IDTECK_DECODED_BIT_SIZE (64)
 #define IDTECK_DECODED_DATA_SIZE (8)
 
-#define IDTECK_US_PER_BIT (255)
 #define IDTECK_ENCODER_PULSES_PER_BIT (16)
 
 typedef struct {
@@ -31,9 +31,11 @@ typedef struct {
 
 typedef struct {
     uint8_t encoded_data[IDTECK_ENCODED_DATA_SIZE];
-    uint8_t negative_encoded_data[IDTECK_ENCODED_DATA_SIZE];
-    uint8_t corrupted_encoded_data[IDTECK_ENCODED_DATA_SIZE];
-    uint8_t corrupted_negative_encoded_data[IDTECK_ENCODED_DATA_SIZE];
+    BitLibWindow encoded_window;
+    BitLibWindow negative_encoded_window;
+    BitLibWindow corrupted_encoded_window;
+    BitLibWindow corrupted_negative_encoded_window;
+    uint8_t window_buffer[4][BIT_LIB_WINDOW_BUFFER_SIZE(IDTECK_ENCODED_DATA_SIZE)];
 
     uint8_t data[IDTECK_DECODED_DATA_SIZE];
     ProtocolIdteckEncoder encoder;
@@ -41,6 +43,16 @@ typedef struct {
 
 ProtocolIdteck* protocol_idteck_alloc(void) {
     ProtocolIdteck* protocol = malloc(sizeof(ProtocolIdteck));
+    bit_lib_window_init(
+        &protocol->encoded_window, protocol->window_buffer[0], IDTECK_ENCODED_DATA_SIZE);
+    bit_lib_window_init(
+        &protocol->negative_encoded_window, protocol->window_buffer[1], IDTECK_ENCODED_DATA_SIZE);
+    bit_lib_window_init(
+        &protocol->corrupted_encoded_window, protocol->window_buffer[2], IDTECK_ENCODED_DATA_SIZE);
+    bit_lib_window_init(
+        &protocol->corrupted_negative_encoded_window,
+        protocol->window_buffer[3],
+        IDTECK_ENCODED_DATA_SIZE);
     return protocol;
 };
 
@@ -54,32 +66,36 @@ uint8_t* protocol_idteck_get_data(ProtocolIdteck* protocol) {
 
 void protocol_idteck_decoder_start(ProtocolIdteck* protocol) {
     memset(protocol->encoded_data, 0, IDTECK_ENCODED_DATA_SIZE);
-    memset(protocol->negative_encoded_data, 0, IDTECK_ENCODED_DATA_SIZE);
-    memset(protocol->corrupted_encoded_data, 0, IDTECK_ENCODED_DATA_SIZE);
-    memset(protocol->corrupted_negative_encoded_data, 0, IDTECK_ENCODED_DATA_SIZE);
+    bit_lib_window_reset(&protocol->encoded_window);
+    bit_lib_window_reset(&protocol->negative_encoded_window);
+    bit_lib_window_reset(&protocol->corrupted_encoded_window);
+    bit_lib_window_reset(&protocol->corrupted_negative_encoded_window);
 };
 
-static bool protocol_idteck_check_preamble(uint8_t* data, size_t bit_index) {
+static bool protocol_idteck_check_preamble(const BitLibWindow* window, size_t bit_index) {
     // Preamble 01001001 01000100 01010100 01001011
-    if(*(uint32_t*)&data[bit_index / 8] != 0b01001011010101000100010001001001) return false;
+    if(bit_lib_window_get_bits_32(window, bit_index, 32) != 0b01001001010001000101010001001011)
+        return false;
     return true;
 }
 
-static bool protocol_idteck_can_be_decoded(uint8_t* data) {
-    if(!protocol_idteck_check_preamble(data, 0)) return false;
+static bool protocol_idteck_can_be_decoded(const BitLibWindow* window) {
+    if(!protocol_idteck_check_preamble(window, 0)) return false;
     return true;
 }
 
-static bool protocol_idteck_decoder_feed_internal(bool polarity, uint32_t time, uint8_t* data) {
-    time += (IDTECK_US_PER_BIT / 2);
-
-    size_t bit_count = (time / IDTECK_US_PER_BIT);
+static bool protocol_idteck_decoder_feed_internal(
+    bool polarity,
+    uint32_t bit_count,
+    BitLibWindow* window,
+    uint8_t* data) {
     bool result = false;
 
     if(bit_count < IDTECK_ENCODED_BIT_SIZE) {
         for(size_t i = 0; i < bit_count; i++) {
-            bit_lib_push_bit(data, IDTECK_ENCODED_DATA_SIZE, polarity);
-            if(protocol_idteck_can_be_decoded(data)) {
+            bit_lib_window_push_bit(window, polarity);
+            if(protocol_idteck_can_be_decoded(window)) {
+                bit_lib_window_copy(window, data);
                 result = true;
                 break;
             }
@@ -93,11 +109,13 @@ static void protocol_idteck_decoder_save(uint8_t* data_to, const uint8_t* data_f
     bit_lib_copy_bits(data_to, 0, 64, data_from, 0);
 }
 
-bool protocol_idteck_decoder_feed(ProtocolIdteck* protocol, bool level, uint32_t duration) {
+bool protocol_idteck_decoder_feed(ProtocolIdteck* protocol, const LFRFIDPSKSymbols* symbols) {
+    const bool level = symbols->level;
     bool result = false;
 
-    if(duration > (IDTECK_US_PER_BIT / 2)) {
-        if(protocol_idteck_decoder_feed_internal(level, duration, protocol->encoded_data)) {
+    if(symbols->bit_count) {
+        if(protocol_idteck_decoder_feed_internal(
+               level, symbols->bit_count, &protocol->encoded_window, protocol->encoded_data)) {
             protocol_idteck_decoder_save(protocol->data, protocol->encoded_data);
             FURI_LOG_D("Idteck", "Positive");
             result = true;
@@ -105,27 +123,25 @@ bool protocol_idteck_decoder_feed(ProtocolIdteck* protocol, bool level, uint32_t
         }
 
         if(protocol_idteck_decoder_feed_internal(
-               !level, duration, protocol->negative_encoded_data)) {
-            protocol_idteck_decoder_save(protocol->data, protocol->negative_encoded_data);
+               !level,
+               symbols->bit_count,
+               &protocol->negative_encoded_window,
+               protocol->encoded_data)) {
+            protocol_idteck_decoder_save(protocol->data, protocol->encoded_data);
             FURI_LOG_D("Idteck", "Negative");
             result = true;
             return result;
         }
     }
 
-    if(duration > (IDTECK_US_PER_BIT / 4)) {
-        // Try to decode wrong phase synced data
-        if(level) {
-            duration += 120;
-        } else {
-            if(duration > 120) {
-                duration -= 120;
-            }
-        }
-
+    // Try to decode wrong phase synced data
+    if(symbols->corrupted_bit_count) {
         if(protocol_idteck_decoder_feed_internal(
-               level, duration, protocol->corrupted_encoded_data)) {
-            protocol_idteck_decoder_save(protocol->data, protocol->corrupted_encoded_data);
+               level,
+               symbols->corrupted_bit_count,
+               &protocol->corrupted_encoded_window,
+               protocol->encoded_data)) {
+            protocol_idteck_decoder_save(protocol->data, protocol->encoded_data);
             FURI_LOG_D("Idteck", "Positive Corrupted");
 
             result = true;
@@ -133,9 +149,11 @@ bool protocol_idteck_decoder_feed(ProtocolIdteck* protocol, bool level, uint32_t
         }
 
         if(protocol_idteck_decoder_feed_internal(
-               !level, duration, protocol->corrupted_negative_encoded_data)) {
-            protocol_idteck_decoder_save(
-                protocol->data, protocol->corrupted_negative_encoded_data);
+               !level,
+               symbols->corrupted_bit_count,
+               &protocol->corrupted_negative_encoded_window,
+               protocol->encoded_data)) {
+            protocol_idteck_decoder_save(protocol->data, protocol->encoded_data);
             FURI_LOG_D("Idteck", "Negative Corrupted");
 
             result = true;
@@ -256,7 +274,8 @@ const ProtocolBase protocol_idteck = {
     .decoder =
         {
             .start = (ProtocolDecoderStart)protocol_idteck_decoder_start,
-            .feed = (ProtocolDecoderFeed)protocol_idteck_decoder_feed,
+            .demodulator = &lfrfid_demodulator_psk,
+            .feed_demodulated = (ProtocolDecoderFeedDemodulated)protocol_idteck_decoder_feed,
         },
     .encoder =
         {
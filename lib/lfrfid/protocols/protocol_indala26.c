@@ -2,6 +2,7 @@
 #include <toolbox/protocols/protocol.h>
 #include <lfrfid/tools/bit_lib.h>
 #include "lfrfid_protocols.h"
+#include "lfrfid_demodulators.h"
 
 #define INDALA26_PREAMBLE_BIT_SIZE (33)
 #define INDALA26_PREAMBLE_DATA_SIZE (5)
@@ -14,7 +15,6 @@
 #define INDALA26_DECODED_BIT_SIZE (28)
 #define INDALA26_DECODED_DATA_SIZE (4)
 
-#define INDALA26_US_PER_BIT (255)
 #define INDALA26_ENCODER_PULSES_PER_BIT (16)
 
 typedef struct {
@@ -27,9 +27,11 @@ typedef struct {
 
 typedef struct {
     uint8_t encoded_data[INDALA26_ENCODED_DATA_SIZE];
-    uint8_t negative_encoded_data[INDALA26_ENCODED_DATA_SIZE];
-    uint8_t corrupted_encoded_data[INDALA26_ENCODED_DATA_SIZE];
-    uint8_t corrupted_negative_encoded_data[INDALA26_ENCODED_DATA_SIZE];
+    BitLibWindow encoded_window;
+    BitLibWindow negative_encoded_window;
+    BitLibWindow corrupted_encoded_window;
+    BitLibWindow corrupted_negative_encoded_window;
+    uint8_t window_buffer[4][BIT_LIB_WINDOW_BUFFER_SIZE(INDALA26_ENCODED_DATA_SIZE)];
 
     uint8_t data[INDALA26_DECODED_DATA_SIZE];
     ProtocolIndalaEncoder encoder;
@@ -37,6 +39,20 @@ typedef struct {
 
 ProtocolIndala* protocol_indala26_alloc(void) {
     ProtocolIndala* protocol = malloc(sizeof(ProtocolIndala));
+    bit_lib_window_init(
+        &protocol->encoded_window, protocol->window_buffer[0], INDALA26_ENCODED_DATA_SIZE);
+    bit_lib_window_init(
+        &protocol->negative_encoded_window,
+        protocol->window_buffer[1],
+        INDALA26_ENCODED_DATA_SIZE);
+    bit_lib_window_init(
+        &protocol->corrupted_encoded_window,
+        protocol->window_buffer[2],
+        INDALA26_ENCODED_DATA_SIZE);
+    bit_lib_window_init(
+        &protocol->corrupted_negative_encoded_window,
+        protocol->window_buffer[3],
+        INDALA26_ENCODED_DATA_SIZE);
     return protocol;
 };
 
@@ -50,36 +66,40 @@ uint8_t* protocol_indala26_get_data(ProtocolIndala* protocol) {
 
 void protocol_indala26_decoder_start(ProtocolIndala* protocol) {
     memset(protocol->encoded_data, 0, INDALA26_ENCODED_DATA_SIZE);
-    memset(protocol->negative_encoded_data, 0, INDALA26_ENCODED_DATA_SIZE);
-    memset(protocol->corrupted_encoded_data, 0, INDALA26_ENCODED_DATA_SIZE);
-    memset(protocol->corrupted_negative_encoded_data, 0, INDALA26_ENCODED_DATA_SIZE);
+    bit_lib_window_reset(&protocol->encoded_window);
+    bit_lib_window_reset(&protocol->negative_encoded_window);
+    bit_lib_window_reset(&protocol->corrupted_encoded_window);
+    bit_lib_window_reset(&protocol->corrupted_negative_encoded_window);
 };
 
-static bool protocol_indala26_check_preamble(uint8_t* data, size_t bit_index) {
+static bool protocol_indala26_check_preamble(const BitLibWindow* window, size_t bit_index) {
     // Preamble 10100000 00000000 00000000 00000000 1
-    if(*(uint32_t*)&data[bit_index / 8] != 0b00000000000000000000000010100000) return false;
-    if(bit_lib_get_bit(data, bit_index + 32) != 1) return false;
+    if(bit_lib_window_get_bits_32(window, bit_index, 32) != 0b10100000000000000000000000000000)
+        return false;
+    if(bit_lib_window_get_bit(window, bit_index + 32) != 1) return false;
     return true;
 }
 
-static bool protocol_indala26_can_be_decoded(uint8_t* data) {
-    if(!protocol_indala26_check_preamble(data, 0)) return false;
-    if(!protocol_indala26_check_preamble(data, 64)) return false;
-    if(bit_lib_get_bit(data, 61) != 0) return false;
-    if(bit_lib_get_bit(data, 60) != 0) return false;
+static bool protocol_indala26_can_be_decoded(const BitLibWindow* window) {
+    if(!protocol_indala26_check_preamble(window, 0)) return false;
+    if(!protocol_indala26_check_preamble(window, 64)) return false;
+    if(bit_lib_window_get_bit(window, 61) != 0) return false;
+    if(bit_lib_window_get_bit(window, 60) != 0) return false;
     return true;
 }
 
-static bool protocol_indala26_decoder_feed_internal(bool polarity, uint32_t time, uint8_t* data) {
-    time += (INDALA26_US_PER_BIT / 2);
-
-    size_t bit_count = (time / INDALA26_US_PER_BIT);
+static bool protocol_indala26_decoder_feed_internal(
+    bool polarity,
+    uint32_t bit_count,
+    BitLibWindow* window,
+    uint8_t* data) {
     bool result = false;
 
     if(bit_count < INDALA26_ENCODED_BIT_SIZE) {
         for(size_t i = 0; i < bit_count; i++) {
-            bit_lib_push_bit(data, INDALA26_ENCODED_DATA_SIZE, polarity);
-            if(protocol_indala26_can_be_decoded(data)) {
+            bit_lib_window_push_bit(window, polarity);
+            if(protocol_indala26_can_be_decoded(window)) {
+                bit_lib_window_copy(window, data);
                 result = true;
                 break;
             }
@@ -95,11 +115,13 @@ static void protocol_indala26_decoder_save(uint8_t* data_to, const uint8_t* data
     bit_lib_copy_bits(data_to, 27, 2, data_from, 62);
 }
 
-bool protocol_indala26_decoder_feed(ProtocolIndala* protocol, bool level, uint32_t duration) {
+bool protocol_indala26_decoder_feed(ProtocolIndala* protocol, const LFRFIDPSKSymbols* symbols) {
+    const bool level = symbols->level;
     bool result = false;
 
-    if(duration > (INDALA26_US_PER_BIT / 2)) {
-        if(protocol_indala26_decoder_feed_internal(level, duration, protocol->encoded_data)) {
+    if(symbols->bit_count) {
+        if(protocol_indala26_decoder_feed_internal(
+               level, symbols->bit_count, &protocol->encoded_window, protocol->encoded_data)) {
             protocol_indala26_decoder_save(protocol->data, protocol->encoded_data);
             FURI_LOG_D("Indala26", "Positive");
             result = true;
@@ -107,27 +129,25 @@ bool protocol_indala26_decoder_feed(ProtocolIndala* protocol, bool level, uint32
         }
 
         if(protocol_indala26_decoder_feed_internal(
-               !level, duration, protocol->negative_encoded_data)) {
-            protocol_indala26_decoder_save(protocol->data, protocol->negative_encoded_data);
+               !level,
+               symbols->bit_count,
+               &protocol->negative_encoded_window,
+               protocol->encoded_data)) {
+            protocol_indala26_decoder_save(protocol->data, protocol->encoded_data);
             FURI_LOG_D("Indala26", "Negative");
             result = true;
             return result;
         }
     }
 
-    if(duration > (INDALA26_US_PER_BIT / 4)) {
-        // Try to decode wrong phase synced data
-        if(level) {
-            duration += 120;
-        } else {
-            if(duration > 120) {
-                duration -= 120;
-            }
-        }
-
+    // Try to decode wrong phase synced data
+    if(symbols->corrupted_bit_count) {
         if(protocol_indala26_decoder_feed_internal(
-               level, duration, protocol->corrupted_encoded_data)) {
-            protocol_indala26_decoder_save(protocol->data, protocol->corrupted_encoded_data);
+               level,
+               symbols->corrupted_bit_count,
+               &protocol->corrupted_encoded_window,
+               protocol->encoded_data)) {
+            protocol_indala26_decoder_save(protocol->data, protocol->encoded_data);
             FURI_LOG_D("Indala26", "Positive Corrupted");
 
             result = true;
@@ -135,9 +155,11 @@ bool protocol_indala26_decoder_feed(ProtocolIndala* protocol, bool level, uint32
         }
 
         if(protocol_indala26_decoder_feed_internal(
-               !level, duration, protocol->corrupted_negative_encoded_data)) {
-            protocol_indala26_decoder_save(
-                protocol->data, protocol->corrupted_negative_encoded_data);
+               !level,
+               symbols->corrupted_bit_count,
+               &protocol->corrupted_negative_encoded_window,
+               protocol->encoded_data)) {
+            protocol_indala26_decoder_save(protocol->data, protocol->encoded_data);
             FURI_LOG_D("Indala26", "Negative Corrupted");
 
             result = true;
@@ -343,7 +365,8 @@ const ProtocolBase protocol_indala26 = {
     .decoder =
         {
             .start = (ProtocolDecoderStart)protocol_indala26_decoder_start,
-            .feed = (ProtocolDecoderFeed)protocol_indala26_decoder_feed,
+            .demodulator = &lfrfid_demodulator_psk,
+            .feed_demodulated = (ProtocolDecoderFeedDemodulated)protocol_indala26_decoder_feed,
         },
     .encoder =
         {
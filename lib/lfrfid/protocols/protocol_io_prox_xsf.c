@@ -1,13 +1,9 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
-#include <lfrfid/tools/fsk_demod.h>
 #include <lfrfid/tools/fsk_osc.h>
 #include <lfrfid/tools/bit_lib.h>
 #include "lfrfid_protocols.h"
-
-#define JITTER_TIME (20)
-#define MIN_TIME (64 - JITTER_TIME)
-#define MAX_TIME (80 + JITTER_TIME)
+#include "lfrfid_demodulators.h"
 
 #define IOPROXXSF_DECODED_DATA_SIZE (4)
 #define IOPROXXSF_ENCODED_DATA_SIZE (8)
@@ -15,10 +11,6 @@
 #define IOPROXXSF_BIT_SIZE (8)
 #define IOPROXXSF_BIT_MAX_SIZE (IOPROXXSF_BIT_SIZE * IOPROXXSF_ENCODED_DATA_SIZE)
 
-typedef struct {
-    FSKDemod* fsk_demod;
-} ProtocolIOProxXSFDecoder;
-
 typedef struct {
     FSKOsc* fsk_osc;
     uint8_t encoded_index;
@@ -26,20 +18,21 @@ typedef struct {
 
 typedef struct {
     ProtocolIOProxXSFEncoder encoder;
-    ProtocolIOProxXSFDecoder decoder;
     uint8_t encoded_data[IOPROXXSF_ENCODED_DATA_SIZE];
+    BitLibWindow encoded_window;
+    uint8_t encoded_window_buffer[BIT_LIB_WINDOW_BUFFER_SIZE(IOPROXXSF_ENCODED_DATA_SIZE)];
     uint8_t data[IOPROXXSF_DECODED_DATA_SIZE];
 } ProtocolIOProxXSF;
 
 ProtocolIOProxXSF* protocol_io_prox_xsf_alloc(void) {
     ProtocolIOProxXSF* protocol = malloc(sizeof(ProtocolIOProxXSF));
-    protocol->decoder.fsk_demod = fsk_demod_alloc(MIN_TIME, 8, MAX_TIME, 6);
     protocol->encoder.fsk_osc = fsk_osc_alloc(8, 10, 64);
+    bit_lib_window_init(
+        &protocol->encoded_window, protocol->encoded_window_buffer, IOPROXXSF_ENCODED_DATA_SIZE);
     return protocol;
 };
 
 void protocol_io_prox_xsf_free(ProtocolIOProxXSF* protocol) {
-    fsk_demod_free(protocol->decoder.fsk_demod);
     fsk_osc_free(protocol->encoder.fsk_osc);
     free(protocol);
 };
@@ -50,6 +43,7 @@ uint8_t* protocol_io_prox_xsf_get_data(ProtocolIOProxXSF* protocol) {
 
 void protocol_io_prox_xsf_decoder_start(ProtocolIOProxXSF* protocol) {
     memset(protocol->encoded_data, 0, IOPROXXSF_ENCODED_DATA_SIZE);
+    bit_lib_window_reset(&protocol->encoded_window);
 };
 
 static uint8_t protocol_io_prox_xsf_compute_checksum(const uint8_t* data) {
@@ -72,7 +66,10 @@ static uint8_t protocol_io_prox_xsf_compute_checksum(const uint8_t* data) {
     return 0xFF - checksum;
 }
 
-static bool protocol_io_prox_xsf_can_be_decoded(const uint8_t* encoded_data) {
+static bool protocol_io_prox_xsf_can_be_decoded(ProtocolIOProxXSF* protocol) {
+    const BitLibWindow* window = &protocol->encoded_window;
+    uint8_t* encoded_data = protocol->encoded_data;
+
     // Packet framing
     //
     //0        1        2        3        4        5        6        7
@@ -87,13 +84,12 @@ static bool protocol_io_prox_xsf_can_be_decoded(const uint8_t* encoded_data) {
     // X = checksum
 
     // Validate the packet preamble is there...
-    if(encoded_data[0] != 0b00000000) {
-        return false;
-    }
-    if((encoded_data[1] >> 6) != 0b01) {
+    if(bit_lib_window_get_bits_16(window, 0, 10) != 0b0000000001) {
         return false;
     }
 
+    bit_lib_window_copy(window, encoded_data);
+
     // ... check for known ones...
     if(bit_lib_bit_is_not_set(encoded_data[2], 6)) {
         return false;
@@ -155,16 +151,17 @@ void protocol_io_prox_xsf_decode(const uint8_t* encoded_data, uint8_t* decoded_d
     decoded_data[3] = bit_lib_get_bits(encoded_data, 45, 8);
 }
 
-bool protocol_io_prox_xsf_decoder_feed(ProtocolIOProxXSF* protocol, bool level, uint32_t duration) {
+bool protocol_io_prox_xsf_decoder_feed(
+    ProtocolIOProxXSF* protocol,
+    const LFRFIDFSKSymbols* symbols) {
     bool result = false;
 
-    uint32_t count;
-    bool value;
+    uint32_t count = lfrfid_fsk_symbols_bit_count(symbols, 8, 6);
+    bool value = symbols->value;
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     for(size_t i = 0; i < count; i++) {
-        bit_lib_push_bit(protocol->encoded_data, IOPROXXSF_ENCODED_DATA_SIZE, value);
-        if(protocol_io_prox_xsf_can_be_decoded(protocol->encoded_data)) {
+        bit_lib_window_push_bit(&protocol->encoded_window, value);
+        if(protocol_io_prox_xsf_can_be_decoded(protocol)) {
             protocol_io_prox_xsf_decode(protocol->encoded_data, protocol->data);
             result = true;
             break;
@@ -288,7 +285,8 @@ const ProtocolBase protocol_io_prox_xsf = {
     .decoder =
         {
             .start = (ProtocolDecoderStart)protocol_io_prox_xsf_decoder_start,
-            .feed = (ProtocolDecoderFeed)protocol_io_prox_xsf_decoder_feed,
+            .demodulator = &lfrfid_demodulator_fsk,
+            .feed_demodulated = (ProtocolDecoderFeedDemodulated)protocol_io_prox_xsf_decoder_feed,
         },
     .encoder =
         {
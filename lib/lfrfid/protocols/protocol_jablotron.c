@@ -28,11 +28,17 @@ typedef struct {
     bool last_level;
     size_t encoded_index;
     uint8_t encoded_data[JABLOTRON_ENCODED_BYTE_FULL_SIZE];
+    BitLibWindow encoded_window;
+    uint8_t encoded_window_buffer[BIT_LIB_WINDOW_BUFFER_SIZE(JABLOTRON_ENCODED_BYTE_FULL_SIZE)];
     uint8_t data[JABLOTRON_DECODED_DATA_SIZE];
 } ProtocolJablotron;
 
 ProtocolJablotron* protocol_jablotron_alloc(void) {
     ProtocolJablotron* protocol = malloc(sizeof(ProtocolJablotron));
+    bit_lib_window_init(
+        &protocol->encoded_window,
+        protocol->encoded_window_buffer,
+        JABLOTRON_ENCODED_BYTE_FULL_SIZE);
     return protocol;
 };
 
@@ -46,6 +52,7 @@ uint8_t* protocol_jablotron_get_data(ProtocolJablotron* proto) {
 
 void protocol_jablotron_decoder_start(ProtocolJablotron* protocol) {
     memset(protocol->encoded_data, 0, JABLOTRON_ENCODED_BYTE_FULL_SIZE);
+    bit_lib_window_reset(&protocol->encoded_window);
     protocol->last_short = false;
 };
 
@@ -69,9 +76,13 @@ uint64_t protocol_jablotron_card_id(uint8_t* bytes) {
 
 static bool protocol_jablotron_can_be_decoded(ProtocolJablotron* protocol) {
     // check 11 bits preamble
-    if(bit_lib_get_bits_16(protocol->encoded_data, 0, 16) != 0b1111111111111111) return false;
+    const BitLibWindow* window = &protocol->encoded_window;
+
+    if(bit_lib_window_get_bits_16(window, 0, 16) != 0b1111111111111111) return false;
     // check next 11 bits preamble
-    if(bit_lib_get_bits_16(protocol->encoded_data, 64, 16) != 0b1111111111111111) return false;
+    if(bit_lib_window_get_bits_16(window, 64, 16) != 0b1111111111111111) return false;
+
+    bit_lib_window_copy(window, protocol->encoded_data);
 
     uint8_t checksum = bit_lib_get_bits(protocol->encoded_data, 56, 8);
     if(checksum != protocol_jablotron_checksum(protocol->encoded_data)) return false;
@@ -93,13 +104,13 @@ bool protocol_jablotron_decoder_feed(ProtocolJablotron* protocol, bool level, ui
             protocol->last_short = true;
         } else {
             pushed = true;
-            bit_lib_push_bit(protocol->encoded_data, JABLOTRON_ENCODED_BYTE_FULL_SIZE, false);
+            bit_lib_window_push_bit(&protocol->encoded_window, false);
             protocol->last_short = false;
         }
     } else if(duration >= JABLOTRON_LONG_TIME_LOW && duration <= JABLOTRON_LONG_TIME_HIGH) {
         if(protocol->last_short == false) {
             pushed = true;
-            bit_lib_push_bit(protocol->encoded_data, JABLOTRON_ENCODED_BYTE_FULL_SIZE, true);
+            bit_lib_window_push_bit(&protocol->encoded_window, true);
         } else {
             // reset
             protocol->last_short = false;
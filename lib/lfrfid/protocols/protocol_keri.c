@@ -2,6 +2,7 @@
 #include <toolbox/protocols/protocol.h>
 #include <lfrfid/tools/bit_lib.h>
 #include "lfrfid_protocols.h"
+#include "lfrfid_demodulators.h"
 
 #define KERI_PREAMBLE_BIT_SIZE (33)
 #define KERI_PREAMBLE_DATA_SIZE (5)
@@ -13,7 +14,6 @@
 #define KERI_DECODED_BIT_SIZE (28)
 #define KERI_DECODED_DATA_SIZE (4)
 
-#define KERI_US_PER_BIT (255)
 #define KERI_ENCODER_PULSES_PER_BIT (16)
 
 typedef struct {
@@ -26,9 +26,11 @@ typedef struct {
 
 typedef struct {
     uint8_t encoded_data[KERI_ENCODED_DATA_SIZE];
-    uint8_t negative_encoded_data[KERI_ENCODED_DATA_SIZE];
-    uint8_t corrupted_encoded_data[KERI_ENCODED_DATA_SIZE];
-    uint8_t corrupted_negative_encoded_data[KERI_ENCODED_DATA_SIZE];
+    BitLibWindow encoded_window;
+    BitLibWindow negative_encoded_window;
+    BitLibWindow corrupted_encoded_window;
+    BitLibWindow corrupted_negative_encoded_window;
+    uint8_t window_buffer[4][BIT_LIB_WINDOW_BUFFER_SIZE(KERI_ENCODED_DATA_SIZE)];
 
     uint8_t data[KERI_DECODED_DATA_SIZE];
     ProtocolKeriEncoder encoder;
@@ -36,6 +38,16 @@ typedef struct {
 
 ProtocolKeri* protocol_keri_alloc(void) {
     ProtocolKeri* protocol = malloc(sizeof(ProtocolKeri));
+    bit_lib_window_init(
+        &protocol->encoded_window, protocol->window_buffer[0], KERI_ENCODED_DATA_SIZE);
+    bit_lib_window_init(
+        &protocol->negative_encoded_window, protocol->window_buffer[1], KERI_ENCODED_DATA_SIZE);
+    bit_lib_window_init(
+        &protocol->corrupted_encoded_window, protocol->window_buffer[2], KERI_ENCODED_DATA_SIZE);
+    bit_lib_window_init(
+        &protocol->corrupted_negative_encoded_window,
+        protocol->window_buffer[3],
+        KERI_ENCODED_DATA_SIZE);
     return protocol;
 };
 
@@ -49,36 +61,40 @@ uint8_t* protocol_keri_get_data(ProtocolKeri* protocol) {
 
 void protocol_keri_decoder_start(ProtocolKeri* protocol) {
     memset(protocol->encoded_data, 0, KERI_ENCODED_DATA_SIZE);
-    memset(protocol->negative_encoded_data, 0, KERI_ENCODED_DATA_SIZE);
-    memset(protocol->corrupted_encoded_data, 0, KERI_ENCODED_DATA_SIZE);
-    memset(protocol->corrupted_negative_encoded_data, 0, KERI_ENCODED_DATA_SIZE);
+    bit_lib_window_reset(&protocol->encoded_window);
+    bit_lib_window_reset(&protocol->negative_encoded_window);
+    bit_lib_window_reset(&protocol->corrupted_encoded_window);
+    bit_lib_window_reset(&protocol->corrupted_negative_encoded_window);
 };
 
-static bool protocol_keri_check_preamble(uint8_t* data, size_t bit_index) {
+static bool protocol_keri_check_preamble(const BitLibWindow* window, size_t bit_index) {
     // Preamble 11100000 00000000 00000000 00000000 1
-    if(*(uint32_t*)&data[bit_index / 8] != 0b00000000000000000000000011100000) return false;
-    if(bit_lib_get_bit(data, bit_index + 32) != 1) return false;
+    if(bit_lib_window_get_bits_32(window, bit_index, 32) != 0b11100000000000000000000000000000)
+        return false;
+    if(bit_lib_window_get_bit(window, bit_index + 32) != 1) return false;
     return true;
 }
 
-static bool protocol_keri_can_be_decoded(uint8_t* data) {
-    if(!protocol_keri_check_preamble(data, 0)) return false;
-    if(!protocol_keri_check_preamble(data, 64)) return false;
+static bool protocol_keri_can_be_decoded(const BitLibWindow* window) {
+    if(!protocol_keri_check_preamble(window, 0)) return false;
+    if(!protocol_keri_check_preamble(window, 64)) return false;
     ///if(bit_lib_get_bit(data, 61) != 0) return false;
     //if(bit_lib_get_bit(data, 60) != 0) return false;
     return true;
 }
 
-static bool protocol_keri_decoder_feed_internal(bool polarity, uint32_t time, uint8_t* data) {
-    time += (KERI_US_PER_BIT / 2);
-
-    size_t bit_count = (time / KERI_US_PER_BIT);
+static bool protocol_keri_decoder_feed_internal(
+    bool polarity,
+    uint32_t bit_count,
+    BitLibWindow* window,
+    uint8_t* data) {
     bool result = false;
 
     if(bit_count < KERI_ENCODED_BIT_SIZE) {
         for(size_t i = 0; i < bit_count; i++) {
-            bit_lib_push_bit(data, KERI_ENCODED_DATA_SIZE, polarity);
-            if(protocol_keri_can_be_decoded(data)) {
+            bit_lib_window_push_bit(window, polarity);
+            if(protocol_keri_can_be_decoded(window)) {
+                bit_lib_window_copy(window, data);
                 result = true;
                 break;
             }
@@ -120,43 +136,48 @@ static void protocol_keri_decoder_save(uint8_t* data_to, const uint8_t* data_fro
     data_to[0] = (uint8_t)(id >>= 8);
 }
 
-bool protocol_keri_decoder_feed(ProtocolKeri* protocol, bool level, uint32_t duration) {
+bool protocol_keri_decoder_feed(ProtocolKeri* protocol, const LFRFIDPSKSymbols* symbols) {
+    const bool level = symbols->level;
     bool result = false;
 
-    if(duration > (KERI_US_PER_BIT / 2)) {
-        if(protocol_keri_decoder_feed_internal(level, duration, protocol->encoded_data)) {
+    if(symbols->bit_count) {
+        if(protocol_keri_decoder_feed_internal(
+               level, symbols->bit_count, &protocol->encoded_window, protocol->encoded_data)) {
             protocol_keri_decoder_save(protocol->data, protocol->encoded_data);
             result = true;
             return result;
         }
 
-        if(protocol_keri_decoder_feed_internal(!level, duration, protocol->negative_encoded_data)) {
-            protocol_keri_decoder_save(protocol->data, protocol->negative_encoded_data);
+        if(protocol_keri_decoder_feed_internal(
+               !level,
+               symbols->bit_count,
+               &protocol->negative_encoded_window,
+               protocol->encoded_data)) {
+            protocol_keri_decoder_save(protocol->data, protocol->encoded_data);
             result = true;
             return result;
         }
     }
 
-    if(duration > (KERI_US_PER_BIT / 4)) {
-        // Try to decode wrong phase synced data
-        if(level) {
-            duration += 120;
-        } else {
-            if(duration > 120) {
-                duration -= 120;
-            }
-        }
-
-        if(protocol_keri_decoder_feed_internal(level, duration, protocol->corrupted_encoded_data)) {
-            protocol_keri_decoder_save(protocol->data, protocol->corrupted_encoded_data);
+    // Try to decode wrong phase synced data
+    if(symbols->corrupted_bit_count) {
+        if(protocol_keri_decoder_feed_internal(
+               level,
+               symbols->corrupted_bit_count,
+               &protocol->corrupted_encoded_window,
+               protocol->encoded_data)) {
+            protocol_keri_decoder_save(protocol->data, protocol->encoded_data);
 
             result = true;
             return result;
         }
 
         if(protocol_keri_decoder_feed_internal(
-               !level, duration, protocol->corrupted_negative_encoded_data)) {
-            protocol_keri_decoder_save(protocol->data, protocol->corrupted_negative_encoded_data);
+               !level,
+               symbols->corrupted_bit_count,
+               &protocol->corrupted_negative_encoded_window,
+               protocol->encoded_data)) {
+            protocol_keri_decoder_save(protocol->data, protocol->encoded_data);
 
             result = true;
             return result;
@@ -254,7 +275,8 @@ const ProtocolBase protocol_keri = {
     .decoder =
         {
             .start = (ProtocolDecoderStart)protocol_keri_decoder_start,
-            .feed = (ProtocolDecoderFeed)protocol_keri_decoder_feed,
+            .demodulator = &lfrfid_demodulator_psk,
+            .feed_demodulated = (ProtocolDecoderFeedDemodulated)protocol_keri_decoder_feed,
         },
     .encoder =
         {
@@ -2,6 +2,7 @@
 #include <toolbox/protocols/protocol.h>
 #include <lfrfid/tools/bit_lib.h>
 #include "lfrfid_protocols.h"
+#include "lfrfid_demodulators.h"
 
 #define NEXWATCH_PREAMBLE_BIT_SIZE (8)
 #define NEXWATCH_PREAMBLE_DATA_SIZE (1)
@@ -12,7 +13,6 @@
 #define NEXWATCH_DECODED_BIT_SIZE (NEXWATCH_DECODED_DATA_SIZE * 8)
 #define NEXWATCH_DECODED_DATA_SIZE (8)
 
-#define NEXWATCH_US_PER_BIT (255)
 #define NEXWATCH_ENCODER_PULSES_PER_BIT (16)
 
 typedef struct {
@@ -36,9 +36,11 @@ typedef struct {
 
 typedef struct {
     uint8_t encoded_data[NEXWATCH_ENCODED_DATA_SIZE];
-    uint8_t negative_encoded_data[NEXWATCH_ENCODED_DATA_SIZE];
-    uint8_t corrupted_encoded_data[NEXWATCH_ENCODED_DATA_SIZE];
-    uint8_t corrupted_negative_encoded_data[NEXWATCH_ENCODED_DATA_SIZE];
+    BitLibWindow encoded_window;
+    BitLibWindow negative_encoded_window;
+    BitLibWindow corrupted_encoded_window;
+    BitLibWindow corrupted_negative_encoded_window;
+    uint8_t window_buffer[4][BIT_LIB_WINDOW_BUFFER_SIZE(NEXWATCH_ENCODED_DATA_SIZE)];
 
     uint8_t data[NEXWATCH_DECODED_DATA_SIZE];
     ProtocolNexwatchEncoder encoder;
@@ -46,6 +48,20 @@ typedef struct {
 
 ProtocolNexwatch* protocol_nexwatch_alloc(void) {
     ProtocolNexwatch* protocol = malloc(sizeof(ProtocolNexwatch));
+    bit_lib_window_init(
+        &protocol->encoded_window, protocol->window_buffer[0], NEXWATCH_ENCODED_DATA_SIZE);
+    bit_lib_window_init(
+        &protocol->negative_encoded_window,
+        protocol->window_buffer[1],
+        NEXWATCH_ENCODED_DATA_SIZE);
+    bit_lib_window_init(
+        &protocol->corrupted_encoded_window,
+        protocol->window_buffer[2],
+        NEXWATCH_ENCODED_DATA_SIZE);
+    bit_lib_window_init(
+        &protocol->corrupted_negative_encoded_window,
+        protocol->window_buffer[3],
+        NEXWATCH_ENCODED_DATA_SIZE);
     return protocol;
 };
 
@@ -59,14 +75,15 @@ uint8_t* protocol_nexwatch_get_data(ProtocolNexwatch* protocol) {
 
 void protocol_nexwatch_decoder_start(ProtocolNexwatch* protocol) {
     memset(protocol->encoded_data, 0, NEXWATCH_ENCODED_DATA_SIZE);
-    memset(protocol->negative_encoded_data, 0, NEXWATCH_ENCODED_DATA_SIZE);
-    memset(protocol->corrupted_encoded_data, 0, NEXWATCH_ENCODED_DATA_SIZE);
-    memset(protocol->corrupted_negative_encoded_data, 0, NEXWATCH_ENCODED_DATA_SIZE);
+    bit_lib_window_reset(&protocol->encoded_window);
+    bit_lib_window_reset(&protocol->negative_encoded_window);
+    bit_lib_window_reset(&protocol->corrupted_encoded_window);
+    bit_lib_window_reset(&protocol->corrupted_negative_encoded_window);
 };
 
-static bool protocol_nexwatch_check_preamble(uint8_t* data, size_t bit_index) {
+static bool protocol_nexwatch_check_preamble(const BitLibWindow* window, size_t bit_index) {
     // 01010110
-    if(bit_lib_get_bits(data, bit_index, 8) != 0b01010110) return false;
+    if(bit_lib_window_get_bits(window, bit_index, 8) != 0b01010110) return false;
     return true;
 }
 
@@ -97,21 +114,21 @@ static uint8_t protocol_nexwatch_checksum(uint8_t magic, uint32_t id, uint8_t pa
     return bit_lib_reverse_8_fast(a);
 }
 
-static bool protocol_nexwatch_can_be_decoded(uint8_t* data) {
-    if(!protocol_nexwatch_check_preamble(data, 0)) return false;
+static bool protocol_nexwatch_can_be_decoded(const BitLibWindow* window) {
+    if(!protocol_nexwatch_check_preamble(window, 0)) return false;
 
     // Check for reserved word (32-bit)
-    if(bit_lib_get_bits_32(data, 8, 32) != 0) {
+    if(bit_lib_window_get_bits_32(window, 8, 32) != 0) {
         return false;
     }
 
-    uint8_t parity = bit_lib_get_bits(data, 76, 4);
+    uint8_t parity = bit_lib_window_get_bits(window, 76, 4);
 
     // parity check
     // from 32b hex id, 4b mode
     uint8_t hex[5] = {0};
     for(uint8_t i = 0; i < 5; i++) {
-        hex[i] = bit_lib_get_bits(data, 40 + (i * 8), 8);
+        hex[i] = bit_lib_window_get_bits(window, 40 + (i * 8), 8);
     }
     //mode is only 4 bits.
     hex[4] &= 0xf0;
@@ -124,16 +141,18 @@ static bool protocol_nexwatch_can_be_decoded(uint8_t* data) {
     return true;
 }
 
-static bool protocol_nexwatch_decoder_feed_internal(bool polarity, uint32_t time, uint8_t* data) {
-    time += (NEXWATCH_US_PER_BIT / 2);
-
-    size_t bit_count = (time / NEXWATCH_US_PER_BIT);
+static bool protocol_nexwatch_decoder_feed_internal(
+    bool polarity,
+    uint32_t bit_count,
+    BitLibWindow* window,
+    uint8_t* data) {
     bool result = false;
 
     if(bit_count < NEXWATCH_ENCODED_BIT_SIZE) {
         for(size_t i = 0; i < bit_count; i++) {
-            bit_lib_push_bit(data, NEXWATCH_ENCODED_DATA_SIZE, polarity);
-            if(protocol_nexwatch_can_be_decoded(data)) {
+            bit_lib_window_push_bit(window, polarity);
+            if(protocol_nexwatch_can_be_decoded(window)) {
+                bit_lib_window_copy(window, data);
                 result = true;
                 break;
             }
@@ -168,46 +187,48 @@ static void protocol_nexwatch_decoder_save(uint8_t* data_to, const uint8_t* data
     data_to[5] = (uint8_t)(check >>= 8);
 }
 
-bool protocol_nexwatch_decoder_feed(ProtocolNexwatch* protocol, bool level, uint32_t duration) {
+bool protocol_nexwatch_decoder_feed(ProtocolNexwatch* protocol, const LFRFIDPSKSymbols* symbols) {
+    const bool level = symbols->level;
     bool result = false;
 
-    if(duration > (NEXWATCH_US_PER_BIT / 2)) {
-        if(protocol_nexwatch_decoder_feed_internal(level, duration, protocol->encoded_data)) {
+    if(symbols->bit_count) {
+        if(protocol_nexwatch_decoder_feed_internal(
+               level, symbols->bit_count, &protocol->encoded_window, protocol->encoded_data)) {
             protocol_nexwatch_decoder_save(protocol->data, protocol->encoded_data);
             result = true;
             return result;
         }
 
         if(protocol_nexwatch_decoder_feed_internal(
-               !level, duration, protocol->negative_encoded_data)) {
-            protocol_nexwatch_decoder_save(protocol->data, protocol->negative_encoded_data);
+               !level,
+               symbols->bit_count,
+               &protocol->negative_encoded_window,
+               protocol->encoded_data)) {
+            protocol_nexwatch_decoder_save(protocol->data, protocol->encoded_data);
             result = true;
             return result;
         }
     }
 
-    if(duration > (NEXWATCH_US_PER_BIT / 4)) {
-        // Try to decode wrong phase synced data
-        if(level) {
-            duration += 120;
-        } else {
-            if(duration > 120) {
-                duration -= 120;
-            }
-        }
-
+    // Try to decode wrong phase synced data
+    if(symbols->corrupted_bit_count) {
         if(protocol_nexwatch_decoder_feed_internal(
-               level, duration, protocol->corrupted_encoded_data)) {
-            protocol_nexwatch_decoder_save(protocol->data, protocol->corrupted_encoded_data);
+               level,
+               symbols->corrupted_bit_count,
+               &protocol->corrupted_encoded_window,
+               protocol->encoded_data)) {
+            protocol_nexwatch_decoder_save(protocol->data, protocol->encoded_data);
 
             result = true;
             return result;
         }
 
         if(protocol_nexwatch_decoder_feed_internal(
-               !level, duration, protocol->corrupted_negative_encoded_data)) {
-            protocol_nexwatch_decoder_save(
-                protocol->data, protocol->corrupted_negative_encoded_data);
+               !level,
+               symbols->corrupted_bit_count,
+               &protocol->corrupted_negative_encoded_window,
+               protocol->encoded_data)) {
+            protocol_nexwatch_decoder_save(protocol->data, protocol->encoded_data);
 
             result = true;
             return result;
@@ -310,7 +331,8 @@ const ProtocolBase protocol_nexwatch = {
     .decoder =
         {
             .start = (ProtocolDecoderStart)protocol_nexwatch_decoder_start,
-            .feed = (ProtocolDecoderFeed)protocol_nexwatch_decoder_feed,
+            .demodulator = &lfrfid_demodulator_psk,
+            .feed_demodulated = (ProtocolDecoderFeedDemodulated)protocol_nexwatch_decoder_feed,
         },
     .encoder =
         {
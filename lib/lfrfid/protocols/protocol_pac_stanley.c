@@ -27,11 +27,17 @@ typedef struct {
     bool got_preamble;
     size_t encoded_index;
     uint8_t encoded_data[PAC_STANLEY_ENCODED_BYTE_FULL_SIZE];
+    BitLibWindow encoded_window;
+    uint8_t encoded_window_buffer[BIT_LIB_WINDOW_BUFFER_SIZE(PAC_STANLEY_ENCODED_BYTE_FULL_SIZE)];
     uint8_t data[PAC_STANLEY_DECODED_DATA_SIZE];
 } ProtocolPACStanley;
 
 ProtocolPACStanley* protocol_pac_stanley_alloc(void) {
     ProtocolPACStanley* protocol = malloc(sizeof(ProtocolPACStanley));
+    bit_lib_window_init(
+        &protocol->encoded_window,
+        protocol->encoded_window_buffer,
+        PAC_STANLEY_ENCODED_BYTE_FULL_SIZE);
     return (void*)protocol;
 }
 
@@ -57,15 +63,19 @@ static void protocol_pac_stanley_decode(ProtocolPACStanley* protocol) {
 }
 
 static bool protocol_pac_stanley_can_be_decoded(ProtocolPACStanley* protocol) {
+    const BitLibWindow* window = &protocol->encoded_window;
+
     // Check preamble
-    if(bit_lib_get_bits(protocol->encoded_data, 0, 8) != 0b11111111) return false;
-    if(bit_lib_get_bit(protocol->encoded_data, 8) != 0) return false;
-    if(bit_lib_get_bit(protocol->encoded_data, 9) != 0) return false;
-    if(bit_lib_get_bit(protocol->encoded_data, 10) != 1) return false;
-    if(bit_lib_get_bits(protocol->encoded_data, 11, 8) != 0b00000010) return false;
+    if(bit_lib_window_get_bits(window, 0, 8) != 0b11111111) return false;
+    if(bit_lib_window_get_bit(window, 8) != 0) return false;
+    if(bit_lib_window_get_bit(window, 9) != 0) return false;
+    if(bit_lib_window_get_bit(window, 10) != 1) return false;
+    if(bit_lib_window_get_bits(window, 11, 8) != 0b00000010) return false;
 
     // Check next preamble
-    if(bit_lib_get_bits(protocol->encoded_data, 128, 8) != 0b11111111) return false;
+    if(bit_lib_window_get_bits(window, 128, 8) != 0b11111111) return false;
+
+    bit_lib_window_copy(window, protocol->encoded_data);
 
     // Checksum
     uint8_t checksum = 0;
@@ -111,10 +121,7 @@ bool protocol_pac_stanley_decoder_feed(ProtocolPACStanley* protocol, bool level,
 
     if(pulses) {
         for(uint8_t i = 0; i < pulses; i++) {
-            bit_lib_push_bit(
-                protocol->encoded_data,
-                PAC_STANLEY_ENCODED_BYTE_FULL_SIZE,
-                level ^ protocol->inverted);
+            bit_lib_window_push_bit(&protocol->encoded_window, level ^ protocol->inverted);
         }
         pushed = true;
     }
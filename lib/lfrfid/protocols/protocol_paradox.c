@@ -1,13 +1,9 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
-#include <lfrfid/tools/fsk_demod.h>
 #include <lfrfid/tools/fsk_osc.h>
 #include <lfrfid/tools/bit_lib.h>
 #include "lfrfid_protocols.h"
-
-#define JITTER_TIME (20)
-#define MIN_TIME (64 - JITTER_TIME)
-#define MAX_TIME (80 + JITTER_TIME)
+#include "lfrfid_demodulators.h"
 
 #define PARADOX_DECODED_DATA_SIZE (6)
 
@@ -16,32 +12,29 @@
 #define PARADOX_ENCODED_DATA_SIZE (((PARADOX_ENCODED_BIT_SIZE) / 8) + 1)
 #define PARADOX_ENCODED_DATA_LAST (PARADOX_ENCODED_DATA_SIZE - 1)
 
-typedef struct {
-    FSKDemod* fsk_demod;
-} ProtocolParadoxDecoder;
-
 typedef struct {
     FSKOsc* fsk_osc;
     uint8_t encoded_index;
 } ProtocolParadoxEncoder;
 
 typedef struct {
-    ProtocolParadoxDecoder decoder;
     ProtocolParadoxEncoder encoder;
     uint8_t encoded_data[PARADOX_ENCODED_DATA_SIZE];
+    BitLibWindow encoded_window;
+    uint8_t encoded_window_buffer[BIT_LIB_WINDOW_BUFFER_SIZE(PARADOX_ENCODED_DATA_SIZE)];
     uint8_t data[PARADOX_DECODED_DATA_SIZE];
 } ProtocolParadox;
 
 ProtocolParadox* protocol_paradox_alloc(void) {
     ProtocolParadox* protocol = malloc(sizeof(ProtocolParadox));
-    protocol->decoder.fsk_demod = fsk_demod_alloc(MIN_TIME, 6, MAX_TIME, 5);
     protocol->encoder.fsk_osc = fsk_osc_alloc(8, 10, 50);
+    bit_lib_window_init(
+        &protocol->encoded_window, protocol->encoded_window_buffer, PARADOX_ENCODED_DATA_SIZE);
 
     return protocol;
 };
 
 void protocol_paradox_free(ProtocolParadox* protocol) {
-    fsk_demod_free(protocol->decoder.fsk_demod);
     fsk_osc_free(protocol->encoder.fsk_osc);
     free(protocol);
 };
@@ -52,21 +45,25 @@ uint8_t* protocol_paradox_get_data(ProtocolParadox* protocol) {
 
 void protocol_paradox_decoder_start(ProtocolParadox* protocol) {
     memset(protocol->encoded_data, 0, PARADOX_ENCODED_DATA_SIZE);
+    bit_lib_window_reset(&protocol->encoded_window);
 };
 
 static bool protocol_paradox_can_be_decoded(ProtocolParadox* protocol) {
+    const BitLibWindow* window = &protocol->encoded_window;
+
     // check preamble
-    if(protocol->encoded_data[0] != 0b00001111 ||
-       protocol->encoded_data[PARADOX_ENCODED_DATA_LAST] != 0b00001111)
+    if(bit_lib_window_get_bits(window, 0, 8) != 0b00001111 ||
+       bit_lib_window_get_bits(window, PARADOX_ENCODED_DATA_LAST * 8, 8) != 0b00001111)
         return false;
 
     for(uint32_t i = PARADOX_PREAMBLE_LENGTH; i < 96; i += 2) {
-        if(bit_lib_get_bit(protocol->encoded_data, i) ==
-           bit_lib_get_bit(protocol->encoded_data, i + 1)) {
+        if(bit_lib_window_get_bit(window, i) == bit_lib_window_get_bit(window, i + 1)) {
             return false;
         }
     }
 
+    bit_lib_window_copy(window, protocol->encoded_data);
+
     return true;
 }
 
@@ -84,14 +81,13 @@ static void protocol_paradox_decode(uint8_t* encoded_data, uint8_t* decoded_data
     bit_lib_push_bit(decoded_data, PARADOX_DECODED_DATA_SIZE, 0);
 }
 
-bool protocol_paradox_decoder_feed(ProtocolParadox* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
+bool protocol_paradox_decoder_feed(ProtocolParadox* protocol, const LFRFIDFSKSymbols* symbols) {
+    bool value = symbols->value;
+    uint32_t count = lfrfid_fsk_symbols_bit_count(symbols, 6, 5);
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     if(count > 0) {
         for(size_t i = 0; i < count; i++) {
-            bit_lib_push_bit(protocol->encoded_data, PARADOX_ENCODED_DATA_SIZE, value);
+            bit_lib_window_push_bit(&protocol->encoded_window, value);
             if(protocol_paradox_can_be_decoded(protocol)) {
                 protocol_paradox_decode(protocol->encoded_data, protocol->data);
 
@@ -227,7 +223,8 @@ const ProtocolBase protocol_paradox = {
     .decoder =
         {
             .start = (ProtocolDecoderStart)protocol_paradox_decoder_start,
-            .feed = (ProtocolDecoderFeed)protocol_paradox_decoder_feed,
+            .demodulator = &lfrfid_demodulator_fsk,
+            .feed_demodulated = (ProtocolDecoderFeedDemodulated)protocol_paradox_decoder_feed,
         },
     .encoder =
         {
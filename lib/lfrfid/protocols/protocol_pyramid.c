@@ -1,14 +1,10 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
-#include <lfrfid/tools/fsk_demod.h>
 #include <lfrfid/tools/fsk_osc.h>
 #include "lfrfid_protocols.h"
+#include "lfrfid_demodulators.h"
 #include <lfrfid/tools/bit_lib.h>
 
-#define JITTER_TIME (20)
-#define MIN_TIME (64 - JITTER_TIME)
-#define MAX_TIME (80 + JITTER_TIME)
-
 #define PYRAMID_DATA_SIZE 13
 #define PYRAMID_PREAMBLE_SIZE 3
 
@@ -18,10 +14,6 @@
 #define PYRAMID_DECODED_DATA_SIZE (4)
 #define PYRAMID_DECODED_BIT_SIZE ((PYRAMID_ENCODED_BIT_SIZE - PYRAMID_PREAMBLE_SIZE * 8) / 2)
 
-typedef struct {
-    FSKDemod* fsk_demod;
-} ProtocolPyramidDecoder;
-
 typedef struct {
     FSKOsc* fsk_osc;
     uint8_t encoded_index;
@@ -29,22 +21,23 @@ typedef struct {
 } ProtocolPyramidEncoder;
 
 typedef struct {
-    ProtocolPyramidDecoder decoder;
     ProtocolPyramidEncoder encoder;
     uint8_t encoded_data[PYRAMID_ENCODED_DATA_SIZE];
+    BitLibWindow encoded_window;
+    uint8_t encoded_window_buffer[BIT_LIB_WINDOW_BUFFER_SIZE(PYRAMID_ENCODED_DATA_SIZE)];
     uint8_t data[PYRAMID_DECODED_DATA_SIZE];
 } ProtocolPyramid;
 
 ProtocolPyramid* protocol_pyramid_alloc(void) {
     ProtocolPyramid* protocol = malloc(sizeof(ProtocolPyramid));
-    protocol->decoder.fsk_demod = fsk_demod_alloc(MIN_TIME, 6, MAX_TIME, 5);
     protocol->encoder.fsk_osc = fsk_osc_alloc(8, 10, 50);
+    bit_lib_window_init(
+        &protocol->encoded_window, protocol->encoded_window_buffer, PYRAMID_ENCODED_DATA_SIZE);
 
     return protocol;
 };
 
 void protocol_pyramid_free(ProtocolPyramid* protocol) {
-    fsk_demod_free(protocol->decoder.fsk_demod);
     fsk_osc_free(protocol->encoder.fsk_osc);
     free(protocol);
 };
@@ -55,20 +48,26 @@ uint8_t* protocol_pyramid_get_data(ProtocolPyramid* protocol) {
 
 void protocol_pyramid_decoder_start(ProtocolPyramid* protocol) {
     memset(protocol->encoded_data, 0, PYRAMID_ENCODED_DATA_SIZE);
+    bit_lib_window_reset(&protocol->encoded_window);
 };
 
-static bool protocol_pyramid_can_be_decoded(uint8_t* data) {
+static bool protocol_pyramid_can_be_decoded(ProtocolPyramid* protocol) {
+    const BitLibWindow* window = &protocol->encoded_window;
+    uint8_t* data = protocol->encoded_data;
+
     // check preamble
-    if(bit_lib_get_bits_16(data, 0, 16) != 0b0000000000000001 ||
-       bit_lib_get_bits(data, 16, 8) != 0b00000001) {
+    if(bit_lib_window_get_bits_16(window, 0, 16) != 0b0000000000000001 ||
+       bit_lib_window_get_bits(window, 16, 8) != 0b00000001) {
         return false;
     }
 
-    if(bit_lib_get_bits_16(data, 128, 16) != 0b0000000000000001 ||
-       bit_lib_get_bits(data, 136, 8) != 0b00000001) {
+    if(bit_lib_window_get_bits_16(window, 128, 16) != 0b0000000000000001 ||
+       bit_lib_window_get_bits(window, 136, 8) != 0b00000001) {
         return false;
     }
 
+    bit_lib_window_copy(window, data);
+
     uint8_t checksum = bit_lib_get_bits(data, 120, 8);
     uint8_t checksum_data[13] = {0x00};
     for(uint8_t i = 0; i < 13; i++) {
@@ -105,16 +104,15 @@ static void protocol_pyramid_decode(ProtocolPyramid* protocol) {
     bit_lib_copy_bits(protocol->data, 16, 16, protocol->encoded_data, 81 + 8);
 }
 
-bool protocol_pyramid_decoder_feed(ProtocolPyramid* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
+bool protocol_pyramid_decoder_feed(ProtocolPyramid* protocol, const LFRFIDFSKSymbols* symbols) {
+    bool value = symbols->value;
+    uint32_t count = lfrfid_fsk_symbols_bit_count(symbols, 6, 5);
     bool result = false;
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     if(count > 0) {
         for(size_t i = 0; i < count; i++) {
-            bit_lib_push_bit(protocol->encoded_data, PYRAMID_ENCODED_DATA_SIZE, value);
-            if(protocol_pyramid_can_be_decoded(protocol->encoded_data)) {
+            bit_lib_window_push_bit(&protocol->encoded_window, value);
+            if(protocol_pyramid_can_be_decoded(protocol)) {
                 protocol_pyramid_decode(protocol);
                 result = true;
             }
@@ -269,7 +267,8 @@ const ProtocolBase protocol_pyramid = {
     .decoder =
         {
             .start = (ProtocolDecoderStart)protocol_pyramid_decoder_start,
-            .feed = (ProtocolDecoderFeed)protocol_pyramid_decoder_feed,
+            .demodulator = &lfrfid_demodulator_fsk,
+            .feed_demodulated = (ProtocolDecoderFeedDemodulated)protocol_pyramid_decoder_feed,
         },
     .encoder =
         {
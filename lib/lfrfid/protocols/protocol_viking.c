@@ -1,8 +1,8 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
-#include <toolbox/manchester_decoder.h>
 #include <lfrfid/tools/bit_lib.h>
 #include "lfrfid_protocols.h"
+#include "lfrfid_demodulators.h"
 
 #define VIKING_CLOCK_PER_BIT (32)
 
@@ -13,27 +13,20 @@
 #define VIKING_ENCODED_BYTE_FULL_SIZE (VIKING_ENCODED_BYTE_SIZE + VIKING_PREAMBLE_BYTE_SIZE)
 #define VIKING_DECODED_DATA_SIZE 4
 
-#define VIKING_READ_SHORT_TIME (128)
-#define VIKING_READ_LONG_TIME (256)
-#define VIKING_READ_JITTER_TIME (60)
-
-#define VIKING_READ_SHORT_TIME_LOW (VIKING_READ_SHORT_TIME - VIKING_READ_JITTER_TIME)
-#define VIKING_READ_SHORT_TIME_HIGH (VIKING_READ_SHORT_TIME + VIKING_READ_JITTER_TIME)
-#define VIKING_READ_LONG_TIME_LOW (VIKING_READ_LONG_TIME - VIKING_READ_JITTER_TIME)
-#define VIKING_READ_LONG_TIME_HIGH (VIKING_READ_LONG_TIME + VIKING_READ_JITTER_TIME)
-
 typedef struct {
     uint8_t data[VIKING_DECODED_DATA_SIZE];
     uint8_t encoded_data[VIKING_ENCODED_BYTE_FULL_SIZE];
+    BitLibWindow encoded_window;
+    uint8_t encoded_window_buffer[BIT_LIB_WINDOW_BUFFER_SIZE(VIKING_ENCODED_BYTE_FULL_SIZE)];
 
     uint8_t encoded_data_index;
     bool encoded_polarity;
-
-    ManchesterState decoder_manchester_state;
 } ProtocolViking;
 
 ProtocolViking* protocol_viking_alloc(void) {
     ProtocolViking* proto = malloc(sizeof(ProtocolViking));
+    bit_lib_window_init(
+        &proto->encoded_window, proto->encoded_window_buffer, VIKING_ENCODED_BYTE_FULL_SIZE);
     return (void*)proto;
 };
 
@@ -51,13 +44,17 @@ static void protocol_viking_decode(ProtocolViking* protocol) {
 }
 
 static bool protocol_viking_can_be_decoded(ProtocolViking* protocol) {
+    const BitLibWindow* window = &protocol->encoded_window;
+
     // check 24 bits preamble
-    if(bit_lib_get_bits_16(protocol->encoded_data, 0, 16) != 0b1111001000000000) return false;
-    if(bit_lib_get_bits(protocol->encoded_data, 16, 8) != 0b00000000) return false;
+    if(bit_lib_window_get_bits_16(window, 0, 16) != 0b1111001000000000) return false;
+    if(bit_lib_window_get_bits(window, 16, 8) != 0b00000000) return false;
 
     // check next 24 bits preamble
-    if(bit_lib_get_bits_16(protocol->encoded_data, 64, 16) != 0b1111001000000000) return false;
-    if(bit_lib_get_bits(protocol->encoded_data, 80, 8) != 0b00000000) return false;
+    if(bit_lib_window_get_bits_16(window, 64, 16) != 0b1111001000000000) return false;
+    if(bit_lib_window_get_bits(window, 80, 8) != 0b00000000) return false;
+
+    bit_lib_window_copy(window, protocol->encoded_data);
 
     // Checksum
     uint32_t checksum = bit_lib_get_bits(protocol->encoded_data, 0, 8) ^
@@ -75,45 +72,19 @@ static bool protocol_viking_can_be_decoded(ProtocolViking* protocol) {
 
 void protocol_viking_decoder_start(ProtocolViking* protocol) {
     memset(protocol->encoded_data, 0, VIKING_ENCODED_BYTE_FULL_SIZE);
-    manchester_advance(
-        protocol->decoder_manchester_state,
-        ManchesterEventReset,
-        &protocol->decoder_manchester_state,
-        NULL);
+    bit_lib_window_reset(&protocol->encoded_window);
 };
 
-bool protocol_viking_decoder_feed(ProtocolViking* protocol, bool level, uint32_t duration) {
+bool protocol_viking_decoder_feed(
+    ProtocolViking* protocol,
+    const LFRFIDManchesterSymbols* symbols) {
     bool result = false;
 
-    ManchesterEvent event = ManchesterEventReset;
-
-    if(duration > VIKING_READ_SHORT_TIME_LOW && duration < VIKING_READ_SHORT_TIME_HIGH) {
-        if(!level) {
-            event = ManchesterEventShortHigh;
-        } else {
-            event = ManchesterEventShortLow;
-        }
-    } else if(duration > VIKING_READ_LONG_TIME_LOW && duration < VIKING_READ_LONG_TIME_HIGH) {
-        if(!level) {
-            event = ManchesterEventLongHigh;
-        } else {
-            event = ManchesterEventLongLow;
-        }
-    }
-
-    if(event != ManchesterEventReset) {
-        bool data;
-        bool data_ok = manchester_advance(
-            protocol->decoder_manchester_state, event, &protocol->decoder_manchester_state, &data);
+    bit_lib_window_push_bit(&protocol->encoded_window, symbols->bit);
 
-        if(data_ok) {
-            bit_lib_push_bit(protocol->encoded_data, VIKING_ENCODED_BYTE_FULL_SIZE, data);
-
-            if(protocol_viking_can_be_decoded(protocol)) {
-                protocol_viking_decode(protocol);
-                result = true;
-            }
-        }
+    if(protocol_viking_can_be_decoded(protocol)) {
+        protocol_viking_decode(protocol);
+        result = true;
     }
 
     return result;
@@ -192,7 +163,8 @@ const ProtocolBase protocol_viking = {
     .decoder =
         {
             .start = (ProtocolDecoderStart)protocol_viking_decoder_start,
-            .feed = (ProtocolDecoderFeed)protocol_viking_decoder_feed,
+            .demodulator = &lfrfid_demodulator_manchester_rf32,
+            .feed_demodulated = (ProtocolDecoderFeedDemodulated)protocol_viking_decoder_feed,
         },
     .encoder =
         {
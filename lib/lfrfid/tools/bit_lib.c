@@ -1,6 +1,7 @@
 #include "bit_lib.h"
 #include <core/check.h>
 #include <stdio.h>
+#include <string.h>
 
 void bit_lib_push_bit(uint8_t* data, size_t data_size, bool bit) {
     size_t last_index = data_size - 1;
@@ -11,6 +12,52 @@ void bit_lib_push_bit(uint8_t* data, size_t data_size, bool bit) {
     data[last_index] = (data[last_index] << 1) | bit;
 }
 
+void bit_lib_window_init(BitLibWindow* window, uint8_t* buffer, size_t size) {
+    furi_check(window);
+    furi_check(buffer);
+    furi_check(size > 0);
+
+    window->buffer = buffer;
+    window->size = size;
+    bit_lib_window_reset(window);
+}
+
+void bit_lib_window_reset(BitLibWindow* window) {
+    memset(window->buffer, 0, BIT_LIB_WINDOW_BUFFER_SIZE(window->size));
+    window->head = 0;
+}
+
+void bit_lib_window_push_bit(BitLibWindow* window, bool bit) {
+    const size_t bit_size = window->size * 8;
+
+    // Overwrite the oldest bit and its mirror, newest bit becomes head + bit_size - 1
+    bit_lib_set_bit(window->buffer, window->head, bit);
+    bit_lib_set_bit(window->buffer, window->head + bit_size, bit);
+    bit_lib_increment_index(window->head, bit_size);
+}
+
+bool bit_lib_window_get_bit(const BitLibWindow* window, size_t position) {
+    return bit_lib_get_bit(window->buffer, window->head + position);
+}
+
+uint8_t bit_lib_window_get_bits(const BitLibWindow* window, size_t position, uint8_t length) {
+    return bit_lib_get_bits(window->buffer, window->head + position, length);
+}
+
+uint16_t bit_lib_window_get_bits_16(const BitLibWindow* window, size_t position, uint8_t length) {
+    return bit_lib_get_bits_16(window->buffer, window->head + position, length);
+}
+
+uint32_t bit_lib_window_get_bits_32(const BitLibWindow* window, size_t position, uint8_t length) {
+    return bit_lib_get_bits_32(window->buffer, window->head + position, length);
+}
+
+void bit_lib_window_copy(const BitLibWindow* window, uint8_t* data) {
+    for(size_t i = 0; i < window->size; ++i) {
+        data[i] = bit_lib_get_bits(window->buffer, window->head + i * 8, 8);
+    }
+}
+
 void bit_lib_set_bit(uint8_t* data, size_t position, bool bit) {
     if(bit) {
         data[position / 8] |= 1UL << (7 - (position % 8));
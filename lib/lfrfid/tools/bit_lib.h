@@ -41,6 +41,95 @@ typedef enum {
  */
 void bit_lib_push_bit(uint8_t* data, size_t data_size, bool bit);
 
+/**
+ * @brief Circular bit window, holds last size * 8 bits of a bit stream.
+ * 
+ * Bits are written twice, at head and head + size * 8, so window is always a
+ * contiguous bit array starting at head: push is O(1) and reads don't wrap.
+ * Position 0 is the oldest bit, same as with bit_lib_push_bit.
+ */
+typedef struct {
+    uint8_t* buffer;
+    size_t size;
+    size_t head;
+} BitLibWindow;
+
+/** @brief Buffer size required by window of given size.
+ *  @param size window size in bytes
+ */
+#define BIT_LIB_WINDOW_BUFFER_SIZE(size) ((size) * 2 + 1)
+
+/**
+ * @brief Init window and clear it
+ * 
+ * @param window window to init
+ * @param buffer BIT_LIB_WINDOW_BUFFER_SIZE(size) bytes
+ * @param size window size in bytes
+ */
+void bit_lib_window_init(BitLibWindow* window, uint8_t* buffer, size_t size);
+
+/**
+ * @brief Clear window, fill it with zeros
+ * 
+ * @param window 
+ */
+void bit_lib_window_reset(BitLibWindow* window);
+
+/**
+ * @brief Push a bit into window, dropping the oldest one
+ * 
+ * @param window 
+ * @param bit bit to push
+ */
+void bit_lib_window_push_bit(BitLibWindow* window, bool bit);
+
+/**
+ * @brief Get window bit
+ * 
+ * @param window 
+ * @param position bit position, 0 is the oldest one
+ * @return bool 
+ */
+bool bit_lib_window_get_bit(const BitLibWindow* window, size_t position);
+
+/**
+ * @brief Get window bits, as uint8_t
+ * 
+ * @param window 
+ * @param position position of the first bit
+ * @param length the length of the bits
+ * @return uint8_t 
+ */
+uint8_t bit_lib_window_get_bits(const BitLibWindow* window, size_t position, uint8_t length);
+
+/**
+ * @brief Get window bits, as uint16_t
+ * 
+ * @param window 
+ * @param position position of the first bit
+ * @param length the length of the bits
+ * @return uint16_t 
+ */
+uint16_t bit_lib_window_get_bits_16(const BitLibWindow* window, size_t position, uint8_t length);
+
+/**
+ * @brief Get window bits, as uint32_t
+ * 
+ * @param window 
+ * @param position position of the first bit
+ * @param length the length of the bits
+ * @return uint32_t 
+ */
+uint32_t bit_lib_window_get_bits_32(const BitLibWindow* window, size_t position, uint8_t length);
+
+/**
+ * @brief Copy window to a plain bit array, as filled by bit_lib_push_bit
+ * 
+ * @param window 
+ * @param data destination array, window size bytes
+ */
+void bit_lib_window_copy(const BitLibWindow* window, uint8_t* data);
+
 /** @brief Set a bit in a byte array.
  *  @param data array to set bit in
  *  @param position The position of the bit to set.
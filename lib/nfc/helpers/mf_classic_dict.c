@@ -2,18 +2,58 @@
 
 #include <lib/toolbox/args.h>
 #include <lib/flipper_format/flipper_format.h>
+#include <lib/nfc/protocols/nfc_util.h>
 
 #define MF_CLASSIC_DICT_FLIPPER_PATH EXT_PATH("nfc/assets/mf_classic_dict.nfc")
 #define MF_CLASSIC_DICT_USER_PATH EXT_PATH("nfc/assets/mf_classic_dict_user.nfc")
 #define MF_CLASSIC_DICT_UNIT_TEST_PATH EXT_PATH("unit_tests/mf_classic_dict.nfc")
 
+#define MF_CLASSIC_DICT_FLIPPER_INDEX_PATH EXT_PATH("nfc/assets/mf_classic_dict.mfd")
+#define MF_CLASSIC_DICT_USER_INDEX_PATH EXT_PATH("nfc/assets/mf_classic_dict_user.mfd")
+#define MF_CLASSIC_DICT_UNIT_TEST_INDEX_PATH EXT_PATH("unit_tests/mf_classic_dict.mfd")
+
 #define TAG "MfClassicDict"
 
 #define NFC_MF_CLASSIC_KEY_LEN (13)
 
+/* Compiled dictionary (.mfd) layout, header values are little endian:
+ * header, keys in source file order, then the same keys sorted.
+ * Keys are stored most significant byte first, so memcmp order is numeric order.
+ * Text dictionary stays the source, .mfd is rebuilt when it is older or
+ * its recorded source size doesn't match.
+ */
+#define MF_CLASSIC_DICT_INDEX_MAGIC (0x3144464DUL) /* "MFD1" */
+#define MF_CLASSIC_DICT_INDEX_VERSION (1U)
+#define MF_CLASSIC_DICT_KEY_SIZE (6U)
+#define MF_CLASSIC_DICT_PAGE_KEYS (32U)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t source_size;
+    uint32_t key_count;
+} MfClassicDictIndexHeader;
+
+typedef enum {
+    MfClassicDictSectionOrdered,
+    MfClassicDictSectionSorted,
+
+    MfClassicDictSectionNum,
+} MfClassicDictSection;
+
+typedef struct {
+    uint32_t first;
+    uint32_t count;
+    uint8_t keys[MF_CLASSIC_DICT_PAGE_KEYS * MF_CLASSIC_DICT_KEY_SIZE];
+} MfClassicDictPage;
+
 struct MfClassicDict {
     Stream* stream;
+    File* index;
+    const char* index_path;
     uint32_t total_keys;
+    uint32_t next_key;
+    MfClassicDictPage pages[MfClassicDictSectionNum];
 };
 
 bool mf_classic_dict_check_presence(MfClassicDictType dict_type) {
@@ -34,38 +74,335 @@ bool mf_classic_dict_check_presence(MfClassicDictType dict_type) {
     return dict_present;
 }
 
+static void mf_classic_dict_int_to_str(const uint8_t* key_int, FuriString* key_str) {
+    furi_string_reset(key_str);
+    for(size_t i = 0; i < MF_CLASSIC_DICT_KEY_SIZE; i++) {
+        furi_string_cat_printf(key_str, "%02X", key_int[i]);
+    }
+}
+
+static bool mf_classic_dict_str_to_key(FuriString* key_str, uint8_t* key) {
+    for(size_t i = 0; i < MF_CLASSIC_DICT_KEY_SIZE; i++) {
+        if(!args_char_to_hex(
+               furi_string_get_char(key_str, i * 2),
+               furi_string_get_char(key_str, i * 2 + 1),
+               &key[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool mf_classic_dict_parse_line(FuriString* line, uint8_t* key) {
+    if(furi_string_get_char(line, 0) == '#') return false;
+    if(furi_string_size(line) != NFC_MF_CLASSIC_KEY_LEN) return false;
+
+    return mf_classic_dict_str_to_key(line, key);
+}
+
+static bool mf_classic_dict_parse_str(FuriString* key_str, uint8_t* key) {
+    if(furi_string_size(key_str) != NFC_MF_CLASSIC_KEY_LEN - 1) return false;
+
+    return mf_classic_dict_str_to_key(key_str, key);
+}
+
+static int mf_classic_dict_key_cmp(const void* a, const void* b) {
+    return memcmp(a, b, MF_CLASSIC_DICT_KEY_SIZE);
+}
+
+static void mf_classic_dict_index_reset_cache(MfClassicDict* dict) {
+    for(size_t i = 0; i < MfClassicDictSectionNum; i++) {
+        dict->pages[i].count = 0;
+    }
+}
+
+static uint32_t mf_classic_dict_index_get_offset(
+    MfClassicDict* dict,
+    MfClassicDictSection section,
+    uint32_t index) {
+    return sizeof(MfClassicDictIndexHeader) +
+           (section * dict->total_keys + index) * MF_CLASSIC_DICT_KEY_SIZE;
+}
+
+static const uint8_t* mf_classic_dict_index_get_key(
+    MfClassicDict* dict,
+    MfClassicDictSection section,
+    uint32_t index) {
+    if(index >= dict->total_keys) return NULL;
+
+    MfClassicDictPage* page = &dict->pages[section];
+    if(index < page->first || index >= page->first + page->count) {
+        page->first = index - index % MF_CLASSIC_DICT_PAGE_KEYS;
+        page->count = MIN(MF_CLASSIC_DICT_PAGE_KEYS, dict->total_keys - page->first);
+
+        const uint16_t page_size = page->count * MF_CLASSIC_DICT_KEY_SIZE;
+        if(!storage_file_seek(
+               dict->index, mf_classic_dict_index_get_offset(dict, section, page->first), true) ||
+           storage_file_read(dict->index, page->keys, page_size) != page_size) {
+            page->count = 0;
+            return NULL;
+        }
+    }
+
+    return &page->keys[(index - page->first) * MF_CLASSIC_DICT_KEY_SIZE];
+}
+
+// Find first sorted key which is not less than the given one
+static bool mf_classic_dict_index_lower_bound(
+    MfClassicDict* dict,
+    const uint8_t* key,
+    uint32_t* position) {
+    uint32_t low = 0;
+    uint32_t high = dict->total_keys;
+
+    while(low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        const uint8_t* mid_key =
+            mf_classic_dict_index_get_key(dict, MfClassicDictSectionSorted, mid);
+        if(!mid_key) return false;
+
+        if(mf_classic_dict_key_cmp(mid_key, key) < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    *position = low;
+    return true;
+}
+
+static bool mf_classic_dict_index_contains(MfClassicDict* dict, const uint8_t* key) {
+    uint32_t position = 0;
+    if(!mf_classic_dict_index_lower_bound(dict, key, &position)) return false;
+
+    const uint8_t* found_key =
+        mf_classic_dict_index_get_key(dict, MfClassicDictSectionSorted, position);
+    return found_key && (mf_classic_dict_key_cmp(found_key, key) == 0);
+}
+
+static bool mf_classic_dict_index_write_header(MfClassicDict* dict) {
+    MfClassicDictIndexHeader header = {
+        .magic = MF_CLASSIC_DICT_INDEX_MAGIC,
+        .version = MF_CLASSIC_DICT_INDEX_VERSION,
+        .source_size = stream_size(dict->stream),
+        .key_count = dict->total_keys,
+    };
+
+    return storage_file_seek(dict->index, 0, true) &&
+           (storage_file_write(dict->index, &header, sizeof(header)) == sizeof(header));
+}
+
+static bool
+    mf_classic_dict_index_is_actual(MfClassicDict* dict, Storage* storage, const char* path) {
+    bool is_actual = false;
+
+    do {
+        uint32_t source_timestamp, index_timestamp;
+        if(storage_common_timestamp(storage, path, &source_timestamp) != FSE_OK) break;
+        if(storage_common_timestamp(storage, dict->index_path, &index_timestamp) != FSE_OK) break;
+        if(index_timestamp < source_timestamp) break;
+
+        if(!storage_file_open(dict->index, dict->index_path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING))
+            break;
+
+        MfClassicDictIndexHeader header;
+        if(storage_file_read(dict->index, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != MF_CLASSIC_DICT_INDEX_MAGIC) break;
+        if(header.version != MF_CLASSIC_DICT_INDEX_VERSION) break;
+        if(header.source_size != stream_size(dict->stream)) break;
+
+        dict->total_keys = header.key_count;
+        if(storage_file_size(dict->index) !=
+           mf_classic_dict_index_get_offset(dict, MfClassicDictSectionNum, 0))
+            break;
+
+        is_actual = true;
+    } while(false);
+
+    if(!is_actual) {
+        dict->total_keys = 0;
+        storage_file_close(dict->index);
+    }
+
+    return is_actual;
+}
+
+static bool mf_classic_dict_index_build(MfClassicDict* dict) {
+    FuriString* next_line = furi_string_alloc();
+    MfClassicDictPage* page = &dict->pages[MfClassicDictSectionOrdered];
+    uint8_t* keys = NULL;
+    bool success = false;
+
+    if(storage_file_is_open(dict->index)) {
+        storage_file_close(dict->index);
+    }
+    mf_classic_dict_index_reset_cache(dict);
+    dict->total_keys = 0;
+
+    do {
+        if(!storage_file_open(dict->index, dict->index_path, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS))
+            break;
+        if(!mf_classic_dict_index_write_header(dict)) break;
+
+        // Keys in source order, page is used as write buffer
+        bool is_written = true;
+        stream_rewind(dict->stream);
+        while(is_written && stream_read_line(dict->stream, next_line)) {
+            if(!mf_classic_dict_parse_line(
+                   next_line, &page->keys[page->count * MF_CLASSIC_DICT_KEY_SIZE])) {
+                continue;
+            }
+
+            dict->total_keys++;
+            if(++page->count == MF_CLASSIC_DICT_PAGE_KEYS) {
+                is_written = storage_file_write(dict->index, page->keys, sizeof(page->keys)) ==
+                             sizeof(page->keys);
+                page->count = 0;
+            }
+        }
+
+        const uint16_t tail_size = page->count * MF_CLASSIC_DICT_KEY_SIZE;
+        page->count = 0;
+        if(!is_written) break;
+        if(storage_file_write(dict->index, page->keys, tail_size) != tail_size) break;
+
+        // Same keys sorted
+        const size_t keys_size = dict->total_keys * MF_CLASSIC_DICT_KEY_SIZE;
+        if(keys_size) {
+            keys = malloc(keys_size);
+            if(!storage_file_seek(dict->index, sizeof(MfClassicDictIndexHeader), true)) break;
+            if(storage_file_read_large(dict->index, keys, keys_size) != keys_size) break;
+            qsort(keys, dict->total_keys, MF_CLASSIC_DICT_KEY_SIZE, mf_classic_dict_key_cmp);
+            if(storage_file_write_large(dict->index, keys, keys_size) != keys_size) break;
+        }
+
+        if(!mf_classic_dict_index_write_header(dict)) break;
+
+        success = true;
+    } while(false);
+
+    stream_rewind(dict->stream);
+
+    if(!success) {
+        FURI_LOG_W(TAG, "Failed to build %s", dict->index_path);
+        dict->total_keys = 0;
+        storage_file_close(dict->index);
+        Storage* storage = furi_record_open(RECORD_STORAGE);
+        storage_simply_remove(storage, dict->index_path);
+        furi_record_close(RECORD_STORAGE);
+    }
+
+    free(keys);
+    furi_string_free(next_line);
+    return success;
+}
+
+// Move data to the higher offset, tail first, so source is not overwritten
+static bool mf_classic_dict_index_move(
+    MfClassicDict* dict,
+    uint32_t from,
+    uint32_t to,
+    uint32_t size,
+    uint8_t* buffer,
+    uint16_t buffer_size) {
+    while(size) {
+        const uint16_t chunk_size = MIN(size, buffer_size);
+        size -= chunk_size;
+
+        if(!storage_file_seek(dict->index, from + size, true)) return false;
+        if(storage_file_read(dict->index, buffer, chunk_size) != chunk_size) return false;
+        if(!storage_file_seek(dict->index, to + size, true)) return false;
+        if(storage_file_write(dict->index, buffer, chunk_size) != chunk_size) return false;
+    }
+
+    return true;
+}
+
+static bool mf_classic_dict_index_insert(MfClassicDict* dict, const uint8_t* key) {
+    uint32_t position = 0;
+    if(!mf_classic_dict_index_lower_bound(dict, key, &position)) return false;
+
+    // New key is appended to ordered keys, so sorted keys move by one key,
+    // and the ones after the new key by two keys.
+    const uint32_t sorted_offset =
+        mf_classic_dict_index_get_offset(dict, MfClassicDictSectionSorted, 0);
+    const uint32_t key_offset = position * MF_CLASSIC_DICT_KEY_SIZE;
+    const uint32_t sorted_size = dict->total_keys * MF_CLASSIC_DICT_KEY_SIZE;
+    MfClassicDictPage* page = &dict->pages[MfClassicDictSectionSorted];
+
+    bool success = false;
+    do {
+        if(!mf_classic_dict_index_move(
+               dict,
+               sorted_offset + key_offset,
+               sorted_offset + key_offset + 2 * MF_CLASSIC_DICT_KEY_SIZE,
+               sorted_size - key_offset,
+               page->keys,
+               sizeof(page->keys)))
+            break;
+        if(!mf_classic_dict_index_move(
+               dict,
+               sorted_offset,
+               sorted_offset + MF_CLASSIC_DICT_KEY_SIZE,
+               key_offset,
+               page->keys,
+               sizeof(page->keys)))
+            break;
+
+        if(!storage_file_seek(dict->index, sorted_offset, true)) break;
+        if(storage_file_write(dict->index, key, MF_CLASSIC_DICT_KEY_SIZE) !=
+           MF_CLASSIC_DICT_KEY_SIZE)
+            break;
+        if(!storage_file_seek(
+               dict->index, sorted_offset + MF_CLASSIC_DICT_KEY_SIZE + key_offset, true))
+            break;
+        if(storage_file_write(dict->index, key, MF_CLASSIC_DICT_KEY_SIZE) !=
+           MF_CLASSIC_DICT_KEY_SIZE)
+            break;
+
+        dict->total_keys++;
+        if(!mf_classic_dict_index_write_header(dict)) break;
+
+        success = true;
+    } while(false);
+
+    mf_classic_dict_index_reset_cache(dict);
+
+    return success;
+}
+
 MfClassicDict* mf_classic_dict_alloc(MfClassicDictType dict_type) {
     MfClassicDict* dict = malloc(sizeof(MfClassicDict));
     Storage* storage = furi_record_open(RECORD_STORAGE);
     dict->stream = buffered_file_stream_alloc(storage);
-    furi_record_close(RECORD_STORAGE);
+    dict->index = storage_file_alloc(storage);
 
     bool dict_loaded = false;
+    const char* path = NULL;
     do {
         if(dict_type == MfClassicDictTypeSystem) {
+            path = MF_CLASSIC_DICT_FLIPPER_PATH;
+            dict->index_path = MF_CLASSIC_DICT_FLIPPER_INDEX_PATH;
             if(!buffered_file_stream_open(
-                   dict->stream,
-                   MF_CLASSIC_DICT_FLIPPER_PATH,
-                   FSAM_READ_WRITE,
-                   FSOM_OPEN_EXISTING)) {
-                buffered_file_stream_close(dict->stream);
+                   dict->stream, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING)) {
                 break;
             }
         } else if(dict_type == MfClassicDictTypeUser) {
-            if(!buffered_file_stream_open(
-                   dict->stream, MF_CLASSIC_DICT_USER_PATH, FSAM_READ_WRITE, FSOM_OPEN_ALWAYS)) {
-                buffered_file_stream_close(dict->stream);
+            path = MF_CLASSIC_DICT_USER_PATH;
+            dict->index_path = MF_CLASSIC_DICT_USER_INDEX_PATH;
+            if(!buffered_file_stream_open(dict->stream, path, FSAM_READ_WRITE, FSOM_OPEN_ALWAYS)) {
                 break;
             }
         } else if(dict_type == MfClassicDictTypeUnitTest) {
-            if(!buffered_file_stream_open(
-                   dict->stream,
-                   MF_CLASSIC_DICT_UNIT_TEST_PATH,
-                   FSAM_READ_WRITE,
-                   FSOM_OPEN_ALWAYS)) {
-                buffered_file_stream_close(dict->stream);
+            path = MF_CLASSIC_DICT_UNIT_TEST_PATH;
+            dict->index_path = MF_CLASSIC_DICT_UNIT_TEST_INDEX_PATH;
+            if(!buffered_file_stream_open(dict->stream, path, FSAM_READ_WRITE, FSOM_OPEN_ALWAYS)) {
                 break;
             }
+        } else {
+            break;
         }
 
         // Check for new line ending
@@ -76,29 +413,16 @@ MfClassicDict* mf_classic_dict_alloc(MfClassicDictType dict_type) {
             if(last_char != '\n') {
                 FURI_LOG_D(TAG, "Adding new line ending");
                 if(stream_write_char(dict->stream, '\n') != 1) break;
+                if(!buffered_file_stream_sync(dict->stream)) break;
             }
             if(!stream_rewind(dict->stream)) break;
         }
 
-        // Read total amount of keys
-        FuriString* next_line;
-        next_line = furi_string_alloc();
-        while(true) {
-            if(!stream_read_line(dict->stream, next_line)) {
-                FURI_LOG_T(TAG, "No keys left in dict");
-                break;
-            }
-            FURI_LOG_T(
-                TAG,
-                "Read line: %s, len: %zu",
-                furi_string_get_cstr(next_line),
-                furi_string_size(next_line));
-            if(furi_string_get_char(next_line, 0) == '#') continue;
-            if(furi_string_size(next_line) != NFC_MF_CLASSIC_KEY_LEN) continue;
-            dict->total_keys++;
+        // Compile text dictionary if needed
+        if(!mf_classic_dict_index_is_actual(dict, storage, path)) {
+            FURI_LOG_I(TAG, "Building %s", dict->index_path);
+            if(!mf_classic_dict_index_build(dict)) break;
         }
-        furi_string_free(next_line);
-        stream_rewind(dict->stream);
 
         dict_loaded = true;
         FURI_LOG_I(TAG, "Loaded dictionary with %lu keys", dict->total_keys);
@@ -106,10 +430,14 @@ MfClassicDict* mf_classic_dict_alloc(MfClassicDictType dict_type) {
 
     if(!dict_loaded) {
         buffered_file_stream_close(dict->stream);
+        stream_free(dict->stream);
+        storage_file_free(dict->index);
         free(dict);
         dict = NULL;
     }
 
+    furi_record_close(RECORD_STORAGE);
+
     return dict;
 }
 
@@ -119,27 +447,10 @@ void mf_classic_dict_free(MfClassicDict* dict) {
 
     buffered_file_stream_close(dict->stream);
     stream_free(dict->stream);
+    storage_file_free(dict->index);
     free(dict);
 }
 
-static void mf_classic_dict_int_to_str(uint8_t* key_int, FuriString* key_str) {
-    furi_string_reset(key_str);
-    for(size_t i = 0; i < 6; i++) {
-        furi_string_cat_printf(key_str, "%02X", key_int[i]);
-    }
-}
-
-static void mf_classic_dict_str_to_int(FuriString* key_str, uint64_t* key_int) {
-    uint8_t key_byte_tmp;
-
-    *key_int = 0ULL;
-    for(uint8_t i = 0; i < 12; i += 2) {
-        args_char_to_hex(
-            furi_string_get_char(key_str, i), furi_string_get_char(key_str, i + 1), &key_byte_tmp);
-        *key_int |= (uint64_t)key_byte_tmp << (8 * (5 - i / 2));
-    }
-}
-
 uint32_t mf_classic_dict_get_total_keys(MfClassicDict* dict) {
     furi_assert(dict);
 
@@ -150,88 +461,65 @@ bool mf_classic_dict_rewind(MfClassicDict* dict) {
     furi_assert(dict);
     furi_assert(dict->stream);
 
-    return stream_rewind(dict->stream);
+    dict->next_key = 0;
+    return true;
 }
 
 bool mf_classic_dict_get_next_key_str(MfClassicDict* dict, FuriString* key) {
     furi_assert(dict);
     furi_assert(dict->stream);
 
-    bool key_read = false;
-    furi_string_reset(key);
-    while(!key_read) {
-        if(!stream_read_line(dict->stream, key)) break;
-        if(furi_string_get_char(key, 0) == '#') continue;
-        if(furi_string_size(key) != NFC_MF_CLASSIC_KEY_LEN) continue;
-        furi_string_left(key, 12);
-        key_read = true;
+    const uint8_t* next_key =
+        mf_classic_dict_index_get_key(dict, MfClassicDictSectionOrdered, dict->next_key);
+    if(next_key) {
+        mf_classic_dict_int_to_str(next_key, key);
+        dict->next_key++;
+    } else {
+        furi_string_reset(key);
     }
 
-    return key_read;
+    return next_key != NULL;
 }
 
 bool mf_classic_dict_get_next_key(MfClassicDict* dict, uint64_t* key) {
     furi_assert(dict);
     furi_assert(dict->stream);
 
-    FuriString* temp_key;
-    temp_key = furi_string_alloc();
-    bool key_read = mf_classic_dict_get_next_key_str(dict, temp_key);
-    if(key_read) {
-        mf_classic_dict_str_to_int(temp_key, key);
+    const uint8_t* next_key =
+        mf_classic_dict_index_get_key(dict, MfClassicDictSectionOrdered, dict->next_key);
+    if(next_key) {
+        *key = nfc_util_bytes2num(next_key, MF_CLASSIC_DICT_KEY_SIZE);
+        dict->next_key++;
     }
-    furi_string_free(temp_key);
-    return key_read;
+
+    return next_key != NULL;
 }
 
 bool mf_classic_dict_is_key_present_str(MfClassicDict* dict, FuriString* key) {
     furi_assert(dict);
     furi_assert(dict->stream);
 
-    FuriString* next_line;
-    next_line = furi_string_alloc();
+    uint8_t key_int[MF_CLASSIC_DICT_KEY_SIZE];
+    if(!mf_classic_dict_parse_str(key, key_int)) return false;
 
-    bool key_found = false;
-    stream_rewind(dict->stream);
-    while(!key_found) { //-V654
-        if(!stream_read_line(dict->stream, next_line)) break;
-        if(furi_string_get_char(next_line, 0) == '#') continue;
-        if(furi_string_size(next_line) != NFC_MF_CLASSIC_KEY_LEN) continue;
-        furi_string_left(next_line, 12);
-        if(!furi_string_equal(key, next_line)) continue;
-        key_found = true;
-    }
-
-    furi_string_free(next_line);
-    return key_found;
+    return mf_classic_dict_index_contains(dict, key_int);
 }
 
 bool mf_classic_dict_is_key_present(MfClassicDict* dict, uint8_t* key) {
-    FuriString* temp_key;
+    furi_assert(dict);
+    furi_assert(dict->stream);
 
-    temp_key = furi_string_alloc();
-    mf_classic_dict_int_to_str(key, temp_key);
-    bool key_found = mf_classic_dict_is_key_present_str(dict, temp_key);
-    furi_string_free(temp_key);
-    return key_found;
+    return mf_classic_dict_index_contains(dict, key);
 }
 
 bool mf_classic_dict_add_key_str(MfClassicDict* dict, FuriString* key) {
     furi_assert(dict);
     furi_assert(dict->stream);
 
-    furi_string_cat_printf(key, "\n");
+    uint8_t key_int[MF_CLASSIC_DICT_KEY_SIZE];
+    if(!mf_classic_dict_parse_str(key, key_int)) return false;
 
-    bool key_added = false;
-    do {
-        if(!stream_seek(dict->stream, 0, StreamOffsetFromEnd)) break;
-        if(!stream_insert_string(dict->stream, key)) break;
-        dict->total_keys++;
-        key_added = true;
-    } while(false);
-
-    furi_string_left(key, 12);
-    return key_added;
+    return mf_classic_dict_add_key(dict, key_int);
 }
 
 bool mf_classic_dict_add_key(MfClassicDict* dict, uint8_t* key) {
@@ -241,7 +529,18 @@ bool mf_classic_dict_add_key(MfClassicDict* dict, uint8_t* key) {
     FuriString* temp_key;
     temp_key = furi_string_alloc();
     mf_classic_dict_int_to_str(key, temp_key);
-    bool key_added = mf_classic_dict_add_key_str(dict, temp_key);
+    furi_string_cat_printf(temp_key, "\n");
+
+    bool key_added = false;
+    do {
+        if(!stream_seek(dict->stream, 0, StreamOffsetFromEnd)) break;
+        if(!stream_insert_string(dict->stream, temp_key)) break;
+        if(!buffered_file_stream_sync(dict->stream)) break;
+
+        // Keep compiled dictionary in sync, rebuild it if update failed
+        if(!mf_classic_dict_index_insert(dict, key) && !mf_classic_dict_index_build(dict)) break;
+        key_added = true;
+    } while(false);
 
     furi_string_free(temp_key);
     return key_added;
@@ -251,73 +550,58 @@ bool mf_classic_dict_get_key_at_index_str(MfClassicDict* dict, FuriString* key,
     furi_assert(dict);
     furi_assert(dict->stream);
 
-    FuriString* next_line;
-    uint32_t index = 0;
-    next_line = furi_string_alloc();
-    furi_string_reset(key);
-
-    bool key_found = false;
-    while(!key_found) {
-        if(!stream_read_line(dict->stream, next_line)) break;
-        if(furi_string_get_char(next_line, 0) == '#') continue;
-        if(furi_string_size(next_line) != NFC_MF_CLASSIC_KEY_LEN) continue;
-        if(index++ != target) continue;
-        furi_string_set_n(key, next_line, 0, 12);
-        key_found = true;
+    const uint8_t* found_key =
+        mf_classic_dict_index_get_key(dict, MfClassicDictSectionOrdered, target);
+    if(found_key) {
+        mf_classic_dict_int_to_str(found_key, key);
+    } else {
+        furi_string_reset(key);
     }
 
-    furi_string_free(next_line);
-    return key_found;
+    return found_key != NULL;
 }
 
 bool mf_classic_dict_get_key_at_index(MfClassicDict* dict, uint64_t* key, uint32_t target) {
     furi_assert(dict);
     furi_assert(dict->stream);
 
-    FuriString* temp_key;
-    temp_key = furi_string_alloc();
-    bool key_found = mf_classic_dict_get_key_at_index_str(dict, temp_key, target);
-    if(key_found) {
-        mf_classic_dict_str_to_int(temp_key, key);
+    const uint8_t* found_key =
+        mf_classic_dict_index_get_key(dict, MfClassicDictSectionOrdered, target);
+    if(found_key) {
+        *key = nfc_util_bytes2num(found_key, MF_CLASSIC_DICT_KEY_SIZE);
     }
-    furi_string_free(temp_key);
-    return key_found;
+
+    return found_key != NULL;
 }
 
 bool mf_classic_dict_find_index_str(MfClassicDict* dict, FuriString* key, uint32_t* target) {
     furi_assert(dict);
     furi_assert(dict->stream);
 
-    FuriString* next_line;
-    next_line = furi_string_alloc();
+    uint8_t key_int[MF_CLASSIC_DICT_KEY_SIZE];
+    if(!mf_classic_dict_parse_str(key, key_int)) return false;
 
-    bool key_found = false;
-    uint32_t index = 0;
-    stream_rewind(dict->stream);
-    while(!key_found) { //-V654
-        if(!stream_read_line(dict->stream, next_line)) break;
-        if(furi_string_get_char(next_line, 0) == '#') continue;
-        if(furi_string_size(next_line) != NFC_MF_CLASSIC_KEY_LEN) continue;
-        furi_string_left(next_line, 12);
-        if(!furi_string_equal(key, next_line)) continue;
-        key_found = true;
-        *target = index;
-    }
-
-    furi_string_free(next_line);
-    return key_found;
+    return mf_classic_dict_find_index(dict, key_int, target);
 }
 
 bool mf_classic_dict_find_index(MfClassicDict* dict, uint8_t* key, uint32_t* target) {
     furi_assert(dict);
     furi_assert(dict->stream);
 
-    FuriString* temp_key;
-    temp_key = furi_string_alloc();
-    mf_classic_dict_int_to_str(key, temp_key);
-    bool key_found = mf_classic_dict_find_index_str(dict, temp_key, target);
+    // Sorted keys tell if there is anything to look for
+    if(!mf_classic_dict_index_contains(dict, key)) return false;
+
+    bool key_found = false;
+    for(uint32_t index = 0; index < dict->total_keys; index++) {
+        const uint8_t* next_key =
+            mf_classic_dict_index_get_key(dict, MfClassicDictSectionOrdered, index);
+        if(!next_key) break;
+        if(mf_classic_dict_key_cmp(next_key, key) != 0) continue;
+        key_found = true;
+        *target = index;
+        break;
+    }
 
-    furi_string_free(temp_key);
     return key_found;
 }
 
@@ -328,20 +612,25 @@ bool mf_classic_dict_delete_index(MfClassicDict* dict, uint32_t target) {
     FuriString* next_line;
     next_line = furi_string_alloc();
     uint32_t index = 0;
+    uint8_t key[MF_CLASSIC_DICT_KEY_SIZE];
 
     bool key_removed = false;
     stream_rewind(dict->stream);
     while(!key_removed) {
         if(!stream_read_line(dict->stream, next_line)) break;
-        if(furi_string_get_char(next_line, 0) == '#') continue;
-        if(furi_string_size(next_line) != NFC_MF_CLASSIC_KEY_LEN) continue;
+        if(!mf_classic_dict_parse_line(next_line, key)) continue;
         if(index++ != target) continue;
         stream_seek(dict->stream, -NFC_MF_CLASSIC_KEY_LEN, StreamOffsetFromCurrent);
         if(!stream_delete(dict->stream, NFC_MF_CLASSIC_KEY_LEN)) break;
-        dict->total_keys--;
+        if(!buffered_file_stream_sync(dict->stream)) break;
         key_removed = true;
     }
 
+    // Deleted key may be anywhere in the sorted keys, compile from scratch
+    if(key_removed) {
+        key_removed = mf_classic_dict_index_build(dict);
+    }
+
     stream_rewind(dict->stream);
 
     furi_string_free(next_line);
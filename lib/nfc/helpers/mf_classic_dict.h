@@ -21,6 +21,9 @@ typedef struct MfClassicDict MfClassicDict;
 bool mf_classic_dict_check_presence(MfClassicDictType dict_type);
 
 /** Allocate MfClassicDict instance
+ *
+ * Text dictionary is compiled to binary .mfd next to it on first use and
+ * whenever it was changed by someone else.
  *
  * @param[in]  dict_type  The dictionary type
  *
@@ -62,7 +65,7 @@ bool mf_classic_dict_get_next_key_str(MfClassicDict* dict, FuriString* key);
  *
  * @param      dict    MfClassicDict instance
  * @param[out] key     Pointer to the uint64_t key
- * @param[in]  target  Target offset from current position
+ * @param[in]  target  Target key index
  *
  * @return     true on success
  */
@@ -72,7 +75,7 @@ bool mf_classic_dict_get_key_at_index(MfClassicDict* dict, uint64_t* key, uint32
  *
  * @param      dict    MfClassicDict instance
  * @param[out] key     Found key destination buffer
- * @param[in]  target  Target offset from current position
+ * @param[in]  target  Target key index
  *
  * @return     true on success
  */
@@ -96,7 +99,7 @@ bool mf_classic_dict_find_index_str(MfClassicDict* dict, FuriString* key, uint32
 /** Delete key at target offset
  *
  * @param      dict    MfClassicDict instance
- * @param[in]  target  Target offset from current position
+ * @param[in]  target  Target key index
  *
  * @return     true on success
  */
@@ -0,0 +1,143 @@
+#include "mf_classic_key_scheduler.h"
+
+#include <furi.h>
+#include <lib/nfc/protocols/nfc_util.h>
+#include <lib/nfc/protocols/mifare_classic.h>
+
+#define MF_CLASSIC_KEY_SCHEDULER_FOUND_KEYS_MAX (MF_CLASSIC_SECTORS_MAX * 2)
+
+struct MfClassicKeyScheduler {
+    MfClassicDict* dict;
+
+    uint64_t found_keys[MF_CLASSIC_KEY_SCHEDULER_FOUND_KEYS_MAX];
+    size_t found_keys_count;
+
+    // Found keys known at sector start, only they are tried first
+    size_t sector_found_keys_count;
+    size_t sector_found_key_index;
+    uint32_t sector_keys_tried;
+    uint64_t last_key;
+    bool last_key_is_found;
+    bool sector_opened;
+    uint32_t sector_baseline;
+
+    MfClassicKeySchedulerStats stats;
+};
+
+MfClassicKeyScheduler* mf_classic_key_scheduler_alloc(MfClassicDict* dict) {
+    furi_assert(dict);
+
+    MfClassicKeyScheduler* scheduler = malloc(sizeof(MfClassicKeyScheduler));
+    scheduler->dict = dict;
+    mf_classic_key_scheduler_start_sector(scheduler);
+
+    return scheduler;
+}
+
+void mf_classic_key_scheduler_free(MfClassicKeyScheduler* scheduler) {
+    furi_assert(scheduler);
+
+    free(scheduler);
+}
+
+static bool mf_classic_key_scheduler_is_found(
+    MfClassicKeyScheduler* scheduler,
+    uint64_t key,
+    size_t found_keys_count) {
+    for(size_t i = 0; i < found_keys_count; i++) {
+        if(scheduler->found_keys[i] == key) return true;
+    }
+    return false;
+}
+
+static void mf_classic_key_scheduler_end_sector(MfClassicKeyScheduler* scheduler) {
+    if(scheduler->sector_opened) {
+        scheduler->stats.sectors_opened++;
+        if(scheduler->sector_baseline > scheduler->sector_keys_tried) {
+            scheduler->stats.keys_saved +=
+                scheduler->sector_baseline - scheduler->sector_keys_tried;
+        }
+    }
+    scheduler->sector_opened = false;
+    scheduler->sector_baseline = 0;
+}
+
+void mf_classic_key_scheduler_start_sector(MfClassicKeyScheduler* scheduler) {
+    furi_assert(scheduler);
+
+    mf_classic_key_scheduler_end_sector(scheduler);
+    scheduler->sector_found_keys_count = scheduler->found_keys_count;
+    scheduler->sector_found_key_index = 0;
+    scheduler->sector_keys_tried = 0;
+    scheduler->last_key_is_found = false;
+    mf_classic_dict_rewind(scheduler->dict);
+}
+
+bool mf_classic_key_scheduler_get_next_key(MfClassicKeyScheduler* scheduler, uint64_t* key) {
+    furi_assert(scheduler);
+    furi_assert(key);
+
+    bool key_found = false;
+    if(scheduler->sector_found_key_index < scheduler->sector_found_keys_count) {
+        *key = scheduler->found_keys[scheduler->sector_found_key_index++];
+        scheduler->last_key_is_found = true;
+        scheduler->stats.found_keys_tried++;
+        key_found = true;
+    } else {
+        scheduler->last_key_is_found = false;
+        while(mf_classic_dict_get_next_key(scheduler->dict, key)) {
+            // Skip keys that were tried already
+            if(!mf_classic_key_scheduler_is_found(
+                   scheduler, *key, scheduler->sector_found_keys_count)) {
+                key_found = true;
+                break;
+            }
+        }
+    }
+
+    if(key_found) {
+        scheduler->last_key = *key;
+        scheduler->sector_keys_tried++;
+        scheduler->stats.keys_tried++;
+    }
+
+    return key_found;
+}
+
+void mf_classic_key_scheduler_add_found_key(MfClassicKeyScheduler* scheduler, uint64_t key) {
+    furi_assert(scheduler);
+
+    if(scheduler->sector_keys_tried > 0 && scheduler->last_key == key) {
+        // Dictionary alone would need all keys up to this one
+        uint32_t baseline = mf_classic_dict_get_total_keys(scheduler->dict);
+        uint8_t key_bytes[6];
+        nfc_util_num2bytes(key, sizeof(key_bytes), key_bytes);
+        uint32_t index = 0;
+        if(mf_classic_dict_find_index(scheduler->dict, key_bytes, &index)) {
+            baseline = index + 1;
+        }
+        scheduler->sector_baseline = MAX(scheduler->sector_baseline, baseline);
+        if(scheduler->last_key_is_found) scheduler->sector_opened = true;
+    }
+
+    if(mf_classic_key_scheduler_is_found(scheduler, key, scheduler->found_keys_count)) return;
+    if(scheduler->found_keys_count < MF_CLASSIC_KEY_SCHEDULER_FOUND_KEYS_MAX) {
+        scheduler->found_keys[scheduler->found_keys_count++] = key;
+    }
+}
+
+uint32_t mf_classic_key_scheduler_get_sector_keys_tried(MfClassicKeyScheduler* scheduler) {
+    furi_assert(scheduler);
+
+    return scheduler->sector_keys_tried;
+}
+
+void mf_classic_key_scheduler_get_stats(
+    MfClassicKeyScheduler* scheduler,
+    MfClassicKeySchedulerStats* stats) {
+    furi_assert(scheduler);
+    furi_assert(stats);
+
+    mf_classic_key_scheduler_end_sector(scheduler);
+    *stats = scheduler->stats;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "mf_classic_dict.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Key order for dictionary attack
+ *
+ * Cards usually reuse keys across sectors, so keys already found on the card
+ * are tried first on every next sector, then the dictionary follows without
+ * the keys that were tried already. Scheduler only decides the order, caller
+ * tries each key as both A and B key in a single pass.
+ */
+typedef struct MfClassicKeyScheduler MfClassicKeyScheduler;
+
+typedef struct {
+    uint32_t keys_tried; /**< Keys tried on all sectors */
+    uint32_t found_keys_tried; /**< Keys tried from found keys */
+    uint32_t sectors_opened; /**< Sectors opened by found keys */
+    uint32_t keys_saved; /**< Dictionary keys not tried thanks to found keys */
+} MfClassicKeySchedulerStats;
+
+/** Allocate MfClassicKeyScheduler instance
+ *
+ * @param      dict  MfClassicDict instance, must outlive scheduler
+ *
+ * @return     MfClassicKeyScheduler instance
+ */
+MfClassicKeyScheduler* mf_classic_key_scheduler_alloc(MfClassicDict* dict);
+
+/** Free MfClassicKeyScheduler instance
+ *
+ * @param      scheduler  MfClassicKeyScheduler instance
+ */
+void mf_classic_key_scheduler_free(MfClassicKeyScheduler* scheduler);
+
+/** Start keys for the next sector, rewinds dictionary
+ *
+ * @param      scheduler  MfClassicKeyScheduler instance
+ */
+void mf_classic_key_scheduler_start_sector(MfClassicKeyScheduler* scheduler);
+
+/** Get next key to try on current sector
+ *
+ * @param      scheduler  MfClassicKeyScheduler instance
+ * @param      key        pointer to store key
+ *
+ * @return     false when there are no keys left
+ */
+bool mf_classic_key_scheduler_get_next_key(MfClassicKeyScheduler* scheduler, uint64_t* key);
+
+/** Add key found on the card
+ *
+ * Key is tried first on the next sectors. Keys found not by the scheduler,
+ * i.e. read from sector trailer, must be added too.
+ *
+ * @param      scheduler  MfClassicKeyScheduler instance
+ * @param      key        found key
+ */
+void mf_classic_key_scheduler_add_found_key(MfClassicKeyScheduler* scheduler, uint64_t key);
+
+/** Get keys tried on current sector
+ *
+ * @param      scheduler  MfClassicKeyScheduler instance
+ *
+ * @return     keys count
+ */
+uint32_t mf_classic_key_scheduler_get_sector_keys_tried(MfClassicKeyScheduler* scheduler);
+
+/** Get attack statistics
+ *
+ * @param      scheduler  MfClassicKeyScheduler instance
+ * @param      stats      pointer to store statistics
+ */
+void mf_classic_key_scheduler_get_stats(
+    MfClassicKeyScheduler* scheduler,
+    MfClassicKeySchedulerStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -50,6 +50,7 @@ void nfc_debug_log_free(NfcDebugLog* instance) {
 
 void nfc_debug_log_process_data(
     NfcDebugLog* instance,
+    uint32_t timestamp,
     uint8_t* data,
     uint16_t len,
     bool reader_to_tag,
@@ -60,7 +61,7 @@ void nfc_debug_log_process_data(
     furi_assert(data);
     UNUSED(crc_dropped);
 
-    furi_string_printf(instance->data_str, "%lu %c:", furi_get_tick(), reader_to_tag ? 'R' : 'T');
+    furi_string_printf(instance->data_str, "%lu %c:", timestamp, reader_to_tag ? 'R' : 'T');
     uint16_t data_len = len;
     for(size_t i = 0; i < data_len; i++) {
         furi_string_cat_printf(instance->data_str, " %02x", data[i]);
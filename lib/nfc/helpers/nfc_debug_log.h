@@ -11,6 +11,7 @@ void nfc_debug_log_free(NfcDebugLog* instance);
 
 void nfc_debug_log_process_data(
     NfcDebugLog* instance,
+    uint32_t timestamp,
     uint8_t* data,
     uint16_t len,
     bool reader_to_tag,
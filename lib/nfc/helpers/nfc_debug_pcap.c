@@ -1,6 +1,6 @@
 #include "nfc_debug_pcap.h"
 
-#include <storage/storage.h>
+#include <stream/file_stream.h>
 #include <stream/buffered_file_stream.h>
 #include <furi_hal_nfc.h>
 #include <furi_hal_rtc.h>
@@ -18,50 +18,75 @@
 #define DATA_PCD_TO_PICC_CRC_DROPPED 0xFA
 
 #define NFC_DEBUG_PCAP_FILENAME EXT_PATH("nfc/debug.pcap")
+#define NFC_DEBUG_TRACE_FILENAME EXT_PATH("nfc/debug.trace")
+
+#define NFC_DEBUG_TRACE_MAGIC 0x5254464e
+#define NFC_DEBUG_TRACE_VERSION 1
+#define NFC_DEBUG_TRACE_BLOCK_SIZE (1024)
+
+#define NFC_DEBUG_TRACE_FLAG_READER_TO_TAG (1 << 0)
+#define NFC_DEBUG_TRACE_FLAG_CRC_DROPPED (1 << 1)
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t start_timestamp;
+    uint32_t start_tick;
+    uint32_t tick_frequency;
+    uint32_t frames_dropped;
+} __attribute__((__packed__)) NfcDebugTraceHeader;
+
+typedef struct {
+    uint32_t tick;
+    uint8_t flags;
+    uint16_t len;
+} __attribute__((__packed__)) NfcDebugTraceRecord;
 
 struct NfcDebugPcap {
     Stream* file_stream;
+    NfcDebugTraceHeader header;
+    size_t block_size;
+    uint8_t block[NFC_DEBUG_TRACE_BLOCK_SIZE];
 };
 
-static Stream* nfc_debug_pcap_open(Storage* storage) {
-    Stream* stream = NULL;
-    stream = buffered_file_stream_alloc(storage);
-    if(!buffered_file_stream_open(stream, NFC_DEBUG_PCAP_FILENAME, FSAM_WRITE, FSOM_OPEN_APPEND)) {
-        buffered_file_stream_close(stream);
-        stream_free(stream);
-        stream = NULL;
-    } else {
-        if(!stream_tell(stream)) {
-            struct {
-                uint32_t magic;
-                uint16_t major, minor;
-                uint32_t reserved[2];
-                uint32_t snaplen;
-                uint32_t link_type;
-            } __attribute__((__packed__)) pcap_hdr = {
-                .magic = PCAP_MAGIC,
-                .major = PCAP_MAJOR,
-                .minor = PCAP_MINOR,
-                .snaplen = FURI_HAL_NFC_DATA_BUFF_SIZE,
-                .link_type = DLT_ISO_14443,
-            };
-            if(stream_write(stream, (uint8_t*)&pcap_hdr, sizeof(pcap_hdr)) != sizeof(pcap_hdr)) {
-                FURI_LOG_E(TAG, "Failed to write pcap header");
-                buffered_file_stream_close(stream);
-                stream_free(stream);
-                stream = NULL;
-            }
-        }
+static bool nfc_debug_pcap_write_header(NfcDebugPcap* instance) {
+    return stream_rewind(instance->file_stream) &&
+           (stream_write(
+                instance->file_stream,
+                (uint8_t*)&instance->header,
+                sizeof(NfcDebugTraceHeader)) == sizeof(NfcDebugTraceHeader));
+}
+
+static void nfc_debug_pcap_flush(NfcDebugPcap* instance) {
+    if(!instance->block_size) return;
+
+    if(stream_write(instance->file_stream, instance->block, instance->block_size) !=
+       instance->block_size) {
+        FURI_LOG_E(TAG, "Failed to write trace block");
     }
-    return stream;
+    instance->block_size = 0;
 }
 
 NfcDebugPcap* nfc_debug_pcap_alloc() {
     NfcDebugPcap* instance = malloc(sizeof(NfcDebugPcap));
 
+    FuriHalRtcDateTime datetime;
+    furi_hal_rtc_get_datetime(&datetime);
+    instance->header.magic = NFC_DEBUG_TRACE_MAGIC;
+    instance->header.version = NFC_DEBUG_TRACE_VERSION;
+    instance->header.start_timestamp = furi_hal_rtc_datetime_to_timestamp(&datetime);
+    instance->header.start_tick = furi_get_tick();
+    instance->header.tick_frequency = furi_kernel_get_tick_frequency();
+
     Storage* storage = furi_record_open(RECORD_STORAGE);
-    instance->file_stream = nfc_debug_pcap_open(storage);
-    if(!instance->file_stream) {
+    instance->file_stream = file_stream_alloc(storage);
+    if(!file_stream_open(
+           instance->file_stream, NFC_DEBUG_TRACE_FILENAME, FSAM_WRITE, FSOM_CREATE_ALWAYS) ||
+       !nfc_debug_pcap_write_header(instance)) {
+        FURI_LOG_E(TAG, "Failed to open trace");
+        file_stream_close(instance->file_stream);
+        stream_free(instance->file_stream);
         free(instance);
         instance = NULL;
     }
@@ -74,7 +99,11 @@ void nfc_debug_pcap_free(NfcDebugPcap* instance) {
     furi_assert(instance);
     furi_assert(instance->file_stream);
 
-    buffered_file_stream_close(instance->file_stream);
+    nfc_debug_pcap_flush(instance);
+    if(!nfc_debug_pcap_write_header(instance)) {
+        FURI_LOG_E(TAG, "Failed to update trace header");
+    }
+    file_stream_close(instance->file_stream);
     stream_free(instance->file_stream);
 
     free(instance);
@@ -82,15 +111,66 @@ void nfc_debug_pcap_free(NfcDebugPcap* instance) {
 
 void nfc_debug_pcap_process_data(
     NfcDebugPcap* instance,
+    uint32_t timestamp,
     uint8_t* data,
     uint16_t len,
     bool reader_to_tag,
     bool crc_dropped) {
     furi_assert(instance);
     furi_assert(data);
-    FuriHalRtcDateTime datetime;
-    furi_hal_rtc_get_datetime(&datetime);
 
+    NfcDebugTraceRecord record = {
+        .tick = timestamp,
+        .flags = (reader_to_tag ? NFC_DEBUG_TRACE_FLAG_READER_TO_TAG : 0) |
+                 (crc_dropped ? NFC_DEBUG_TRACE_FLAG_CRC_DROPPED : 0),
+        .len = len,
+    };
+
+    if(instance->block_size + sizeof(NfcDebugTraceRecord) + len > NFC_DEBUG_TRACE_BLOCK_SIZE) {
+        nfc_debug_pcap_flush(instance);
+    }
+    if(sizeof(NfcDebugTraceRecord) + len > NFC_DEBUG_TRACE_BLOCK_SIZE) {
+        // Frame doesn't fit into block, write it as is
+        stream_write(instance->file_stream, (uint8_t*)&record, sizeof(NfcDebugTraceRecord));
+        stream_write(instance->file_stream, data, len);
+    } else {
+        memcpy(&instance->block[instance->block_size], &record, sizeof(NfcDebugTraceRecord));
+        instance->block_size += sizeof(NfcDebugTraceRecord);
+        memcpy(&instance->block[instance->block_size], data, len);
+        instance->block_size += len;
+    }
+}
+
+void nfc_debug_pcap_set_frames_dropped(NfcDebugPcap* instance, uint32_t frames_dropped) {
+    furi_assert(instance);
+
+    instance->header.frames_dropped = frames_dropped;
+}
+
+static bool nfc_debug_pcap_write_pcap_header(Stream* stream) {
+    struct {
+        uint32_t magic;
+        uint16_t major, minor;
+        uint32_t reserved[2];
+        uint32_t snaplen;
+        uint32_t link_type;
+    } __attribute__((__packed__)) pcap_hdr = {
+        .magic = PCAP_MAGIC,
+        .major = PCAP_MAJOR,
+        .minor = PCAP_MINOR,
+        .snaplen = FURI_HAL_NFC_DATA_BUFF_SIZE,
+        .link_type = DLT_ISO_14443,
+    };
+    return stream_write(stream, (uint8_t*)&pcap_hdr, sizeof(pcap_hdr)) == sizeof(pcap_hdr);
+}
+
+static bool nfc_debug_pcap_write_packet(
+    Stream* stream,
+    const NfcDebugTraceHeader* header,
+    const NfcDebugTraceRecord* record,
+    uint8_t* data) {
+    bool reader_to_tag = record->flags & NFC_DEBUG_TRACE_FLAG_READER_TO_TAG;
+    bool crc_dropped = record->flags & NFC_DEBUG_TRACE_FLAG_CRC_DROPPED;
     uint8_t event = 0;
     if(reader_to_tag) {
         if(crc_dropped) {
@@ -106,6 +186,9 @@ void nfc_debug_pcap_process_data(
         }
     }
 
+    uint64_t time_ms = (uint64_t)(record->tick - header->start_tick) * 1000 /
+                       MAX(header->tick_frequency, 1UL);
+    uint16_t len = record->len;
     struct {
         // https://wiki.wireshark.org/Development/LibpcapFileFormat#record-packet-header
         uint32_t ts_sec;
@@ -117,14 +200,74 @@ void nfc_debug_pcap_process_data(
         uint8_t event;
         uint16_t len;
     } __attribute__((__packed__)) pkt_hdr = {
-        .ts_sec = furi_hal_rtc_datetime_to_timestamp(&datetime),
-        .ts_usec = 0,
+        .ts_sec = header->start_timestamp + time_ms / 1000,
+        .ts_usec = (time_ms % 1000) * 1000,
         .incl_len = len + 4,
         .orig_len = len + 4,
         .version = 0,
         .event = event,
         .len = len << 8 | len >> 8,
     };
-    stream_write(instance->file_stream, (uint8_t*)&pkt_hdr, sizeof(pkt_hdr));
-    stream_write(instance->file_stream, data, len);
+    return (stream_write(stream, (uint8_t*)&pkt_hdr, sizeof(pkt_hdr)) == sizeof(pkt_hdr)) &&
+           (stream_write(stream, data, len) == len);
+}
+
+bool nfc_debug_pcap_export(Storage* storage, uint32_t* frames, uint32_t* frames_dropped) {
+    furi_assert(storage);
+    furi_assert(frames);
+    furi_assert(frames_dropped);
+
+    Stream* trace = buffered_file_stream_alloc(storage);
+    Stream* pcap = buffered_file_stream_alloc(storage);
+    uint8_t* data = malloc(FURI_HAL_NFC_DATA_BUFF_SIZE);
+    *frames = 0;
+    *frames_dropped = 0;
+    bool success = false;
+
+    do {
+        if(!buffered_file_stream_open(
+               trace, NFC_DEBUG_TRACE_FILENAME, FSAM_READ, FSOM_OPEN_EXISTING)) {
+            FURI_LOG_E(TAG, "Failed to open trace");
+            break;
+        }
+        NfcDebugTraceHeader header = {};
+        if(stream_read(trace, (uint8_t*)&header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != NFC_DEBUG_TRACE_MAGIC || header.version != NFC_DEBUG_TRACE_VERSION) {
+            FURI_LOG_E(TAG, "Unsupported trace");
+            break;
+        }
+        *frames_dropped = header.frames_dropped;
+
+        if(!buffered_file_stream_open(
+               pcap, NFC_DEBUG_PCAP_FILENAME, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+            FURI_LOG_E(TAG, "Failed to open pcap");
+            break;
+        }
+        if(!nfc_debug_pcap_write_pcap_header(pcap)) break;
+
+        success = true;
+        NfcDebugTraceRecord record = {};
+        while(stream_read(trace, (uint8_t*)&record, sizeof(record)) == sizeof(record)) {
+            if(record.len > FURI_HAL_NFC_DATA_BUFF_SIZE) {
+                // Frame can't be captured by snaplen, skip it
+                stream_seek(trace, record.len, StreamOffsetFromCurrent);
+                continue;
+            }
+            if(stream_read(trace, data, record.len) != record.len) break;
+            if(!nfc_debug_pcap_write_packet(pcap, &header, &record, data)) {
+                FURI_LOG_E(TAG, "Failed to write pcap");
+                success = false;
+                break;
+            }
+            (*frames)++;
+        }
+    } while(false);
+
+    free(data);
+    buffered_file_stream_close(pcap);
+    buffered_file_stream_close(trace);
+    stream_free(pcap);
+    stream_free(trace);
+
+    return success;
 }
@@ -2,7 +2,14 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <storage/storage.h>
 
+/** Debug pcap capture
+ *
+ * Frames are stored in compact binary trace and written to SD card in large
+ * blocks, so long captures are not slowed down by formatting. Trace is
+ * converted to pcap file with nfc_debug_pcap_export() after capture.
+ */
 typedef struct NfcDebugPcap NfcDebugPcap;
 
 NfcDebugPcap* nfc_debug_pcap_alloc();
@@ -11,7 +18,25 @@ void nfc_debug_pcap_free(NfcDebugPcap* instance);
 
 void nfc_debug_pcap_process_data(
     NfcDebugPcap* instance,
+    uint32_t timestamp,
     uint8_t* data,
     uint16_t len,
     bool reader_to_tag,
     bool crc_dropped);
+
+/** Set frames dropped during capture, stored in trace on free
+ *
+ * @param      instance        NfcDebugPcap instance
+ * @param      frames_dropped  dropped frames count
+ */
+void nfc_debug_pcap_set_frames_dropped(NfcDebugPcap* instance, uint32_t frames_dropped);
+
+/** Convert captured trace to pcap file
+ *
+ * @param      storage         Storage instance
+ * @param      frames          pointer to store exported frames count
+ * @param      frames_dropped  pointer to store frames dropped during capture
+ *
+ * @return     true on success
+ */
+bool nfc_debug_pcap_export(Storage* storage, uint32_t* frames, uint32_t* frames_dropped);
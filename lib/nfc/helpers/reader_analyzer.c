@@ -11,16 +11,21 @@
 #define TAG "ReaderAnalyzer"
 
 #define READER_ANALYZER_MAX_BUFF_SIZE (1024)
+#define READER_ANALYZER_STREAM_SIZE (2048)
 
 #define READER_ANALYZER_UID_SIZE 7
 #define READER_ANALYZER_CUID_SIZE 4
 
 typedef struct {
+    uint32_t timestamp;
+    uint16_t len;
     bool reader_to_tag;
     bool crc_dropped;
-    uint16_t len;
 } ReaderAnalyzerHeader;
 
+#define READER_ANALYZER_MAX_FRAME_SIZE \
+    (READER_ANALYZER_MAX_BUFF_SIZE - sizeof(ReaderAnalyzerHeader))
+
 typedef enum {
     ReaderAnalyzerNfcDataMfClassic,
 } ReaderAnalyzerNfcData;
@@ -44,6 +49,7 @@ struct ReaderAnalyzer {
     bool alive;
     FuriStreamBuffer* stream;
     FuriThread* thread;
+    uint32_t frames_dropped;
 
     ReaderAnalyzerParseDataCallback callback;
     void* context;
@@ -65,48 +71,62 @@ static FuriHalNfcDevData reader_analyzer_nfc_data[] = {
          .cuid = 0x2A234F80},
 };
 
-void reader_analyzer_parse(ReaderAnalyzer* instance, uint8_t* buffer, size_t size) {
-    if(size < sizeof(ReaderAnalyzerHeader)) return;
-
+// Returns size of complete records parsed, the rest is kept for the next receive
+static size_t reader_analyzer_parse(ReaderAnalyzer* instance, uint8_t* buffer, size_t size) {
     size_t bytes_i = 0;
-    while(bytes_i < size) {
-        ReaderAnalyzerHeader* header = (ReaderAnalyzerHeader*)&buffer[bytes_i];
-        uint16_t len = header->len;
-        if(bytes_i + len > size) break;
+    while(bytes_i + sizeof(ReaderAnalyzerHeader) <= size) {
+        ReaderAnalyzerHeader header;
+        memcpy(&header, &buffer[bytes_i], sizeof(ReaderAnalyzerHeader));
+        if(bytes_i + sizeof(ReaderAnalyzerHeader) + header.len > size) break;
         bytes_i += sizeof(ReaderAnalyzerHeader);
         if(instance->mfkey32) {
             mfkey32_process_data(
                 instance->mfkey32,
                 &buffer[bytes_i],
-                len,
-                header->reader_to_tag,
-                header->crc_dropped);
+                header.len,
+                header.reader_to_tag,
+                header.crc_dropped);
         }
         if(instance->pcap) {
             nfc_debug_pcap_process_data(
-                instance->pcap, &buffer[bytes_i], len, header->reader_to_tag, header->crc_dropped);
+                instance->pcap,
+                header.timestamp,
+                &buffer[bytes_i],
+                header.len,
+                header.reader_to_tag,
+                header.crc_dropped);
         }
         if(instance->debug_log) {
             nfc_debug_log_process_data(
                 instance->debug_log,
+                header.timestamp,
                 &buffer[bytes_i],
-                len,
-                header->reader_to_tag,
-                header->crc_dropped);
+                header.len,
+                header.reader_to_tag,
+                header.crc_dropped);
         }
-        bytes_i += len;
+        bytes_i += header.len;
     }
+
+    return bytes_i;
 }
 
 int32_t reader_analyzer_thread(void* context) {
     ReaderAnalyzer* reader_analyzer = context;
     uint8_t buffer[READER_ANALYZER_MAX_BUFF_SIZE] = {};
+    size_t buffer_size = 0;
 
     while(reader_analyzer->alive || !furi_stream_buffer_is_empty(reader_analyzer->stream)) {
         size_t ret = furi_stream_buffer_receive(
-            reader_analyzer->stream, buffer, READER_ANALYZER_MAX_BUFF_SIZE, 50);
+            reader_analyzer->stream,
+            &buffer[buffer_size],
+            READER_ANALYZER_MAX_BUFF_SIZE - buffer_size,
+            50);
         if(ret) {
-            reader_analyzer_parse(reader_analyzer, buffer, ret);
+            buffer_size += ret;
+            size_t parsed = reader_analyzer_parse(reader_analyzer, buffer, buffer_size);
+            buffer_size -= parsed;
+            memmove(buffer, &buffer[parsed], buffer_size);
         }
     }
 
@@ -130,7 +150,7 @@ ReaderAnalyzer* reader_analyzer_alloc() {
     instance->nfc_data = reader_analyzer_nfc_data[ReaderAnalyzerNfcDataMfClassic];
     instance->alive = false;
     instance->stream =
-        furi_stream_buffer_alloc(READER_ANALYZER_MAX_BUFF_SIZE, sizeof(ReaderAnalyzerHeader));
+        furi_stream_buffer_alloc(READER_ANALYZER_STREAM_SIZE, sizeof(ReaderAnalyzerHeader));
 
     instance->thread =
         furi_thread_alloc_ex("ReaderAnalyzerWorker", 2048, reader_analyzer_thread, instance);
@@ -154,6 +174,7 @@ void reader_analyzer_start(ReaderAnalyzer* instance, ReaderAnalyzerMode mode) {
     furi_assert(instance);
 
     furi_stream_buffer_reset(instance->stream);
+    instance->frames_dropped = 0;
     if(mode & ReaderAnalyzerModeDebugLog) {
         instance->debug_log = nfc_debug_log_alloc();
     }
@@ -177,6 +198,9 @@ void reader_analyzer_stop(ReaderAnalyzer* instance) {
     instance->alive = false;
     furi_thread_join(instance->thread);
 
+    if(instance->frames_dropped) {
+        FURI_LOG_W(TAG, "Frames dropped: %lu", instance->frames_dropped);
+    }
     if(instance->debug_log) {
         nfc_debug_log_free(instance->debug_log);
         instance->debug_log = NULL;
@@ -186,6 +210,7 @@ void reader_analyzer_stop(ReaderAnalyzer* instance) {
         instance->mfkey32 = NULL;
     }
     if(instance->pcap) {
+        nfc_debug_pcap_set_frames_dropped(instance->pcap, instance->frames_dropped);
         nfc_debug_pcap_free(instance->pcap);
         instance->pcap = NULL;
     }
@@ -238,6 +263,12 @@ void reader_analyzer_set_nfc_data(ReaderAnalyzer* instance, FuriHalNfcDevData* n
     memcpy(&instance->nfc_data, nfc_data, sizeof(FuriHalNfcDevData));
 }
 
+uint32_t reader_analyzer_get_frames_dropped(ReaderAnalyzer* instance) {
+    furi_assert(instance);
+
+    return instance->frames_dropped;
+}
+
 static void reader_analyzer_write(
     ReaderAnalyzer* instance,
     uint8_t* data,
@@ -245,17 +276,22 @@ static void reader_analyzer_write(
     bool reader_to_tag,
     bool crc_dropped) {
     ReaderAnalyzerHeader header = {
-        .reader_to_tag = reader_to_tag, .crc_dropped = crc_dropped, .len = len};
-    size_t data_sent = 0;
-    data_sent = furi_stream_buffer_send(
-        instance->stream, &header, sizeof(ReaderAnalyzerHeader), FuriWaitForever);
-    if(data_sent != sizeof(ReaderAnalyzerHeader)) {
-        FURI_LOG_W(TAG, "Sent %zu out of %zu bytes", data_sent, sizeof(ReaderAnalyzerHeader));
-    }
-    data_sent = furi_stream_buffer_send(instance->stream, data, len, FuriWaitForever);
-    if(data_sent != len) {
-        FURI_LOG_W(TAG, "Sent %zu out of %u bytes", data_sent, len);
+        .timestamp = furi_get_tick(),
+        .len = len,
+        .reader_to_tag = reader_to_tag,
+        .crc_dropped = crc_dropped,
+    };
+
+    // Capture must never wait for storage: drop the whole frame if worker falls behind.
+    // Only worker frees space, so checked space stays available for both sends.
+    if((len > READER_ANALYZER_MAX_FRAME_SIZE) ||
+       (furi_stream_buffer_spaces_available(instance->stream) <
+        sizeof(ReaderAnalyzerHeader) + len)) {
+        instance->frames_dropped++;
+        return;
     }
+    furi_stream_buffer_send(instance->stream, &header, sizeof(ReaderAnalyzerHeader), 0);
+    furi_stream_buffer_send(instance->stream, data, len, 0);
 }
 
 static void
@@ -37,6 +37,8 @@ FuriHalNfcDevData* reader_analyzer_get_nfc_data(ReaderAnalyzer* instance);
 
 void reader_analyzer_set_nfc_data(ReaderAnalyzer* instance, FuriHalNfcDevData* nfc_data);
 
+uint32_t reader_analyzer_get_frames_dropped(ReaderAnalyzer* instance);
+
 void reader_analyzer_prepare_tx_rx(
     ReaderAnalyzer* instance,
     FuriHalNfcTxRxContext* tx_rx,
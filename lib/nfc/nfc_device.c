@@ -1310,6 +1310,7 @@ bool nfc_device_load_key_cache(NfcDevice* dev) {
     MfClassicData* data = &dev->dev_data.mf_classic_data;
     nfc_device_get_key_cache_file_path(dev, temp_str);
     FlipperFormat* file = flipper_format_file_alloc(dev->storage);
+    flipper_format_set_indexed_mode(file, true);
 
     bool load_success = false;
     do {
@@ -1475,6 +1476,8 @@ bool nfc_device_save_shadow(NfcDevice* dev, const char* path) {
 static bool nfc_device_load_data(NfcDevice* dev, FuriString* path, bool show_dialog) {
     bool parsed = false;
     FlipperFormat* file = flipper_format_file_alloc(dev->storage);
+    // Dumps have hundreds of keys, some of them optional
+    flipper_format_set_indexed_mode(file, true);
     FuriHalNfcDevData* data = &dev->dev_data.nfc_data;
     uint32_t data_cnt = 0;
     FuriString* temp_str;
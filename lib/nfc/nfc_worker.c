@@ -45,6 +45,12 @@ NfcWorkerState nfc_worker_get_state(NfcWorker* nfc_worker) {
     return nfc_worker->state;
 }
 
+uint32_t nfc_worker_get_frames_dropped(NfcWorker* nfc_worker) {
+    furi_assert(nfc_worker);
+
+    return reader_analyzer_get_frames_dropped(nfc_worker->reader_analyzer);
+}
+
 void nfc_worker_start(
     NfcWorker* nfc_worker,
     NfcWorkerState state,
@@ -931,6 +937,21 @@ static void nfc_worker_mf_classic_key_attack(
     nfc_worker->callback(NfcWorkerEventKeyAttackStop, nfc_worker->context);
 }
 
+static void nfc_worker_mf_classic_add_found_keys(
+    MfClassicKeyScheduler* scheduler,
+    MfClassicData* data,
+    uint8_t sector) {
+    MfClassicSectorTrailer* sec_trailer = mf_classic_get_sector_trailer_by_sector(data, sector);
+    if(mf_classic_is_key_found(data, sector, MfClassicKeyA)) {
+        mf_classic_key_scheduler_add_found_key(
+            scheduler, nfc_util_bytes2num(sec_trailer->key_a, sizeof(sec_trailer->key_a)));
+    }
+    if(mf_classic_is_key_found(data, sector, MfClassicKeyB)) {
+        mf_classic_key_scheduler_add_found_key(
+            scheduler, nfc_util_bytes2num(sec_trailer->key_b, sizeof(sec_trailer->key_b)));
+    }
+}
+
 void nfc_worker_mf_classic_dict_attack(NfcWorker* nfc_worker) {
     furi_assert(nfc_worker);
     furi_assert(nfc_worker->callback);
@@ -955,6 +976,12 @@ void nfc_worker_mf_classic_dict_attack(NfcWorker* nfc_worker) {
 
     FURI_LOG_D(
         TAG, "Start Dictionary attack, Key Count %lu", mf_classic_dict_get_total_keys(dict));
+    MfClassicKeyScheduler* scheduler = mf_classic_key_scheduler_alloc(dict);
+    // Seed with keys already known from key cache or previous dictionary pass,
+    // including sectors that are skipped below
+    for(size_t i = 0; i < total_sectors; i++) {
+        nfc_worker_mf_classic_add_found_keys(scheduler, data, i);
+    }
     for(size_t i = 0; i < total_sectors; i++) {
         FURI_LOG_I(TAG, "Sector %d", i);
         nfc_worker->callback(NfcWorkerEventNewSector, nfc_worker->context);
@@ -964,7 +991,8 @@ void nfc_worker_mf_classic_dict_attack(NfcWorker* nfc_worker) {
            mf_classic_is_key_found(data, i, MfClassicKeyB))
             continue;
         uint16_t key_index = 0;
-        while(mf_classic_dict_get_next_key(dict, &key)) {
+        mf_classic_key_scheduler_start_sector(scheduler);
+        while(mf_classic_key_scheduler_get_next_key(scheduler, &key)) {
             FURI_LOG_T(TAG, "Key %d", key_index);
             if(++key_index % NFC_DICT_KEY_BATCH_SIZE == 0) {
                 nfc_worker->callback(NfcWorkerEventNewDictKeyBatch, nfc_worker->context);
@@ -978,6 +1006,7 @@ void nfc_worker_mf_classic_dict_attack(NfcWorker* nfc_worker) {
                     card_found_notified = true;
                     card_removed_notified = false;
                     nfc_worker_mf_classic_key_attack(nfc_worker, prev_key, &tx_rx, i);
+                    nfc_worker_mf_classic_add_found_keys(scheduler, data, i);
                     deactivated = true;
                 }
                 FURI_LOG_D(TAG, "Try to auth to sector %d with key %012llX", i, key);
@@ -987,21 +1016,20 @@ void nfc_worker_mf_classic_dict_attack(NfcWorker* nfc_worker) {
                         mf_classic_set_key_found(data, i, MfClassicKeyA, key);
                         FURI_LOG_D(TAG, "Key A found: %012llX", key);
                         nfc_worker->callback(NfcWorkerEventFoundKeyA, nfc_worker->context);
+                        mf_classic_key_scheduler_add_found_key(scheduler, key);
 
                         uint64_t found_key;
                         if(nfc_worker_mf_get_b_key_from_sector_trailer(
                                &tx_rx, i, key, &found_key)) {
                             FURI_LOG_D(TAG, "Found B key via reading sector %d", i);
                             mf_classic_set_key_found(data, i, MfClassicKeyB, found_key);
+                            mf_classic_key_scheduler_add_found_key(scheduler, found_key);
 
                             if(nfc_worker->state == NfcWorkerStateMfClassicDictAttack) {
                                 nfc_worker->callback(NfcWorkerEventFoundKeyB, nfc_worker->context);
                             }
-
-                            nfc_worker_mf_classic_key_attack(nfc_worker, found_key, &tx_rx, i + 1);
                             break;
                         }
-                        nfc_worker_mf_classic_key_attack(nfc_worker, key, &tx_rx, i + 1);
                     }
                     furi_hal_nfc_sleep();
                     deactivated = true;
@@ -1030,7 +1058,7 @@ void nfc_worker_mf_classic_dict_attack(NfcWorker* nfc_worker) {
                         FURI_LOG_D(TAG, "Key B found: %012llX", key);
                         mf_classic_set_key_found(data, i, MfClassicKeyB, key);
                         nfc_worker->callback(NfcWorkerEventFoundKeyB, nfc_worker->context);
-                        nfc_worker_mf_classic_key_attack(nfc_worker, key, &tx_rx, i + 1);
+                        mf_classic_key_scheduler_add_found_key(scheduler, key);
                     }
                     deactivated = true; //-V1048
                 } else {
@@ -1066,10 +1094,26 @@ void nfc_worker_mf_classic_dict_attack(NfcWorker* nfc_worker) {
             }
             prev_key = key;
         }
+        FURI_LOG_I(
+            TAG,
+            "Sector %d: %lu keys tried",
+            i,
+            mf_classic_key_scheduler_get_sector_keys_tried(scheduler));
         if(nfc_worker->state != NfcWorkerStateMfClassicDictAttack) break;
         mf_classic_read_sector(&tx_rx, data, i);
-        mf_classic_dict_rewind(dict);
     }
+
+    MfClassicKeySchedulerStats stats;
+    mf_classic_key_scheduler_get_stats(scheduler, &stats);
+    FURI_LOG_I(
+        TAG,
+        "Dictionary attack: %lu keys tried, %lu sectors opened by found keys, %lu keys saved",
+        stats.keys_tried,
+        stats.sectors_opened,
+        stats.keys_saved);
+    mf_classic_key_scheduler_free(scheduler);
+    mf_classic_dict_rewind(dict);
+
     if(nfc_worker->state == NfcWorkerStateMfClassicDictAttack) {
         nfc_worker->callback(NfcWorkerEventSuccess, nfc_worker->context);
     } else {
@@ -90,6 +90,8 @@ NfcWorker* nfc_worker_alloc();
 
 NfcWorkerState nfc_worker_get_state(NfcWorker* nfc_worker);
 
+uint32_t nfc_worker_get_frames_dropped(NfcWorker* nfc_worker);
+
 void nfc_worker_free(NfcWorker* nfc_worker);
 
 void nfc_worker_start(
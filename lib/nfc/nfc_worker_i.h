@@ -15,6 +15,7 @@
 #include <lib/nfc/protocols/nfcv.h>
 #include <lib/nfc/protocols/slix.h>
 #include <lib/nfc/helpers/reader_analyzer.h>
+#include <lib/nfc/helpers/mf_classic_key_scheduler.h>
 
 struct NfcWorker {
     FuriThread* thread;
@@ -11,6 +11,65 @@
 
 #define BEBIT(x, n) FURI_BIT(x, (n) ^ 24)
 
+// Filter function contributions of input bits 0..7 and 8..15
+static const uint8_t crypto1_filter_lo[256] = {
+    0, 0, 16, 16, 0, 16, 0, 0, 0, 16, 0, 0, 16, 16, 16, 16, 0, 0, 16, 16, 0, 16, 0, 0, 0, 16, 0,
+    0, 16, 16, 16, 16, 0, 0, 16, 16, 0, 16, 0, 0, 0, 16, 0, 0, 16, 16, 16, 16, 8, 8, 24, 24, 8,
+    24, 8, 8, 8, 24, 8, 8, 24, 24, 24, 24, 8, 8, 24, 24, 8, 24, 8, 8, 8, 24, 8, 8, 24, 24, 24,
+    24, 8, 8, 24, 24, 8, 24, 8, 8, 8, 24, 8, 8, 24, 24, 24, 24, 0, 0, 16, 16, 0, 16, 0, 0, 0, 16,
+    0, 0, 16, 16, 16, 16, 0, 0, 16, 16, 0, 16, 0, 0, 0, 16, 0, 0, 16, 16, 16, 16, 8, 8, 24, 24,
+    8, 24, 8, 8, 8, 24, 8, 8, 24, 24, 24, 24, 0, 0, 16, 16, 0, 16, 0, 0, 0, 16, 0, 0, 16, 16, 16,
+    16, 0, 0, 16, 16, 0, 16, 0, 0, 0, 16, 0, 0, 16, 16, 16, 16, 8, 8, 24, 24, 8, 24, 8, 8, 8, 24,
+    8, 8, 24, 24, 24, 24, 8, 8, 24, 24, 8, 24, 8, 8, 8, 24, 8, 8, 24, 24, 24, 24, 0, 0, 16, 16,
+    0, 16, 0, 0, 0, 16, 0, 0, 16, 16, 16, 16, 8, 8, 24, 24, 8, 24, 8, 8, 8, 24, 8, 8, 24, 24, 24,
+    24, 8, 8, 24, 24, 8, 24, 8, 8, 8, 24, 8, 8, 24, 24, 24, 24};
+static const uint8_t crypto1_filter_mid[256] = {
+    0, 0, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4, 0, 0, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 4, 4, 4,
+    4, 2, 2, 6, 6, 2, 6, 2, 2, 2, 6, 2, 2, 6, 6, 6, 6, 2, 2, 6, 6, 2, 6, 2, 2, 2, 6, 2, 2, 6, 6,
+    6, 6, 0, 0, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4, 2, 2, 6, 6, 2, 6, 2, 2, 2, 6, 2, 2, 6,
+    6, 6, 6, 0, 0, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4, 0, 0, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0,
+    4, 4, 4, 4, 0, 0, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4, 2, 2, 6, 6, 2, 6, 2, 2, 2, 6, 2,
+    2, 6, 6, 6, 6, 0, 0, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4, 0, 0, 4, 4, 0, 4, 0, 0, 0, 4,
+    0, 0, 4, 4, 4, 4, 2, 2, 6, 6, 2, 6, 2, 2, 2, 6, 2, 2, 6, 6, 6, 6, 2, 2, 6, 6, 2, 6, 2, 2, 2,
+    6, 2, 2, 6, 6, 6, 6, 2, 2, 6, 6, 2, 6, 2, 2, 2, 6, 2, 2, 6, 6, 6, 6, 2, 2, 6, 6, 2, 6, 2, 2,
+    2, 6, 2, 2, 6, 6, 6, 6};
+
+static inline uint32_t crypto1_filter_fast(uint32_t in) {
+    uint32_t out = crypto1_filter_lo[in & 0xff] | crypto1_filter_mid[(in >> 8) & 0xff];
+    out |= 0x0d938 >> (in >> 16 & 0xf) & 1;
+    return FURI_BIT(0xEC57E80A, out);
+}
+
+// __builtin_parity is a library call on Cortex-M4
+static inline uint32_t crypto1_parity(uint32_t in) {
+    in ^= in >> 16;
+    in ^= in >> 8;
+    in ^= in >> 4;
+    return 0x6996 >> (in & 0xf) & 1;
+}
+
+// Clocks one bit into even half, caller swaps halves instead of moving them
+static inline uint32_t
+    crypto1_step(uint32_t odd, uint32_t* even, uint32_t in, uint32_t is_encrypted) {
+    uint32_t out = crypto1_filter_fast(odd);
+    uint32_t feed = (out & is_encrypted) ^ in;
+    feed ^= LF_POLY_ODD & odd;
+    feed ^= LF_POLY_EVEN & *even;
+    *even = *even << 1 | crypto1_parity(feed);
+    return out;
+}
+
+// Two bits per iteration, halves are back in place after every byte
+static inline uint8_t
+    crypto1_byte_fast(uint32_t* odd, uint32_t* even, uint8_t in, uint32_t is_encrypted) {
+    uint8_t out = 0;
+    for(uint8_t i = 0; i < 8; i += 2) {
+        out |= crypto1_step(*odd, even, FURI_BIT(in, i), is_encrypted) << i;
+        out |= crypto1_step(*even, odd, FURI_BIT(in, i + 1), is_encrypted) << (i + 1);
+    }
+    return out;
+}
+
 void crypto1_reset(Crypto1* crypto1) {
     furi_assert(crypto1);
     crypto1->even = 0;
@@ -28,23 +87,12 @@ void crypto1_init(Crypto1* crypto1, uint64_t key) {
 }
 
 uint32_t crypto1_filter(uint32_t in) {
-    uint32_t out = 0;
-    out = 0xf22c0 >> (in & 0xf) & 16;
-    out |= 0x6c9c0 >> (in >> 4 & 0xf) & 8;
-    out |= 0x3c8b0 >> (in >> 8 & 0xf) & 4;
-    out |= 0x1e458 >> (in >> 12 & 0xf) & 2;
-    out |= 0x0d938 >> (in >> 16 & 0xf) & 1;
-    return FURI_BIT(0xEC57E80A, out);
+    return crypto1_filter_fast(in);
 }
 
 uint8_t crypto1_bit(Crypto1* crypto1, uint8_t in, int is_encrypted) {
     furi_assert(crypto1);
-    uint8_t out = crypto1_filter(crypto1->odd);
-    uint32_t feed = out & (!!is_encrypted);
-    feed ^= !!in;
-    feed ^= LF_POLY_ODD & crypto1->odd;
-    feed ^= LF_POLY_EVEN & crypto1->even;
-    crypto1->even = crypto1->even << 1 | (nfc_util_even_parity32(feed));
+    uint8_t out = crypto1_step(crypto1->odd, &crypto1->even, !!in, !!is_encrypted);
 
     FURI_SWAP(crypto1->odd, crypto1->even);
     return out;
@@ -52,19 +100,25 @@ uint8_t crypto1_bit(Crypto1* crypto1, uint8_t in, int is_encrypted) {
 
 uint8_t crypto1_byte(Crypto1* crypto1, uint8_t in, int is_encrypted) {
     furi_assert(crypto1);
-    uint8_t out = 0;
-    for(uint8_t i = 0; i < 8; i++) {
-        out |= crypto1_bit(crypto1, FURI_BIT(in, i), is_encrypted) << i;
-    }
+    uint32_t odd = crypto1->odd;
+    uint32_t even = crypto1->even;
+    uint8_t out = crypto1_byte_fast(&odd, &even, in, !!is_encrypted);
+    crypto1->odd = odd;
+    crypto1->even = even;
     return out;
 }
 
 uint32_t crypto1_word(Crypto1* crypto1, uint32_t in, int is_encrypted) {
     furi_assert(crypto1);
+    uint32_t odd = crypto1->odd;
+    uint32_t even = crypto1->even;
     uint32_t out = 0;
-    for(uint8_t i = 0; i < 32; i++) {
-        out |= crypto1_bit(crypto1, BEBIT(in, i), is_encrypted) << (24 ^ i);
+    // Word is clocked in byte by byte from the MSB, each byte LSB first
+    for(int8_t shift = 24; shift >= 0; shift -= 8) {
+        out |= (uint32_t)crypto1_byte_fast(&odd, &even, in >> shift, !!is_encrypted) << shift;
     }
+    crypto1->odd = odd;
+    crypto1->even = even;
     return out;
 }
 
@@ -121,7 +175,7 @@ void crypto1_encrypt(
             encrypted_data[i] = crypto1_byte(crypto, keystream ? keystream[i] : 0, 0) ^
                                 plain_data[i];
             encrypted_parity[i / 8] |=
-                (((crypto1_filter(crypto->odd) ^ nfc_util_odd_parity8(plain_data[i])) & 0x01)
+                (((crypto1_filter_fast(crypto->odd) ^ nfc_util_odd_parity8(plain_data[i])) & 0x01)
                  << (7 - (i & 0x0007)));
         }
     }
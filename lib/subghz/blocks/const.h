@@ -15,6 +15,19 @@ typedef struct {
     const uint8_t min_count_bit_for_found;
 } SubGhzBlockConst;
 
+/**
+ * The only pulse that moves a decoder out of its reset step:
+ * level and DURATION_DIFF(duration, te_short * te_short_count + te_long * te_long_count) <
+ * te_delta * te_delta_count. Lets SubGhzReceiver skip decoders that are idle.
+ */
+typedef struct {
+    const SubGhzBlockConst* timing;
+    const bool level;
+    const uint16_t te_short_count;
+    const uint16_t te_long_count;
+    const uint16_t te_delta_count;
+} SubGhzBlockPreamble;
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
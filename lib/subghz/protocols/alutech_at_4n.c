@@ -18,6 +18,13 @@ static const SubGhzBlockConst subghz_protocol_alutech_at_4n_const = {
     .min_count_bit_for_found = 72,
 };
 
+const SubGhzBlockPreamble subghz_protocol_alutech_at_4n_preamble = {
+    .timing = &subghz_protocol_alutech_at_4n_const,
+    .level = true,
+    .te_short_count = 1,
+    .te_delta_count = 1,
+};
+
 struct SubGhzProtocolDecoderAlutech_at_4n {
     SubGhzProtocolDecoderBase base;
 
@@ -53,6 +60,7 @@ const SubGhzProtocolDecoder subghz_protocol_alutech_at_4n_decoder = {
 
     .feed = subghz_protocol_decoder_alutech_at_4n_feed,
     .reset = subghz_protocol_decoder_alutech_at_4n_reset,
+    .is_idle = subghz_protocol_decoder_alutech_at_4n_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_alutech_at_4n_get_hash_data,
     .serialize = subghz_protocol_decoder_alutech_at_4n_serialize,
@@ -597,6 +605,12 @@ void subghz_protocol_decoder_alutech_at_4n_feed(void* context, bool level, uint3
     }
 }
 
+bool subghz_protocol_decoder_alutech_at_4n_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderAlutech_at_4n* instance = context;
+    return instance->decoder.parser_step == Alutech_at_4nDecoderStepReset;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -9,6 +9,7 @@ typedef struct SubGhzProtocolEncoderAlutech_at_4n SubGhzProtocolEncoderAlutech_a
 extern const SubGhzProtocolDecoder subghz_protocol_alutech_at_4n_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_alutech_at_4n_encoder;
 extern const SubGhzProtocol subghz_protocol_alutech_at_4n;
+extern const SubGhzBlockPreamble subghz_protocol_alutech_at_4n_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderAlutech_at_4n.
@@ -82,6 +83,13 @@ void subghz_protocol_decoder_alutech_at_4n_free(void* context);
  */
 void subghz_protocol_decoder_alutech_at_4n_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderAlutech_at_4n waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderAlutech_at_4n instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_alutech_at_4n_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderAlutech_at_4n instance
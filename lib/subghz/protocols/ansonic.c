@@ -21,6 +21,13 @@ static const SubGhzBlockConst subghz_protocol_ansonic_const = {
     .min_count_bit_for_found = 12,
 };
 
+const SubGhzBlockPreamble subghz_protocol_ansonic_preamble = {
+    .timing = &subghz_protocol_ansonic_const,
+    .level = false,
+    .te_short_count = 35,
+    .te_delta_count = 35,
+};
+
 struct SubGhzProtocolDecoderAnsonic {
     SubGhzProtocolDecoderBase base;
 
@@ -48,6 +55,7 @@ const SubGhzProtocolDecoder subghz_protocol_ansonic_decoder = {
 
     .feed = subghz_protocol_decoder_ansonic_feed,
     .reset = subghz_protocol_decoder_ansonic_reset,
+    .is_idle = subghz_protocol_decoder_ansonic_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_ansonic_get_hash_data,
     .serialize = subghz_protocol_decoder_ansonic_serialize,
@@ -279,6 +287,12 @@ void subghz_protocol_decoder_ansonic_feed(void* context, bool level, uint32_t du
     }
 }
 
+bool subghz_protocol_decoder_ansonic_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderAnsonic* instance = context;
+    return instance->decoder.parser_step == AnsonicDecoderStepReset;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
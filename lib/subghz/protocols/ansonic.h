@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderAnsonic SubGhzProtocolEncoderAnsonic;
 extern const SubGhzProtocolDecoder subghz_protocol_ansonic_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_ansonic_encoder;
 extern const SubGhzProtocol subghz_protocol_ansonic;
+extern const SubGhzBlockPreamble subghz_protocol_ansonic_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderAnsonic.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_ansonic_free(void* context);
  */
 void subghz_protocol_decoder_ansonic_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderAnsonic waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderAnsonic instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_ansonic_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderAnsonic instance
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../types.h"
+#include "../blocks/const.h"
 
 #ifdef __cplusplus
 extern "C" {
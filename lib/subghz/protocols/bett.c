@@ -32,6 +32,13 @@ static const SubGhzBlockConst subghz_protocol_bett_const = {
     .min_count_bit_for_found = 18,
 };
 
+const SubGhzBlockPreamble subghz_protocol_bett_preamble = {
+    .timing = &subghz_protocol_bett_const,
+    .level = false,
+    .te_short_count = 44,
+    .te_delta_count = 15,
+};
+
 struct SubGhzProtocolDecoderBETT {
     SubGhzProtocolDecoderBase base;
 
@@ -58,6 +65,7 @@ const SubGhzProtocolDecoder subghz_protocol_bett_decoder = {
 
     .feed = subghz_protocol_decoder_bett_feed,
     .reset = subghz_protocol_decoder_bett_reset,
+    .is_idle = subghz_protocol_decoder_bett_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_bett_get_hash_data,
     .serialize = subghz_protocol_decoder_bett_serialize,
@@ -289,6 +297,12 @@ void subghz_protocol_decoder_bett_feed(void* context, bool level, uint32_t durat
     }
 }
 
+bool subghz_protocol_decoder_bett_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderBETT* instance = context;
+    return instance->decoder.parser_step == BETTDecoderStepReset;
+}
+
 uint8_t subghz_protocol_decoder_bett_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderBETT* instance = context;
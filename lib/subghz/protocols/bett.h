@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderBETT SubGhzProtocolEncoderBETT;
 extern const SubGhzProtocolDecoder subghz_protocol_bett_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_bett_encoder;
 extern const SubGhzProtocol subghz_protocol_bett;
+extern const SubGhzBlockPreamble subghz_protocol_bett_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderBETT.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_bett_free(void* context);
  */
 void subghz_protocol_decoder_bett_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderBETT waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderBETT instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_bett_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderBETT instance
@@ -27,6 +27,13 @@ static const SubGhzBlockConst subghz_protocol_came_const = {
     .min_count_bit_for_found = 12,
 };
 
+const SubGhzBlockPreamble subghz_protocol_came_preamble = {
+    .timing = &subghz_protocol_came_const,
+    .level = false,
+    .te_short_count = 56,
+    .te_delta_count = 47,
+};
+
 struct SubGhzProtocolDecoderCame {
     SubGhzProtocolDecoderBase base;
 
@@ -54,6 +61,7 @@ const SubGhzProtocolDecoder subghz_protocol_came_decoder = {
 
     .feed = subghz_protocol_decoder_came_feed,
     .reset = subghz_protocol_decoder_came_reset,
+    .is_idle = subghz_protocol_decoder_came_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_came_get_hash_data,
     .serialize = subghz_protocol_decoder_came_serialize,
@@ -310,6 +318,12 @@ void subghz_protocol_decoder_came_feed(void* context, bool level, uint32_t durat
     }
 }
 
+bool subghz_protocol_decoder_came_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCame* instance = context;
+    return instance->decoder.parser_step == CameDecoderStepReset;
+}
+
 uint8_t subghz_protocol_decoder_came_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderCame* instance = context;
@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderCame SubGhzProtocolEncoderCame;
 extern const SubGhzProtocolDecoder subghz_protocol_came_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_came_encoder;
 extern const SubGhzProtocol subghz_protocol_came;
+extern const SubGhzBlockPreamble subghz_protocol_came_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderCame.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_came_free(void* context);
  */
 void subghz_protocol_decoder_came_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderCame waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderCame instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_came_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderCame instance
@@ -18,6 +18,13 @@ static const SubGhzBlockConst subghz_protocol_came_atomo_const = {
     .min_count_bit_for_found = 62,
 };
 
+const SubGhzBlockPreamble subghz_protocol_came_atomo_preamble = {
+    .timing = &subghz_protocol_came_atomo_const,
+    .level = false,
+    .te_long_count = 60,
+    .te_delta_count = 40,
+};
+
 struct SubGhzProtocolDecoderCameAtomo {
     SubGhzProtocolDecoderBase base;
 
@@ -45,6 +52,7 @@ const SubGhzProtocolDecoder subghz_protocol_came_atomo_decoder = {
 
     .feed = subghz_protocol_decoder_came_atomo_feed,
     .reset = subghz_protocol_decoder_came_atomo_reset,
+    .is_idle = subghz_protocol_decoder_came_atomo_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_came_atomo_get_hash_data,
     .serialize = subghz_protocol_decoder_came_atomo_serialize,
@@ -378,6 +386,12 @@ void subghz_protocol_decoder_came_atomo_reset(void* context) {
         NULL);
 }
 
+bool subghz_protocol_decoder_came_atomo_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCameAtomo* instance = context;
+    return instance->decoder.parser_step == CameAtomoDecoderStepReset;
+}
+
 void subghz_protocol_decoder_came_atomo_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderCameAtomo* instance = context;
@@ -9,6 +9,7 @@ typedef struct SubGhzProtocolEncoderCameAtomo SubGhzProtocolEncoderCameAtomo;
 extern const SubGhzProtocolDecoder subghz_protocol_came_atomo_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_came_atomo_encoder;
 extern const SubGhzProtocol subghz_protocol_came_atomo;
+extern const SubGhzBlockPreamble subghz_protocol_came_atomo_preamble;
 
 void atomo_decrypt(uint8_t* buff);
 
@@ -84,6 +85,13 @@ void subghz_protocol_decoder_came_atomo_free(void* context);
  */
 void subghz_protocol_decoder_came_atomo_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderCameAtomo waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderCameAtomo instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_came_atomo_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderCameAtomo instance
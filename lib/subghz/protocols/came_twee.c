@@ -50,6 +50,13 @@ static const SubGhzBlockConst subghz_protocol_came_twee_const = {
     .min_count_bit_for_found = 54,
 };
 
+const SubGhzBlockPreamble subghz_protocol_came_twee_preamble = {
+    .timing = &subghz_protocol_came_twee_const,
+    .level = false,
+    .te_long_count = 51,
+    .te_delta_count = 20,
+};
+
 struct SubGhzProtocolDecoderCameTwee {
     SubGhzProtocolDecoderBase base;
 
@@ -76,6 +83,7 @@ const SubGhzProtocolDecoder subghz_protocol_came_twee_decoder = {
 
     .feed = subghz_protocol_decoder_came_twee_feed,
     .reset = subghz_protocol_decoder_came_twee_reset,
+    .is_idle = subghz_protocol_decoder_came_twee_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_came_twee_get_hash_data,
     .serialize = subghz_protocol_decoder_came_twee_serialize,
@@ -314,6 +322,12 @@ void subghz_protocol_decoder_came_twee_reset(void* context) {
         NULL);
 }
 
+bool subghz_protocol_decoder_came_twee_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCameTwee* instance = context;
+    return instance->decoder.parser_step == CameTweeDecoderStepReset;
+}
+
 void subghz_protocol_decoder_came_twee_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderCameTwee* instance = context;
@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderCameTwee SubGhzProtocolEncoderCameTwee;
 extern const SubGhzProtocolDecoder subghz_protocol_came_twee_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_came_twee_encoder;
 extern const SubGhzProtocol subghz_protocol_came_twee;
+extern const SubGhzBlockPreamble subghz_protocol_came_twee_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderCameTwee.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_came_twee_free(void* context);
  */
 void subghz_protocol_decoder_came_twee_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderCameTwee waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderCameTwee instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_came_twee_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderCameTwee instance
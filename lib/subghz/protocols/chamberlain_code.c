@@ -45,6 +45,13 @@ static const SubGhzBlockConst subghz_protocol_chamb_code_const = {
     .min_count_bit_for_found = 10,
 };
 
+const SubGhzBlockPreamble subghz_protocol_chamb_code_preamble = {
+    .timing = &subghz_protocol_chamb_code_const,
+    .level = false,
+    .te_short_count = 39,
+    .te_delta_count = 20,
+};
+
 struct SubGhzProtocolDecoderChamb_Code {
     SubGhzProtocolDecoderBase base;
 
@@ -72,6 +79,7 @@ const SubGhzProtocolDecoder subghz_protocol_chamb_code_decoder = {
 
     .feed = subghz_protocol_decoder_chamb_code_feed,
     .reset = subghz_protocol_decoder_chamb_code_reset,
+    .is_idle = subghz_protocol_decoder_chamb_code_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_chamb_code_get_hash_data,
     .serialize = subghz_protocol_decoder_chamb_code_serialize,
@@ -298,6 +306,12 @@ static bool subghz_protocol_chamb_code_to_bit(uint64_t* data, uint8_t size) {
     return true;
 }
 
+bool subghz_protocol_decoder_chamb_code_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderChamb_Code* instance = context;
+    return instance->decoder.parser_step == Chamb_CodeDecoderStepReset;
+}
+
 static bool subghz_protocol_decoder_chamb_code_check_mask_and_parse(
     SubGhzProtocolDecoderChamb_Code* instance) {
     furi_assert(instance);
@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderChamb_Code SubGhzProtocolEncoderChamb_Code;
 extern const SubGhzProtocolDecoder subghz_protocol_chamb_code_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_chamb_code_encoder;
 extern const SubGhzProtocol subghz_protocol_chamb_code;
+extern const SubGhzBlockPreamble subghz_protocol_chamb_code_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderChamb_Code.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_chamb_code_free(void* context);
  */
 void subghz_protocol_decoder_chamb_code_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderChamb_Code waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderChamb_Code instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_chamb_code_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderChamb_Code instance
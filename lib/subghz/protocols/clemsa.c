@@ -31,6 +31,13 @@ static const SubGhzBlockConst subghz_protocol_clemsa_const = {
     .min_count_bit_for_found = 18,
 };
 
+const SubGhzBlockPreamble subghz_protocol_clemsa_preamble = {
+    .timing = &subghz_protocol_clemsa_const,
+    .level = false,
+    .te_short_count = 51,
+    .te_delta_count = 25,
+};
+
 struct SubGhzProtocolDecoderClemsa {
     SubGhzProtocolDecoderBase base;
 
@@ -57,6 +64,7 @@ const SubGhzProtocolDecoder subghz_protocol_clemsa_decoder = {
 
     .feed = subghz_protocol_decoder_clemsa_feed,
     .reset = subghz_protocol_decoder_clemsa_reset,
+    .is_idle = subghz_protocol_decoder_clemsa_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_clemsa_get_hash_data,
     .serialize = subghz_protocol_decoder_clemsa_serialize,
@@ -301,6 +309,12 @@ void subghz_protocol_decoder_clemsa_feed(void* context, bool level, uint32_t dur
     }
 }
 
+bool subghz_protocol_decoder_clemsa_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderClemsa* instance = context;
+    return instance->decoder.parser_step == ClemsaDecoderStepReset;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
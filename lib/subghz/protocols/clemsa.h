@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderClemsa SubGhzProtocolEncoderClemsa;
 extern const SubGhzProtocolDecoder subghz_protocol_clemsa_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_clemsa_encoder;
 extern const SubGhzProtocol subghz_protocol_clemsa;
+extern const SubGhzBlockPreamble subghz_protocol_clemsa_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderClemsa.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_clemsa_free(void* context);
  */
 void subghz_protocol_decoder_clemsa_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderClemsa waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderClemsa instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_clemsa_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderClemsa instance
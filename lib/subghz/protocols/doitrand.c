@@ -22,6 +22,13 @@ static const SubGhzBlockConst subghz_protocol_doitrand_const = {
     .min_count_bit_for_found = 37,
 };
 
+const SubGhzBlockPreamble subghz_protocol_doitrand_preamble = {
+    .timing = &subghz_protocol_doitrand_const,
+    .level = false,
+    .te_short_count = 62,
+    .te_delta_count = 30,
+};
+
 struct SubGhzProtocolDecoderDoitrand {
     SubGhzProtocolDecoderBase base;
 
@@ -49,6 +56,7 @@ const SubGhzProtocolDecoder subghz_protocol_doitrand_decoder = {
 
     .feed = subghz_protocol_decoder_doitrand_feed,
     .reset = subghz_protocol_decoder_doitrand_reset,
+    .is_idle = subghz_protocol_decoder_doitrand_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_doitrand_get_hash_data,
     .serialize = subghz_protocol_decoder_doitrand_serialize,
@@ -276,6 +284,12 @@ void subghz_protocol_decoder_doitrand_feed(void* context, bool level, uint32_t d
     }
 }
 
+bool subghz_protocol_decoder_doitrand_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderDoitrand* instance = context;
+    return instance->decoder.parser_step == DoitrandDecoderStepReset;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
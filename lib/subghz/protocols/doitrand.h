@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderDoitrand SubGhzProtocolEncoderDoitrand;
 extern const SubGhzProtocolDecoder subghz_protocol_doitrand_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_doitrand_encoder;
 extern const SubGhzProtocol subghz_protocol_doitrand;
+extern const SubGhzBlockPreamble subghz_protocol_doitrand_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderDoitrand.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_doitrand_free(void* context);
  */
 void subghz_protocol_decoder_doitrand_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderDoitrand waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderDoitrand instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_doitrand_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderDoitrand instance
@@ -16,6 +16,13 @@ static const SubGhzBlockConst subghz_protocol_dooya_const = {
     .min_count_bit_for_found = 40,
 };
 
+const SubGhzBlockPreamble subghz_protocol_dooya_preamble = {
+    .timing = &subghz_protocol_dooya_const,
+    .level = false,
+    .te_long_count = 12,
+    .te_delta_count = 20,
+};
+
 struct SubGhzProtocolDecoderDooya {
     SubGhzProtocolDecoderBase base;
 
@@ -43,6 +50,7 @@ const SubGhzProtocolDecoder subghz_protocol_dooya_decoder = {
 
     .feed = subghz_protocol_decoder_dooya_feed,
     .reset = subghz_protocol_decoder_dooya_reset,
+    .is_idle = subghz_protocol_decoder_dooya_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_dooya_get_hash_data,
     .serialize = subghz_protocol_decoder_dooya_serialize,
@@ -304,6 +312,12 @@ void subghz_protocol_decoder_dooya_feed(void* context, bool level, uint32_t dura
     }
 }
 
+bool subghz_protocol_decoder_dooya_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderDooya* instance = context;
+    return instance->decoder.parser_step == DooyaDecoderStepReset;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderDooya SubGhzProtocolEncoderDooya;
 extern const SubGhzProtocolDecoder subghz_protocol_dooya_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_dooya_encoder;
 extern const SubGhzProtocol subghz_protocol_dooya;
+extern const SubGhzBlockPreamble subghz_protocol_dooya_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderDooya.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_dooya_free(void* context);
  */
 void subghz_protocol_decoder_dooya_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderDooya waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderDooya instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_dooya_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderDooya instance
@@ -17,6 +17,13 @@ static const SubGhzBlockConst subghz_protocol_faac_slh_const = {
     .min_count_bit_for_found = 64,
 };
 
+const SubGhzBlockPreamble subghz_protocol_faac_slh_preamble = {
+    .timing = &subghz_protocol_faac_slh_const,
+    .level = true,
+    .te_long_count = 2,
+    .te_delta_count = 3,
+};
+
 struct SubGhzProtocolDecoderFaacSLH {
     SubGhzProtocolDecoderBase base;
 
@@ -50,6 +57,7 @@ const SubGhzProtocolDecoder subghz_protocol_faac_slh_decoder = {
 
     .feed = subghz_protocol_decoder_faac_slh_feed,
     .reset = subghz_protocol_decoder_faac_slh_reset,
+    .is_idle = subghz_protocol_decoder_faac_slh_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_faac_slh_get_hash_data,
     .serialize = subghz_protocol_decoder_faac_slh_serialize,
@@ -391,6 +399,12 @@ void subghz_protocol_decoder_faac_slh_feed(void* context, bool level, uint32_t d
     }
 }
 
+bool subghz_protocol_decoder_faac_slh_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderFaacSLH* instance = context;
+    return instance->decoder.parser_step == FaacSLHDecoderStepReset;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
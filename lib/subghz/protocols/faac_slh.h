@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderFaacSLH SubGhzProtocolEncoderFaacSLH;
 extern const SubGhzProtocolDecoder subghz_protocol_faac_slh_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_faac_slh_encoder;
 extern const SubGhzProtocol subghz_protocol_faac_slh;
+extern const SubGhzBlockPreamble subghz_protocol_faac_slh_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderFaacSLH.
@@ -87,6 +88,13 @@ void subghz_protocol_decoder_faac_slh_free(void* context);
  */
 void subghz_protocol_decoder_faac_slh_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderFaacSLH waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderFaacSLH instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_faac_slh_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderFaacSLH instance
@@ -15,6 +15,13 @@ static const SubGhzBlockConst subghz_protocol_gate_tx_const = {
     .min_count_bit_for_found = 24,
 };
 
+const SubGhzBlockPreamble subghz_protocol_gate_tx_preamble = {
+    .timing = &subghz_protocol_gate_tx_const,
+    .level = false,
+    .te_short_count = 47,
+    .te_delta_count = 47,
+};
+
 struct SubGhzProtocolDecoderGateTx {
     SubGhzProtocolDecoderBase base;
 
@@ -42,6 +49,7 @@ const SubGhzProtocolDecoder subghz_protocol_gate_tx_decoder = {
 
     .feed = subghz_protocol_decoder_gate_tx_feed,
     .reset = subghz_protocol_decoder_gate_tx_reset,
+    .is_idle = subghz_protocol_decoder_gate_tx_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_gate_tx_get_hash_data,
     .serialize = subghz_protocol_decoder_gate_tx_serialize,
@@ -269,6 +277,12 @@ void subghz_protocol_decoder_gate_tx_feed(void* context, bool level, uint32_t du
     }
 }
 
+bool subghz_protocol_decoder_gate_tx_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderGateTx* instance = context;
+    return instance->decoder.parser_step == GateTXDecoderStepReset;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
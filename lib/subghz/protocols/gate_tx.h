@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderGateTx SubGhzProtocolEncoderGateTx;
 extern const SubGhzProtocolDecoder subghz_protocol_gate_tx_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_gate_tx_encoder;
 extern const SubGhzProtocol subghz_protocol_gate_tx;
+extern const SubGhzBlockPreamble subghz_protocol_gate_tx_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderGateTx.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_gate_tx_free(void* context);
  */
 void subghz_protocol_decoder_gate_tx_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderGateTx waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderGateTx instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_gate_tx_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderGateTx instance
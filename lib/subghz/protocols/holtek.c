@@ -25,6 +25,13 @@ static const SubGhzBlockConst subghz_protocol_holtek_const = {
     .min_count_bit_for_found = 40,
 };
 
+const SubGhzBlockPreamble subghz_protocol_holtek_preamble = {
+    .timing = &subghz_protocol_holtek_const,
+    .level = false,
+    .te_short_count = 36,
+    .te_delta_count = 36,
+};
+
 struct SubGhzProtocolDecoderHoltek {
     SubGhzProtocolDecoderBase base;
 
@@ -52,6 +59,7 @@ const SubGhzProtocolDecoder subghz_protocol_holtek_decoder = {
 
     .feed = subghz_protocol_decoder_holtek_feed,
     .reset = subghz_protocol_decoder_holtek_reset,
+    .is_idle = subghz_protocol_decoder_holtek_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_holtek_get_hash_data,
     .serialize = subghz_protocol_decoder_holtek_serialize,
@@ -288,6 +296,12 @@ void subghz_protocol_decoder_holtek_feed(void* context, bool level, uint32_t dur
     }
 }
 
+bool subghz_protocol_decoder_holtek_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHoltek* instance = context;
+    return instance->decoder.parser_step == HoltekDecoderStepReset;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderHoltek SubGhzProtocolEncoderHoltek;
 extern const SubGhzProtocolDecoder subghz_protocol_holtek_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_holtek_encoder;
 extern const SubGhzProtocol subghz_protocol_holtek;
+extern const SubGhzBlockPreamble subghz_protocol_holtek_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderHoltek.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_holtek_free(void* context);
  */
 void subghz_protocol_decoder_holtek_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderHoltek waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderHoltek instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_holtek_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderHoltek instance
@@ -27,6 +27,13 @@ static const SubGhzBlockConst subghz_protocol_holtek_th12x_const = {
     .min_count_bit_for_found = 12,
 };
 
+const SubGhzBlockPreamble subghz_protocol_holtek_th12x_preamble = {
+    .timing = &subghz_protocol_holtek_th12x_const,
+    .level = false,
+    .te_short_count = 36,
+    .te_delta_count = 36,
+};
+
 struct SubGhzProtocolDecoderHoltek_HT12X {
     SubGhzProtocolDecoderBase base;
 
@@ -59,6 +66,7 @@ const SubGhzProtocolDecoder subghz_protocol_holtek_th12x_decoder = {
 
     .feed = subghz_protocol_decoder_holtek_th12x_feed,
     .reset = subghz_protocol_decoder_holtek_th12x_reset,
+    .is_idle = subghz_protocol_decoder_holtek_th12x_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_holtek_th12x_get_hash_data,
     .serialize = subghz_protocol_decoder_holtek_th12x_serialize,
@@ -313,6 +321,12 @@ void subghz_protocol_decoder_holtek_th12x_feed(void* context, bool level, uint32
     }
 }
 
+bool subghz_protocol_decoder_holtek_th12x_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHoltek_HT12X* instance = context;
+    return instance->decoder.parser_step == Holtek_HT12XDecoderStepReset;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
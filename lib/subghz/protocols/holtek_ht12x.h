@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderHoltek_HT12X SubGhzProtocolEncoderHoltek_HT1
 extern const SubGhzProtocolDecoder subghz_protocol_holtek_th12x_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_holtek_th12x_encoder;
 extern const SubGhzProtocol subghz_protocol_holtek_th12x;
+extern const SubGhzBlockPreamble subghz_protocol_holtek_th12x_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderHoltek_HT12X.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_holtek_th12x_free(void* context);
  */
 void subghz_protocol_decoder_holtek_th12x_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderHoltek_HT12X waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderHoltek_HT12X instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_holtek_th12x_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderHoltek_HT12X instance
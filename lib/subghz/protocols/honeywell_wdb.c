@@ -21,6 +21,13 @@ static const SubGhzBlockConst subghz_protocol_honeywell_wdb_const = {
     .min_count_bit_for_found = 48,
 };
 
+const SubGhzBlockPreamble subghz_protocol_honeywell_wdb_preamble = {
+    .timing = &subghz_protocol_honeywell_wdb_const,
+    .level = false,
+    .te_short_count = 3,
+    .te_delta_count = 1,
+};
+
 struct SubGhzProtocolDecoderHoneywell_WDB {
     SubGhzProtocolDecoderBase base;
 
@@ -53,6 +60,7 @@ const SubGhzProtocolDecoder subghz_protocol_honeywell_wdb_decoder = {
 
     .feed = subghz_protocol_decoder_honeywell_wdb_feed,
     .reset = subghz_protocol_decoder_honeywell_wdb_reset,
+    .is_idle = subghz_protocol_decoder_honeywell_wdb_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_honeywell_wdb_get_hash_data,
     .serialize = subghz_protocol_decoder_honeywell_wdb_serialize,
@@ -278,6 +286,12 @@ void subghz_protocol_decoder_honeywell_wdb_feed(void* context, bool level, uint3
     }
 }
 
+bool subghz_protocol_decoder_honeywell_wdb_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHoneywell_WDB* instance = context;
+    return instance->decoder.parser_step == Honeywell_WDBDecoderStepReset;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzProtocolDecoderHoneywell_WDB* instance
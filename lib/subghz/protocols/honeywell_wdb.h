@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderHoneywell_WDB SubGhzProtocolEncoderHoneywell
 extern const SubGhzProtocolDecoder subghz_protocol_honeywell_wdb_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_honeywell_wdb_encoder;
 extern const SubGhzProtocol subghz_protocol_honeywell_wdb;
+extern const SubGhzBlockPreamble subghz_protocol_honeywell_wdb_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderHoneywell_WDB.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_honeywell_wdb_free(void* context);
  */
 void subghz_protocol_decoder_honeywell_wdb_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderHoneywell_WDB waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderHoneywell_WDB instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_honeywell_wdb_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderHoneywell_WDB instance
@@ -17,6 +17,13 @@ static const SubGhzBlockConst subghz_protocol_hormann_const = {
     .min_count_bit_for_found = 44,
 };
 
+const SubGhzBlockPreamble subghz_protocol_hormann_preamble = {
+    .timing = &subghz_protocol_hormann_const,
+    .level = true,
+    .te_short_count = 24,
+    .te_delta_count = 24,
+};
+
 struct SubGhzProtocolDecoderHormann {
     SubGhzProtocolDecoderBase base;
 
@@ -46,6 +53,7 @@ const SubGhzProtocolDecoder subghz_protocol_hormann_decoder = {
 
     .feed = subghz_protocol_decoder_hormann_feed,
     .reset = subghz_protocol_decoder_hormann_reset,
+    .is_idle = subghz_protocol_decoder_hormann_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_hormann_get_hash_data,
     .serialize = subghz_protocol_decoder_hormann_serialize,
@@ -280,6 +288,12 @@ void subghz_protocol_decoder_hormann_feed(void* context, bool level, uint32_t du
     }
 }
 
+bool subghz_protocol_decoder_hormann_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHormann* instance = context;
+    return instance->decoder.parser_step == HormannDecoderStepReset;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderHormann SubGhzProtocolEncoderHormann;
 extern const SubGhzProtocolDecoder subghz_protocol_hormann_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_hormann_encoder;
 extern const SubGhzProtocol subghz_protocol_hormann;
+extern const SubGhzBlockPreamble subghz_protocol_hormann_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderHormann.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_hormann_free(void* context);
  */
 void subghz_protocol_decoder_hormann_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderHormann waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderHormann instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_hormann_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderHormann instance
@@ -15,6 +15,13 @@ static const SubGhzBlockConst subghz_protocol_ido_const = {
     .min_count_bit_for_found = 48,
 };
 
+const SubGhzBlockPreamble subghz_protocol_ido_preamble = {
+    .timing = &subghz_protocol_ido_const,
+    .level = true,
+    .te_short_count = 10,
+    .te_delta_count = 5,
+};
+
 struct SubGhzProtocolDecoderIDo {
     SubGhzProtocolDecoderBase base;
 
@@ -42,6 +49,7 @@ const SubGhzProtocolDecoder subghz_protocol_ido_decoder = {
 
     .feed = subghz_protocol_decoder_ido_feed,
     .reset = subghz_protocol_decoder_ido_reset,
+    .is_idle = subghz_protocol_decoder_ido_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_ido_get_hash_data,
     .deserialize = subghz_protocol_decoder_ido_deserialize,
@@ -160,6 +168,12 @@ void subghz_protocol_decoder_ido_feed(void* context, bool level, uint32_t durati
     }
 }
 
+bool subghz_protocol_decoder_ido_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderIDo* instance = context;
+    return instance->decoder.parser_step == IDoDecoderStepReset;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
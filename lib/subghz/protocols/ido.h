@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderIDo SubGhzProtocolEncoderIDo;
 extern const SubGhzProtocolDecoder subghz_protocol_ido_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_ido_encoder;
 extern const SubGhzProtocol subghz_protocol_ido;
+extern const SubGhzBlockPreamble subghz_protocol_ido_preamble;
 
 /**
  * Allocate SubGhzProtocolDecoderIDo.
@@ -30,6 +31,13 @@ void subghz_protocol_decoder_ido_free(void* context);
  */
 void subghz_protocol_decoder_ido_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderIDo waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderIDo instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_ido_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderIDo instance
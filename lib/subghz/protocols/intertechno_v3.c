@@ -21,6 +21,13 @@ static const SubGhzBlockConst subghz_protocol_intertechno_v3_const = {
     .min_count_bit_for_found = 32,
 };
 
+const SubGhzBlockPreamble subghz_protocol_intertechno_v3_preamble = {
+    .timing = &subghz_protocol_intertechno_v3_const,
+    .level = false,
+    .te_short_count = 37,
+    .te_delta_count = 15,
+};
+
 struct SubGhzProtocolDecoderIntertechno_V3 {
     SubGhzProtocolDecoderBase base;
 
@@ -51,6 +58,7 @@ const SubGhzProtocolDecoder subghz_protocol_intertechno_v3_decoder = {
 
     .feed = subghz_protocol_decoder_intertechno_v3_feed,
     .reset = subghz_protocol_decoder_intertechno_v3_reset,
+    .is_idle = subghz_protocol_decoder_intertechno_v3_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_intertechno_v3_get_hash_data,
     .serialize = subghz_protocol_decoder_intertechno_v3_serialize,
@@ -346,6 +354,12 @@ void subghz_protocol_decoder_intertechno_v3_feed(void* context, bool level, uint
     }
 }
 
+bool subghz_protocol_decoder_intertechno_v3_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderIntertechno_V3* instance = context;
+    return instance->decoder.parser_step == IntertechnoV3DecoderStepReset;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
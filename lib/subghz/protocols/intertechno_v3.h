@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderIntertechno_V3 SubGhzProtocolEncoderIntertec
 extern const SubGhzProtocolDecoder subghz_protocol_intertechno_v3_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_intertechno_v3_encoder;
 extern const SubGhzProtocol subghz_protocol_intertechno_v3;
+extern const SubGhzBlockPreamble subghz_protocol_intertechno_v3_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderIntertechno_V3.
@@ -66,6 +67,13 @@ void subghz_protocol_decoder_intertechno_v3_free(void* context);
  */
 void subghz_protocol_decoder_intertechno_v3_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderIntertechno_V3 waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderIntertechno_V3 instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_intertechno_v3_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderIntertechno_V3 instance
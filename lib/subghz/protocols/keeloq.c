@@ -22,6 +22,13 @@ static const SubGhzBlockConst subghz_protocol_keeloq_const = {
     .min_count_bit_for_found = 64,
 };
 
+const SubGhzBlockPreamble subghz_protocol_keeloq_preamble = {
+    .timing = &subghz_protocol_keeloq_const,
+    .level = true,
+    .te_short_count = 1,
+    .te_delta_count = 1,
+};
+
 struct SubGhzProtocolDecoderKeeloq {
     SubGhzProtocolDecoderBase base;
 
@@ -60,6 +67,7 @@ const SubGhzProtocolDecoder subghz_protocol_keeloq_decoder = {
 
     .feed = subghz_protocol_decoder_keeloq_feed,
     .reset = subghz_protocol_decoder_keeloq_reset,
+    .is_idle = subghz_protocol_decoder_keeloq_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_keeloq_get_hash_data,
     .serialize = subghz_protocol_decoder_keeloq_serialize,
@@ -585,6 +593,12 @@ void subghz_protocol_decoder_keeloq_reset(void* context) {
     instance->keystore->kl_type = 0;
 }
 
+bool subghz_protocol_decoder_keeloq_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderKeeloq* instance = context;
+    return instance->decoder.parser_step == KeeloqDecoderStepReset;
+}
+
 void subghz_protocol_decoder_keeloq_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderKeeloq* instance = context;
@@ -728,6 +742,301 @@ static inline bool subghz_protocol_keeloq_check_decrypt_centurion(
     return false;
 }
 
+typedef enum {
+    KeeloqCandidateLearningNone, /**< man is ready for hop decrypt */
+    KeeloqCandidateLearningNormal, /**< man is a manufacture key, normal learning pending */
+    KeeloqCandidateLearningSecure, /**< man is a manufacture key, secure learning pending */
+} KeeloqCandidateLearning;
+
+typedef struct {
+    const SubGhzKey* manufacture_code;
+    uint64_t man;
+    KeeloqCandidateLearning learning;
+    uint8_t kl_type; /**< learning type remembered in keystore on match, 0 - keep */
+    bool centurion;
+} KeeloqCandidate;
+
+/** Candidate keys in keystore order, decrypted KEELOQ_BATCH_SIZE at a time */
+typedef struct {
+    KeeloqCandidate candidate[KEELOQ_BATCH_SIZE];
+    uint64_t keys[KEELOQ_BATCH_SIZE];
+    uint64_t man[KEELOQ_BATCH_SIZE];
+    uint32_t decrypt[KEELOQ_BATCH_SIZE];
+    size_t count;
+} KeeloqCandidateBatch;
+
+static inline void subghz_protocol_keeloq_candidate_add(
+    KeeloqCandidateBatch* batch,
+    const SubGhzKey* manufacture_code,
+    uint64_t man,
+    KeeloqCandidateLearning learning,
+    uint8_t kl_type) {
+    furi_assert(batch->count < KEELOQ_BATCH_SIZE);
+    KeeloqCandidate* candidate = &batch->candidate[batch->count++];
+    candidate->manufacture_code = manufacture_code;
+    candidate->man = man;
+    candidate->learning = learning;
+    candidate->kl_type = kl_type;
+    candidate->centurion = false;
+}
+
+static size_t subghz_protocol_keeloq_candidate_count(uint16_t type) {
+    switch(type) {
+    case KEELOQ_LEARNING_SIMPLE:
+    case KEELOQ_LEARNING_NORMAL:
+    case KEELOQ_LEARNING_SECURE:
+    case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1:
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2:
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3:
+        return 1;
+    case KEELOQ_LEARNING_UNKNOWN:
+        // Simple, normal, secure and magic xor, each with straight and mirrored man
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+/** 
+ * Expand manufacture key into candidates, in the order they must be checked
+ * @param batch Pointer to a KeeloqCandidateBatch
+ * @param manufacture_code Pointer to a SubGhzKey
+ * @param fix Fix part of the parcel
+ */
+static void subghz_protocol_keeloq_candidate_expand(
+    KeeloqCandidateBatch* batch,
+    const SubGhzKey* manufacture_code,
+    uint32_t fix) {
+    const uint64_t key = manufacture_code->key;
+    uint64_t man_rev = 0;
+
+    switch(manufacture_code->type) {
+    case KEELOQ_LEARNING_SIMPLE:
+        subghz_protocol_keeloq_candidate_add(
+            batch, manufacture_code, key, KeeloqCandidateLearningNone, 0);
+        break;
+    case KEELOQ_LEARNING_NORMAL:
+        // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
+        subghz_protocol_keeloq_candidate_add(
+            batch, manufacture_code, key, KeeloqCandidateLearningNormal, 0);
+        batch->candidate[batch->count - 1].centurion =
+            (strcmp(furi_string_get_cstr(manufacture_code->name), "Centurion") == 0);
+        break;
+    case KEELOQ_LEARNING_SECURE:
+        subghz_protocol_keeloq_candidate_add(
+            batch, manufacture_code, key, KeeloqCandidateLearningSecure, 0);
+        break;
+    case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
+        subghz_protocol_keeloq_candidate_add(
+            batch,
+            manufacture_code,
+            subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, key),
+            KeeloqCandidateLearningNone,
+            0);
+        break;
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1:
+        subghz_protocol_keeloq_candidate_add(
+            batch,
+            manufacture_code,
+            subghz_protocol_keeloq_common_magic_serial_type1_learning(fix, key),
+            KeeloqCandidateLearningNone,
+            0);
+        break;
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2:
+        subghz_protocol_keeloq_candidate_add(
+            batch,
+            manufacture_code,
+            subghz_protocol_keeloq_common_magic_serial_type2_learning(fix, key),
+            KeeloqCandidateLearningNone,
+            0);
+        break;
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3:
+        subghz_protocol_keeloq_candidate_add(
+            batch,
+            manufacture_code,
+            subghz_protocol_keeloq_common_magic_serial_type3_learning(fix, key),
+            KeeloqCandidateLearningNone,
+            0);
+        break;
+    case KEELOQ_LEARNING_UNKNOWN:
+        // Check for mirrored man
+        for(uint8_t i = 0; i < 64; i += 8) {
+            man_rev = man_rev | (uint64_t)(uint8_t)(key >> i) << (56 - i);
+        }
+        // Simple Learning
+        subghz_protocol_keeloq_candidate_add(
+            batch, manufacture_code, key, KeeloqCandidateLearningNone, 1);
+        subghz_protocol_keeloq_candidate_add(
+            batch, manufacture_code, man_rev, KeeloqCandidateLearningNone, 1);
+        // Normal Learning
+        // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
+        subghz_protocol_keeloq_candidate_add(
+            batch, manufacture_code, key, KeeloqCandidateLearningNormal, 2);
+        subghz_protocol_keeloq_candidate_add(
+            batch, manufacture_code, man_rev, KeeloqCandidateLearningNormal, 2);
+        // Secure Learning
+        subghz_protocol_keeloq_candidate_add(
+            batch, manufacture_code, key, KeeloqCandidateLearningSecure, 3);
+        subghz_protocol_keeloq_candidate_add(
+            batch, manufacture_code, man_rev, KeeloqCandidateLearningSecure, 3);
+        // Magic xor type1 learning
+        subghz_protocol_keeloq_candidate_add(
+            batch,
+            manufacture_code,
+            subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, key),
+            KeeloqCandidateLearningNone,
+            4);
+        subghz_protocol_keeloq_candidate_add(
+            batch,
+            manufacture_code,
+            subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, man_rev),
+            KeeloqCandidateLearningNone,
+            4);
+        break;
+    }
+}
+
+#define subghz_protocol_keeloq_learning_cache_serial(fix) ((fix)&0x0FFFFFFF)
+
+static inline void subghz_protocol_keeloq_learning_cache_put(
+    SubGhzKeystore* keystore,
+    uint32_t fix,
+    uint32_t seed,
+    const SubGhzKey* manufacture_code,
+    uint64_t man,
+    uint8_t learning_type) {
+    subghz_keystore_learning_cache_put(
+        keystore,
+        subghz_protocol_keeloq_learning_cache_serial(fix),
+        seed,
+        manufacture_code,
+        man,
+        learning_type);
+}
+
+/** 
+ * Check the device key derived for this remote on a previous press
+ * One decrypt instead of the whole keystore search on a hit
+ * @return true if the cached device key still decrypts hop
+ */
+static bool subghz_protocol_keeloq_learning_cache_check(
+    SubGhzBlockGeneric* instance,
+    uint32_t fix,
+    uint32_t hop,
+    SubGhzKeystore* keystore,
+    const char* mfname,
+    const char** manufacture_name) {
+    uint32_t serial = subghz_protocol_keeloq_learning_cache_serial(fix);
+    uint64_t man;
+    uint8_t learning_type;
+    const SubGhzKey* manufacture_code = subghz_keystore_learning_cache_get(
+        keystore, serial, instance->seed, &man, &learning_type);
+    if(!manufacture_code) return false;
+
+    const char* name = furi_string_get_cstr(manufacture_code->name);
+    uint32_t decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+    bool found = false;
+    if((strcmp(mfname, "") == 0) || (strcmp(name, mfname) == 0)) {
+        if((manufacture_code->type == KEELOQ_LEARNING_NORMAL) &&
+           (strcmp(name, "Centurion") == 0)) {
+            found =
+                subghz_protocol_keeloq_check_decrypt_centurion(instance, decrypt, (fix >> 28));
+        } else {
+            found = subghz_protocol_keeloq_check_decrypt(
+                instance, decrypt, (fix >> 28), (fix & 0xFF));
+        }
+    }
+
+    if(found) {
+        *manufacture_name = name;
+        keystore->mfname = *manufacture_name;
+        if(manufacture_code->type == KEELOQ_LEARNING_UNKNOWN) {
+            keystore->kl_type = learning_type;
+        }
+    } else {
+        subghz_keystore_learning_cache_drop(keystore, serial, instance->seed);
+    }
+    return found;
+}
+
+/** 
+ * Resolve pending learning for the whole batch, decrypt hop with every
+ * candidate at once and check them in keystore order
+ * @return true if one of the candidates matched
+ */
+static bool subghz_protocol_keeloq_candidate_batch_check(
+    KeeloqCandidateBatch* batch,
+    SubGhzBlockGeneric* instance,
+    uint32_t fix,
+    uint32_t hop,
+    SubGhzKeystore* keystore,
+    const char** manufacture_name) {
+    uint16_t end_serial = (uint16_t)(fix & 0xFF);
+    uint8_t btn = (uint8_t)(fix >> 28);
+    const KeeloqCandidateLearning learnings[] = {
+        KeeloqCandidateLearningNormal,
+        KeeloqCandidateLearningSecure,
+    };
+
+    for(size_t l = 0; l < COUNT_OF(learnings); l++) {
+        size_t count = 0;
+        for(size_t i = 0; i < batch->count; i++) {
+            if(batch->candidate[i].learning == learnings[l]) {
+                batch->keys[count++] = batch->candidate[i].man;
+            }
+        }
+        if(!count) continue;
+
+        if(learnings[l] == KeeloqCandidateLearningNormal) {
+            subghz_protocol_keeloq_common_normal_learning_batch(
+                fix, batch->keys, batch->man, count);
+        } else {
+            subghz_protocol_keeloq_common_secure_learning_batch(
+                fix, instance->seed, batch->keys, batch->man, count);
+        }
+
+        count = 0;
+        for(size_t i = 0; i < batch->count; i++) {
+            if(batch->candidate[i].learning == learnings[l]) {
+                batch->candidate[i].man = batch->man[count++];
+            }
+        }
+    }
+
+    for(size_t i = 0; i < batch->count; i++) {
+        batch->keys[i] = batch->candidate[i].man;
+    }
+    subghz_protocol_keeloq_common_decrypt_batch(hop, batch->keys, batch->decrypt, batch->count);
+
+    size_t count = batch->count;
+    batch->count = 0;
+    for(size_t i = 0; i < count; i++) {
+        const KeeloqCandidate* candidate = &batch->candidate[i];
+        bool found = candidate->centurion ? subghz_protocol_keeloq_check_decrypt_centurion(
+                                                instance, batch->decrypt[i], btn) :
+                                            subghz_protocol_keeloq_check_decrypt(
+                                                instance, batch->decrypt[i], btn, end_serial);
+        if(found) {
+            *manufacture_name = furi_string_get_cstr(candidate->manufacture_code->name);
+            keystore->mfname = *manufacture_name;
+            if(candidate->kl_type) {
+                keystore->kl_type = candidate->kl_type;
+            }
+            // kl_type is set only for unknown learning and matches KEELOQ_LEARNING_* numbering
+            subghz_protocol_keeloq_learning_cache_put(
+                keystore,
+                fix,
+                instance->seed,
+                candidate->manufacture_code,
+                candidate->man,
+                candidate->kl_type ? candidate->kl_type : candidate->manufacture_code->type);
+            return true;
+        }
+    }
+    return false;
+}
+
 /** 
  * Checking the accepted code against the database manafacture key
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -747,10 +1056,6 @@ static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
     // HCS300 -> uint16_t end_serial = (uint16_t)(fix & 0x3FF);
     // HCS200 -> uint16_t end_serial = (uint16_t)(fix & 0xFF);
 
-    uint16_t end_serial = (uint16_t)(fix & 0xFF);
-    uint8_t btn = (uint8_t)(fix >> 28);
-    uint32_t decrypt = 0;
-    uint64_t man;
     bool mf_not_set = false;
     // TODO:
     // if(mfname == 0x0) {
@@ -764,187 +1069,42 @@ static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
     } else if(strcmp(mfname, "") == 0) {
         mf_not_set = true;
     }
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            if(mf_not_set || (strcmp(furi_string_get_cstr(manufacture_code->name), mfname) == 0)) {
-                switch(manufacture_code->type) {
-                case KEELOQ_LEARNING_SIMPLE:
-                    // Simple Learning
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_NORMAL:
-                    // Normal Learning
-                    // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                    man =
-                        subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if((strcmp(furi_string_get_cstr(manufacture_code->name), "Centurion") == 0)) {
-                        if(subghz_protocol_keeloq_check_decrypt_centurion(instance, decrypt, btn)) {
-                            *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                            keystore->mfname = *manufacture_name;
-                            return 1;
-                        }
-                    } else {
-                        if(subghz_protocol_keeloq_check_decrypt(
-                               instance, decrypt, btn, end_serial)) {
-                            *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                            keystore->mfname = *manufacture_name;
-                            return 1;
-                        }
-                    }
-                    break;
-                case KEELOQ_LEARNING_SECURE:
-                    man = subghz_protocol_keeloq_common_secure_learning(
-                        fix, instance->seed, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
-                    man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1:
-                    man = subghz_protocol_keeloq_common_magic_serial_type1_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2:
-                    man = subghz_protocol_keeloq_common_magic_serial_type2_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3:
-                    man = subghz_protocol_keeloq_common_magic_serial_type3_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_UNKNOWN:
-                    // Simple Learning
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 1;
-                        return 1;
-                    }
-
-                    // Check for mirrored man
-                    uint64_t man_rev = 0;
-                    uint64_t man_rev_byte = 0;
-                    for(uint8_t i = 0; i < 64; i += 8) {
-                        man_rev_byte = (uint8_t)(manufacture_code->key >> i);
-                        man_rev = man_rev | man_rev_byte << (56 - i);
-                    }
-
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_rev);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 1;
-                        return 1;
-                    }
-
-                    //###########################
-                    // Normal Learning
-                    // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                    man =
-                        subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 2;
-                        return 1;
-                    }
-
-                    // Check for mirrored man
-                    man = subghz_protocol_keeloq_common_normal_learning(fix, man_rev);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 2;
-                        return 1;
-                    }
-
-                    // Secure Learning
-                    man = subghz_protocol_keeloq_common_secure_learning(
-                        fix, instance->seed, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 3;
-                        return 1;
-                    }
-
-                    // Check for mirrored man
-                    man = subghz_protocol_keeloq_common_secure_learning(
-                        fix, instance->seed, man_rev);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 3;
-                        return 1;
-                    }
 
-                    // Magic xor type1 learning
-                    man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 4;
-                        return 1;
-                    }
+    if(subghz_protocol_keeloq_learning_cache_check(
+           instance, fix, hop, keystore, mfname, manufacture_name)) {
+        return 1;
+    }
 
-                    // Check for mirrored man
-                    man = subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, man_rev);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 4;
-                        return 1;
-                    }
+    // Keys are decrypted bit-sliced, KEELOQ_BATCH_SIZE at a time, but candidates
+    // are still checked in keystore order, so the first match wins as before
+    KeeloqCandidateBatch* batch = malloc(sizeof(KeeloqCandidateBatch));
+    batch->count = 0;
+    bool found = false;
 
-                    break;
+    for
+        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
+            if(mf_not_set || (strcmp(furi_string_get_cstr(manufacture_code->name), mfname) == 0)) {
+                size_t count = subghz_protocol_keeloq_candidate_count(manufacture_code->type);
+                if(!count) continue;
+                if(batch->count + count > KEELOQ_BATCH_SIZE) {
+                    found = subghz_protocol_keeloq_candidate_batch_check(
+                        batch, instance, fix, hop, keystore, manufacture_name);
+                    if(found) break;
                 }
+                subghz_protocol_keeloq_candidate_expand(batch, manufacture_code, fix);
             }
         }
 
+    if(!found && batch->count) {
+        found = subghz_protocol_keeloq_candidate_batch_check(
+            batch, instance, fix, hop, keystore, manufacture_name);
+    }
+    free(batch);
+
+    if(found) {
+        return 1;
+    }
+
     *manufacture_name = "Unknown";
     keystore->mfname = "Unknown";
     instance->cnt = 0;
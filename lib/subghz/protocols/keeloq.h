@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderKeeloq SubGhzProtocolEncoderKeeloq;
 extern const SubGhzProtocolDecoder subghz_protocol_keeloq_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_keeloq_encoder;
 extern const SubGhzProtocol subghz_protocol_keeloq;
+extern const SubGhzBlockPreamble subghz_protocol_keeloq_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderKeeloq.
@@ -107,6 +108,13 @@ void subghz_protocol_decoder_keeloq_free(void* context);
  */
 void subghz_protocol_decoder_keeloq_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderKeeloq waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderKeeloq instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_keeloq_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderKeeloq instance
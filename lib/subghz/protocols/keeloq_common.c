@@ -35,6 +35,70 @@ inline uint32_t subghz_protocol_keeloq_common_decrypt(const uint32_t data, const
     return x;
 }
 
+/* Algebraic normal form of KEELOQ_NLF for bit-sliced evaluation,
+ * a..e are the inputs with weights 1, 2, 4, 8, 16 in g5() */
+#define keeloq_nlf_sliced(a, b, c, d, e)                                                   \
+    ((a) ^ (b) ^ ((a) & (b)) ^ ((b) & (c)) ^ ((a) & (d)) ^ ((c) & (d)) ^ ((a) & (e)) ^ \
+     ((a) & (b) & (e)) ^ ((c) & (e)) ^ ((a) & (c) & (e)) ^ ((b) & (d) & (e)) ^          \
+     ((c) & (d) & (e)))
+
+/** Simple Learning Decrypt of one block against many keys
+ * Every bit of the cipher state is kept in its own uint32_t, one key per bit (lane),
+ * so one round is evaluated for KEELOQ_BATCH_SIZE keys with a handful of logic ops.
+ * The state register is addressed circularly, so shifting it costs nothing.
+ * @param data - keeloq encrypt data
+ * @param keys - array of manufacture keys (64bit)
+ * @param result - array of count decrypted blocks
+ * @param count - number of keys
+ */
+void subghz_protocol_keeloq_common_decrypt_batch(
+    const uint32_t data,
+    const uint64_t* keys,
+    uint32_t* result,
+    size_t count) {
+    furi_assert(keys);
+    furi_assert(result);
+
+    for(size_t offset = 0; offset < count; offset += KEELOQ_BATCH_SIZE) {
+        size_t lanes = MIN(count - offset, (size_t)KEELOQ_BATCH_SIZE);
+        uint32_t key_slice[64] = {0};
+        uint32_t state[32];
+
+        for(size_t lane = 0; lane < lanes; lane++) {
+            uint64_t key = keys[offset + lane];
+            for(size_t i = 0; i < 64; i++) {
+                key_slice[i] |= (uint32_t)bit(key, i) << lane;
+            }
+        }
+        for(size_t i = 0; i < 32; i++) {
+            state[i] = bit(data, i) ? UINT32_MAX : 0;
+        }
+
+        // state[(head + n) & 31] holds bit n of the register
+        uint32_t head = 0;
+        for(uint32_t r = 0; r < 528; r++) {
+            uint32_t nlf = keeloq_nlf_sliced(
+                state[head & 31],
+                state[(head + 8) & 31],
+                state[(head + 19) & 31],
+                state[(head + 25) & 31],
+                state[(head + 30) & 31]);
+            uint32_t feedback = state[(head + 15) & 31] ^ key_slice[(15 - r) & 63] ^ nlf;
+            // Shift left: old bit 31 slot becomes bit 0
+            head = (head - 1) & 31;
+            state[head] ^= feedback;
+        }
+
+        for(size_t lane = 0; lane < lanes; lane++) {
+            uint32_t x = 0;
+            for(size_t i = 0; i < 32; i++) {
+                x |= bit(state[(head + i) & 31], lane) << i;
+            }
+            result[offset + lane] = x;
+        }
+    }
+}
+
 /** Normal Learning
  * @param data - serial number (28bit)
  * @param key - manufacture (64bit)
@@ -74,6 +138,58 @@ inline uint64_t subghz_protocol_keeloq_common_secure_learning(
     return ((uint64_t)k1 << 32) | k2;
 }
 
+/** Normal Learning for many manufacture keys
+ * @param data - serial number (28bit)
+ * @param keys - array of manufacture keys (64bit)
+ * @param man - array of count manufactures for this serial number (64bit)
+ * @param count - number of keys
+ */
+void subghz_protocol_keeloq_common_normal_learning_batch(
+    uint32_t data,
+    const uint64_t* keys,
+    uint64_t* man,
+    size_t count) {
+    uint32_t k1[KEELOQ_BATCH_SIZE];
+    uint32_t k2[KEELOQ_BATCH_SIZE];
+
+    data &= 0x0FFFFFFF;
+    for(size_t offset = 0; offset < count; offset += KEELOQ_BATCH_SIZE) {
+        size_t lanes = MIN(count - offset, (size_t)KEELOQ_BATCH_SIZE);
+        subghz_protocol_keeloq_common_decrypt_batch(data | 0x20000000, &keys[offset], k1, lanes);
+        subghz_protocol_keeloq_common_decrypt_batch(data | 0x60000000, &keys[offset], k2, lanes);
+        for(size_t i = 0; i < lanes; i++) {
+            man[offset + i] = ((uint64_t)k2[i] << 32) | k1[i];
+        }
+    }
+}
+
+/** Secure Learning for many manufacture keys
+ * @param data - serial number (28bit)
+ * @param seed - seed number (32bit)
+ * @param keys - array of manufacture keys (64bit)
+ * @param man - array of count manufactures for this serial number (64bit)
+ * @param count - number of keys
+ */
+void subghz_protocol_keeloq_common_secure_learning_batch(
+    uint32_t data,
+    uint32_t seed,
+    const uint64_t* keys,
+    uint64_t* man,
+    size_t count) {
+    uint32_t k1[KEELOQ_BATCH_SIZE];
+    uint32_t k2[KEELOQ_BATCH_SIZE];
+
+    data &= 0x0FFFFFFF;
+    for(size_t offset = 0; offset < count; offset += KEELOQ_BATCH_SIZE) {
+        size_t lanes = MIN(count - offset, (size_t)KEELOQ_BATCH_SIZE);
+        subghz_protocol_keeloq_common_decrypt_batch(data, &keys[offset], k1, lanes);
+        subghz_protocol_keeloq_common_decrypt_batch(seed, &keys[offset], k2, lanes);
+        for(size_t i = 0; i < lanes; i++) {
+            man[offset + i] = ((uint64_t)k1[i] << 32) | k2[i];
+        }
+    }
+}
+
 /** Magic_xor_type1 Learning
  * @param data - serial number (28bit)
  * @param xor - magic xor (64bit)
@@ -26,6 +26,12 @@
 #define KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2 7u
 #define KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3 8u
 
+/*
+ * Number of keys processed in parallel by the bit-sliced batch functions,
+ * one key per bit of a uint32_t
+ */
+#define KEELOQ_BATCH_SIZE 32u
+
 /**
  * Simple Learning Encrypt
  * @param data - 0xBSSSCCCC, B(4bit) key, S(10bit) serial&0x3FF, C(16bit) counter
@@ -42,6 +48,21 @@ uint32_t subghz_protocol_keeloq_common_encrypt(const uint32_t data, const uint64
  */
 uint32_t subghz_protocol_keeloq_common_decrypt(const uint32_t data, const uint64_t key);
 
+/** 
+ * Simple Learning Decrypt of one block against many keys
+ * Keys are bit-sliced and processed KEELOQ_BATCH_SIZE at a time,
+ * result[i] is equal to subghz_protocol_keeloq_common_decrypt(data, keys[i])
+ * @param data - keeloq encrypt data
+ * @param keys - array of manufacture keys (64bit)
+ * @param result - array of count decrypted blocks
+ * @param count - number of keys
+ */
+void subghz_protocol_keeloq_common_decrypt_batch(
+    const uint32_t data,
+    const uint64_t* keys,
+    uint32_t* result,
+    size_t count);
+
 /** 
  * Normal Learning
  * @param data - serial number (28bit)
@@ -60,6 +81,36 @@ uint64_t subghz_protocol_keeloq_common_normal_learning(uint32_t data, const uint
 uint64_t
     subghz_protocol_keeloq_common_secure_learning(uint32_t data, uint32_t seed, const uint64_t key);
 
+/** 
+ * Normal Learning for many manufacture keys
+ * man[i] is equal to subghz_protocol_keeloq_common_normal_learning(data, keys[i])
+ * @param data - serial number (28bit)
+ * @param keys - array of manufacture keys (64bit)
+ * @param man - array of count manufactures for this serial number (64bit)
+ * @param count - number of keys
+ */
+void subghz_protocol_keeloq_common_normal_learning_batch(
+    uint32_t data,
+    const uint64_t* keys,
+    uint64_t* man,
+    size_t count);
+
+/** 
+ * Secure Learning for many manufacture keys
+ * man[i] is equal to subghz_protocol_keeloq_common_secure_learning(data, seed, keys[i])
+ * @param data - serial number (28bit)
+ * @param seed - seed number (32bit)
+ * @param keys - array of manufacture keys (64bit)
+ * @param man - array of count manufactures for this serial number (64bit)
+ * @param count - number of keys
+ */
+void subghz_protocol_keeloq_common_secure_learning_batch(
+    uint32_t data,
+    uint32_t seed,
+    const uint64_t* keys,
+    uint64_t* man,
+    size_t count);
+
 /** 
  * Magic_xor_type1 Learning
  * @param data - serial number (28bit)
@@ -15,6 +15,13 @@ static const SubGhzBlockConst subghz_protocol_kia_const = {
     .min_count_bit_for_found = 61,
 };
 
+const SubGhzBlockPreamble subghz_protocol_kia_preamble = {
+    .timing = &subghz_protocol_kia_const,
+    .level = true,
+    .te_short_count = 1,
+    .te_delta_count = 1,
+};
+
 struct SubGhzProtocolDecoderKIA {
     SubGhzProtocolDecoderBase base;
 
@@ -44,6 +51,7 @@ const SubGhzProtocolDecoder subghz_protocol_kia_decoder = {
 
     .feed = subghz_protocol_decoder_kia_feed,
     .reset = subghz_protocol_decoder_kia_reset,
+    .is_idle = subghz_protocol_decoder_kia_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_kia_get_hash_data,
     .serialize = subghz_protocol_decoder_kia_serialize,
@@ -190,6 +198,12 @@ void subghz_protocol_decoder_kia_feed(void* context, bool level, uint32_t durati
     }
 }
 
+bool subghz_protocol_decoder_kia_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderKIA* instance = context;
+    return instance->decoder.parser_step == KIADecoderStepReset;
+}
+
 uint8_t subghz_protocol_kia_crc8(uint8_t* data, size_t len) {
     uint8_t crc = 0x08;
     size_t i, j;
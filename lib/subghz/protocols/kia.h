@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderKIA SubGhzProtocolEncoderKIA;
 extern const SubGhzProtocolDecoder subghz_protocol_kia_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_kia_encoder;
 extern const SubGhzProtocol subghz_protocol_kia;
+extern const SubGhzBlockPreamble subghz_protocol_kia_preamble;
 
 /**
  * Allocate SubGhzProtocolDecoderKIA.
@@ -30,6 +31,13 @@ void subghz_protocol_decoder_kia_free(void* context);
  */
 void subghz_protocol_decoder_kia_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderKIA waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderKIA instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_kia_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderKIA instance
@@ -17,6 +17,13 @@ static const SubGhzBlockConst subghz_protocol_kinggates_stylo_4k_const = {
     .min_count_bit_for_found = 89,
 };
 
+const SubGhzBlockPreamble subghz_protocol_kinggates_stylo_4k_preamble = {
+    .timing = &subghz_protocol_kinggates_stylo_4k_const,
+    .level = true,
+    .te_short_count = 1,
+    .te_delta_count = 1,
+};
+
 struct SubGhzProtocolDecoderKingGates_stylo_4k {
     SubGhzProtocolDecoderBase base;
 
@@ -49,6 +56,7 @@ const SubGhzProtocolDecoder subghz_protocol_kinggates_stylo_4k_decoder = {
 
     .feed = subghz_protocol_decoder_kinggates_stylo_4k_feed,
     .reset = subghz_protocol_decoder_kinggates_stylo_4k_reset,
+    .is_idle = subghz_protocol_decoder_kinggates_stylo_4k_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_kinggates_stylo_4k_get_hash_data,
     .serialize = subghz_protocol_decoder_kinggates_stylo_4k_serialize,
@@ -444,6 +452,12 @@ void subghz_protocol_decoder_kinggates_stylo_4k_feed(void* context, bool level,
     }
 }
 
+bool subghz_protocol_decoder_kinggates_stylo_4k_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderKingGates_stylo_4k* instance = context;
+    return instance->decoder.parser_step == KingGates_stylo_4kDecoderStepReset;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
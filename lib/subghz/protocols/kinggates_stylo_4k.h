@@ -9,6 +9,7 @@ typedef struct SubGhzProtocolEncoderKingGates_stylo_4k SubGhzProtocolEncoderKing
 extern const SubGhzProtocolDecoder subghz_protocol_kinggates_stylo_4k_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_kinggates_stylo_4k_encoder;
 extern const SubGhzProtocol subghz_protocol_kinggates_stylo_4k;
+extern const SubGhzBlockPreamble subghz_protocol_kinggates_stylo_4k_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderKingGates_stylo_4k.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_kinggates_stylo_4k_free(void* context);
  */
 void subghz_protocol_decoder_kinggates_stylo_4k_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderKingGates_stylo_4k waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderKingGates_stylo_4k instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_kinggates_stylo_4k_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderKingGates_stylo_4k instance
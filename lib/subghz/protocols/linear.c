@@ -22,6 +22,13 @@ static const SubGhzBlockConst subghz_protocol_linear_const = {
     .min_count_bit_for_found = 10,
 };
 
+const SubGhzBlockPreamble subghz_protocol_linear_preamble = {
+    .timing = &subghz_protocol_linear_const,
+    .level = false,
+    .te_short_count = 42,
+    .te_delta_count = 20,
+};
+
 struct SubGhzProtocolDecoderLinear {
     SubGhzProtocolDecoderBase base;
 
@@ -48,6 +55,7 @@ const SubGhzProtocolDecoder subghz_protocol_linear_decoder = {
 
     .feed = subghz_protocol_decoder_linear_feed,
     .reset = subghz_protocol_decoder_linear_reset,
+    .is_idle = subghz_protocol_decoder_linear_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_linear_get_hash_data,
     .serialize = subghz_protocol_decoder_linear_serialize,
@@ -293,6 +301,12 @@ void subghz_protocol_decoder_linear_feed(void* context, bool level, uint32_t dur
     }
 }
 
+bool subghz_protocol_decoder_linear_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderLinear* instance = context;
+    return instance->decoder.parser_step == LinearDecoderStepReset;
+}
+
 uint8_t subghz_protocol_decoder_linear_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderLinear* instance = context;
@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderLinear SubGhzProtocolEncoderLinear;
 extern const SubGhzProtocolDecoder subghz_protocol_linear_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_linear_encoder;
 extern const SubGhzProtocol subghz_protocol_linear;
+extern const SubGhzBlockPreamble subghz_protocol_linear_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderLinear.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_linear_free(void* context);
  */
 void subghz_protocol_decoder_linear_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderLinear waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderLinear instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_linear_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderLinear instance
@@ -21,6 +21,13 @@ static const SubGhzBlockConst subghz_protocol_linear_delta3_const = {
     .min_count_bit_for_found = 8,
 };
 
+const SubGhzBlockPreamble subghz_protocol_linear_delta3_preamble = {
+    .timing = &subghz_protocol_linear_delta3_const,
+    .level = false,
+    .te_short_count = 70,
+    .te_delta_count = 24,
+};
+
 struct SubGhzProtocolDecoderLinearDelta3 {
     SubGhzProtocolDecoderBase base;
 
@@ -49,6 +56,7 @@ const SubGhzProtocolDecoder subghz_protocol_linear_delta3_decoder = {
 
     .feed = subghz_protocol_decoder_linear_delta3_feed,
     .reset = subghz_protocol_decoder_linear_delta3_reset,
+    .is_idle = subghz_protocol_decoder_linear_delta3_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_linear_delta3_get_hash_data,
     .serialize = subghz_protocol_decoder_linear_delta3_serialize,
@@ -223,6 +231,12 @@ void subghz_protocol_decoder_linear_delta3_reset(void* context) {
     instance->last_data = 0;
 }
 
+bool subghz_protocol_decoder_linear_delta3_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderLinearDelta3* instance = context;
+    return instance->decoder.parser_step == LinearDecoderStepReset;
+}
+
 void subghz_protocol_decoder_linear_delta3_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderLinearDelta3* instance = context;
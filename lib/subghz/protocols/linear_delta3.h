@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderLinearDelta3 SubGhzProtocolEncoderLinearDelt
 extern const SubGhzProtocolDecoder subghz_protocol_linear_delta3_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_linear_delta3_encoder;
 extern const SubGhzProtocol subghz_protocol_linear_delta3;
+extern const SubGhzBlockPreamble subghz_protocol_linear_delta3_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderLinearDelta3.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_linear_delta3_free(void* context);
  */
 void subghz_protocol_decoder_linear_delta3_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderLinearDelta3 waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderLinearDelta3 instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_linear_delta3_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderLinearDelta3 instance
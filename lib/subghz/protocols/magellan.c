@@ -15,6 +15,13 @@ static const SubGhzBlockConst subghz_protocol_magellan_const = {
     .min_count_bit_for_found = 32,
 };
 
+const SubGhzBlockPreamble subghz_protocol_magellan_preamble = {
+    .timing = &subghz_protocol_magellan_const,
+    .level = true,
+    .te_short_count = 1,
+    .te_delta_count = 1,
+};
+
 struct SubGhzProtocolDecoderMagellan {
     SubGhzProtocolDecoderBase base;
 
@@ -44,6 +51,7 @@ const SubGhzProtocolDecoder subghz_protocol_magellan_decoder = {
 
     .feed = subghz_protocol_decoder_magellan_feed,
     .reset = subghz_protocol_decoder_magellan_reset,
+    .is_idle = subghz_protocol_decoder_magellan_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_magellan_get_hash_data,
     .serialize = subghz_protocol_decoder_magellan_serialize,
@@ -236,6 +244,12 @@ uint8_t subghz_protocol_magellan_crc8(uint8_t* data, size_t len) {
     return crc;
 }
 
+bool subghz_protocol_decoder_magellan_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderMagellan* instance = context;
+    return instance->decoder.parser_step == MagellanDecoderStepReset;
+}
+
 static bool subghz_protocol_magellan_check_crc(SubGhzProtocolDecoderMagellan* instance) {
     uint8_t data[3] = {
         instance->decoder.decode_data >> 24,
@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderMagellan SubGhzProtocolEncoderMagellan;
 extern const SubGhzProtocolDecoder subghz_protocol_magellan_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_magellan_encoder;
 extern const SubGhzProtocol subghz_protocol_magellan;
+extern const SubGhzBlockPreamble subghz_protocol_magellan_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderMagellan.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_magellan_free(void* context);
  */
 void subghz_protocol_decoder_magellan_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderMagellan waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderMagellan instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_magellan_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderMagellan instance
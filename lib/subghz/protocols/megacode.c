@@ -26,6 +26,13 @@ static const SubGhzBlockConst subghz_protocol_megacode_const = {
     .min_count_bit_for_found = 24,
 };
 
+const SubGhzBlockPreamble subghz_protocol_megacode_preamble = {
+    .timing = &subghz_protocol_megacode_const,
+    .level = false,
+    .te_short_count = 13,
+    .te_delta_count = 17,
+};
+
 struct SubGhzProtocolDecoderMegaCode {
     SubGhzProtocolDecoderBase base;
 
@@ -54,6 +61,7 @@ const SubGhzProtocolDecoder subghz_protocol_megacode_decoder = {
 
     .feed = subghz_protocol_decoder_megacode_feed,
     .reset = subghz_protocol_decoder_megacode_reset,
+    .is_idle = subghz_protocol_decoder_megacode_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_megacode_get_hash_data,
     .serialize = subghz_protocol_decoder_megacode_serialize,
@@ -323,6 +331,12 @@ void subghz_protocol_decoder_megacode_feed(void* context, bool level, uint32_t d
     }
 }
 
+bool subghz_protocol_decoder_megacode_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderMegaCode* instance = context;
+    return instance->decoder.parser_step == MegaCodeDecoderStepReset;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
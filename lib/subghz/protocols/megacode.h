@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderMegaCode SubGhzProtocolEncoderMegaCode;
 extern const SubGhzProtocolDecoder subghz_protocol_megacode_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_megacode_encoder;
 extern const SubGhzProtocol subghz_protocol_megacode;
+extern const SubGhzBlockPreamble subghz_protocol_megacode_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderMegaCode.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_megacode_free(void* context);
  */
 void subghz_protocol_decoder_megacode_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderMegaCode waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderMegaCode instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_megacode_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderMegaCode instance
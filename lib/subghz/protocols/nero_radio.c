@@ -15,6 +15,13 @@ static const SubGhzBlockConst subghz_protocol_nero_radio_const = {
     .min_count_bit_for_found = 56,
 };
 
+const SubGhzBlockPreamble subghz_protocol_nero_radio_preamble = {
+    .timing = &subghz_protocol_nero_radio_const,
+    .level = true,
+    .te_short_count = 1,
+    .te_delta_count = 1,
+};
+
 struct SubGhzProtocolDecoderNeroRadio {
     SubGhzProtocolDecoderBase base;
 
@@ -44,6 +51,7 @@ const SubGhzProtocolDecoder subghz_protocol_nero_radio_decoder = {
 
     .feed = subghz_protocol_decoder_nero_radio_feed,
     .reset = subghz_protocol_decoder_nero_radio_reset,
+    .is_idle = subghz_protocol_decoder_nero_radio_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_nero_radio_get_hash_data,
     .serialize = subghz_protocol_decoder_nero_radio_serialize,
@@ -350,6 +358,12 @@ void subghz_protocol_decoder_nero_radio_feed(void* context, bool level, uint32_t
     }
 }
 
+bool subghz_protocol_decoder_nero_radio_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNeroRadio* instance = context;
+    return instance->decoder.parser_step == NeroRadioDecoderStepReset;
+}
+
 uint8_t subghz_protocol_decoder_nero_radio_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderNeroRadio* instance = context;
@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderNeroRadio SubGhzProtocolEncoderNeroRadio;
 extern const SubGhzProtocolDecoder subghz_protocol_nero_radio_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_nero_radio_encoder;
 extern const SubGhzProtocol subghz_protocol_nero_radio;
+extern const SubGhzBlockPreamble subghz_protocol_nero_radio_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderNeroRadio.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_nero_radio_free(void* context);
  */
 void subghz_protocol_decoder_nero_radio_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderNeroRadio waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderNeroRadio instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_nero_radio_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderNeroRadio instance
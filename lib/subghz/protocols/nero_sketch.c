@@ -15,6 +15,13 @@ static const SubGhzBlockConst subghz_protocol_nero_sketch_const = {
     .min_count_bit_for_found = 40,
 };
 
+const SubGhzBlockPreamble subghz_protocol_nero_sketch_preamble = {
+    .timing = &subghz_protocol_nero_sketch_const,
+    .level = true,
+    .te_short_count = 1,
+    .te_delta_count = 1,
+};
+
 struct SubGhzProtocolDecoderNeroSketch {
     SubGhzProtocolDecoderBase base;
 
@@ -43,6 +50,7 @@ const SubGhzProtocolDecoder subghz_protocol_nero_sketch_decoder = {
 
     .feed = subghz_protocol_decoder_nero_sketch_feed,
     .reset = subghz_protocol_decoder_nero_sketch_reset,
+    .is_idle = subghz_protocol_decoder_nero_sketch_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_nero_sketch_get_hash_data,
     .serialize = subghz_protocol_decoder_nero_sketch_serialize,
@@ -321,6 +329,12 @@ void subghz_protocol_decoder_nero_sketch_feed(void* context, bool level, uint32_
     }
 }
 
+bool subghz_protocol_decoder_nero_sketch_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNeroSketch* instance = context;
+    return instance->decoder.parser_step == NeroSketchDecoderStepReset;
+}
+
 uint8_t subghz_protocol_decoder_nero_sketch_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderNeroSketch* instance = context;
@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderNeroSketch SubGhzProtocolEncoderNeroSketch;
 extern const SubGhzProtocolDecoder subghz_protocol_nero_sketch_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_nero_sketch_encoder;
 extern const SubGhzProtocol subghz_protocol_nero_sketch;
+extern const SubGhzBlockPreamble subghz_protocol_nero_sketch_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderNeroSketch.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_nero_sketch_free(void* context);
  */
 void subghz_protocol_decoder_nero_sketch_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderNeroSketch waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderNeroSketch instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_nero_sketch_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderNeroSketch instance
@@ -14,6 +14,13 @@ static const SubGhzBlockConst subghz_protocol_nice_flo_const = {
     .min_count_bit_for_found = 12,
 };
 
+const SubGhzBlockPreamble subghz_protocol_nice_flo_preamble = {
+    .timing = &subghz_protocol_nice_flo_const,
+    .level = false,
+    .te_short_count = 36,
+    .te_delta_count = 36,
+};
+
 struct SubGhzProtocolDecoderNiceFlo {
     SubGhzProtocolDecoderBase base;
 
@@ -41,6 +48,7 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flo_decoder = {
 
     .feed = subghz_protocol_decoder_nice_flo_feed,
     .reset = subghz_protocol_decoder_nice_flo_reset,
+    .is_idle = subghz_protocol_decoder_nice_flo_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_nice_flo_get_hash_data,
     .serialize = subghz_protocol_decoder_nice_flo_serialize,
@@ -276,6 +284,12 @@ void subghz_protocol_decoder_nice_flo_feed(void* context, bool level, uint32_t d
     }
 }
 
+bool subghz_protocol_decoder_nice_flo_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNiceFlo* instance = context;
+    return instance->decoder.parser_step == NiceFloDecoderStepReset;
+}
+
 uint8_t subghz_protocol_decoder_nice_flo_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderNiceFlo* instance = context;
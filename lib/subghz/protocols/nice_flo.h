@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderNiceFlo SubGhzProtocolEncoderNiceFlo;
 extern const SubGhzProtocolDecoder subghz_protocol_nice_flo_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_nice_flo_encoder;
 extern const SubGhzProtocol subghz_protocol_nice_flo;
+extern const SubGhzBlockPreamble subghz_protocol_nice_flo_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderNiceFlo.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_nice_flo_free(void* context);
  */
 void subghz_protocol_decoder_nice_flo_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderNiceFlo waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderNiceFlo instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_nice_flo_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderNiceFlo instance
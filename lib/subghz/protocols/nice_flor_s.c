@@ -26,6 +26,13 @@ static const SubGhzBlockConst subghz_protocol_nice_flor_s_const = {
     .min_count_bit_for_found = 52,
 };
 
+const SubGhzBlockPreamble subghz_protocol_nice_flor_s_preamble = {
+    .timing = &subghz_protocol_nice_flor_s_const,
+    .level = false,
+    .te_short_count = 38,
+    .te_delta_count = 38,
+};
+
 struct SubGhzProtocolDecoderNiceFlorS {
     SubGhzProtocolDecoderBase base;
 
@@ -59,6 +66,7 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flor_s_decoder = {
 
     .feed = subghz_protocol_decoder_nice_flor_s_feed,
     .reset = subghz_protocol_decoder_nice_flor_s_reset,
+    .is_idle = subghz_protocol_decoder_nice_flor_s_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_nice_flor_s_get_hash_data,
     .serialize = subghz_protocol_decoder_nice_flor_s_serialize,
@@ -624,6 +632,12 @@ void subghz_protocol_decoder_nice_flor_s_feed(void* context, bool level, uint32_
     }
 }
 
+bool subghz_protocol_decoder_nice_flor_s_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNiceFlorS* instance = context;
+    return instance->decoder.parser_step == NiceFlorSDecoderStepReset;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
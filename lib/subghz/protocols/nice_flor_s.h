@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderNiceFlorS SubGhzProtocolEncoderNiceFlorS;
 extern const SubGhzProtocolDecoder subghz_protocol_nice_flor_s_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_nice_flor_s_encoder;
 extern const SubGhzProtocol subghz_protocol_nice_flor_s;
+extern const SubGhzBlockPreamble subghz_protocol_nice_flor_s_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderNiceFlorS.
@@ -87,6 +88,13 @@ void subghz_protocol_decoder_nice_flor_s_free(void* context);
  */
 void subghz_protocol_decoder_nice_flor_s_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderNiceFlorS waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderNiceFlorS instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_nice_flor_s_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderNiceFlorS instance
@@ -17,6 +17,13 @@ static const SubGhzBlockConst subghz_protocol_phoenix_v2_const = {
     .min_count_bit_for_found = 52,
 };
 
+const SubGhzBlockPreamble subghz_protocol_phoenix_v2_preamble = {
+    .timing = &subghz_protocol_phoenix_v2_const,
+    .level = false,
+    .te_short_count = 60,
+    .te_delta_count = 30,
+};
+
 struct SubGhzProtocolDecoderPhoenix_V2 {
     SubGhzProtocolDecoderBase base;
 
@@ -44,6 +51,7 @@ const SubGhzProtocolDecoder subghz_protocol_phoenix_v2_decoder = {
 
     .feed = subghz_protocol_decoder_phoenix_v2_feed,
     .reset = subghz_protocol_decoder_phoenix_v2_reset,
+    .is_idle = subghz_protocol_decoder_phoenix_v2_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_phoenix_v2_get_hash_data,
     .serialize = subghz_protocol_decoder_phoenix_v2_serialize,
@@ -274,6 +282,12 @@ void subghz_protocol_decoder_phoenix_v2_feed(void* context, bool level, uint32_t
     }
 }
 
+bool subghz_protocol_decoder_phoenix_v2_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPhoenix_V2* instance = context;
+    return instance->decoder.parser_step == Phoenix_V2DecoderStepReset;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderPhoenix_V2 SubGhzProtocolEncoderPhoenix_V2;
 extern const SubGhzProtocolDecoder subghz_protocol_phoenix_v2_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_phoenix_v2_encoder;
 extern const SubGhzProtocol subghz_protocol_phoenix_v2;
+extern const SubGhzBlockPreamble subghz_protocol_phoenix_v2_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderPhoenix_V2.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_phoenix_v2_free(void* context);
  */
 void subghz_protocol_decoder_phoenix_v2_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderPhoenix_V2 waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderPhoenix_V2 instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_phoenix_v2_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderPhoenix_V2 instance
@@ -21,6 +21,13 @@ static const SubGhzBlockConst subghz_protocol_princeton_const = {
     .min_count_bit_for_found = 24,
 };
 
+const SubGhzBlockPreamble subghz_protocol_princeton_preamble = {
+    .timing = &subghz_protocol_princeton_const,
+    .level = false,
+    .te_short_count = 36,
+    .te_delta_count = 36,
+};
+
 struct SubGhzProtocolDecoderPrinceton {
     SubGhzProtocolDecoderBase base;
 
@@ -52,6 +59,7 @@ const SubGhzProtocolDecoder subghz_protocol_princeton_decoder = {
 
     .feed = subghz_protocol_decoder_princeton_feed,
     .reset = subghz_protocol_decoder_princeton_reset,
+    .is_idle = subghz_protocol_decoder_princeton_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_princeton_get_hash_data,
     .serialize = subghz_protocol_decoder_princeton_serialize,
@@ -222,6 +230,12 @@ void subghz_protocol_decoder_princeton_reset(void* context) {
     instance->last_data = 0;
 }
 
+bool subghz_protocol_decoder_princeton_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPrinceton* instance = context;
+    return instance->decoder.parser_step == PrincetonDecoderStepReset;
+}
+
 void subghz_protocol_decoder_princeton_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderPrinceton* instance = context;
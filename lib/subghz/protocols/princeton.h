@@ -14,6 +14,7 @@ typedef struct SubGhzProtocolEncoderPrinceton SubGhzProtocolEncoderPrinceton;
 extern const SubGhzProtocolDecoder subghz_protocol_princeton_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_princeton_encoder;
 extern const SubGhzProtocol subghz_protocol_princeton;
+extern const SubGhzBlockPreamble subghz_protocol_princeton_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderPrinceton.
@@ -69,6 +70,13 @@ void subghz_protocol_decoder_princeton_free(void* context);
  */
 void subghz_protocol_decoder_princeton_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderPrinceton waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderPrinceton instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_princeton_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderPrinceton instance
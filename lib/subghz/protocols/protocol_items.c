@@ -48,3 +48,55 @@ const SubGhzProtocol* subghz_protocol_registry_items[] = {
 const SubGhzProtocolRegistry subghz_protocol_registry = {
     .items = subghz_protocol_registry_items,
     .size = COUNT_OF(subghz_protocol_registry_items)};
+
+typedef struct {
+    const SubGhzProtocol* protocol;
+    const SubGhzBlockPreamble* preamble;
+} SubGhzProtocolPreambleItem;
+
+static const SubGhzProtocolPreambleItem subghz_protocol_preamble_items[] = {
+    {&subghz_protocol_alutech_at_4n, &subghz_protocol_alutech_at_4n_preamble},
+    {&subghz_protocol_ansonic, &subghz_protocol_ansonic_preamble},
+    {&subghz_protocol_bett, &subghz_protocol_bett_preamble},
+    {&subghz_protocol_came, &subghz_protocol_came_preamble},
+    {&subghz_protocol_came_atomo, &subghz_protocol_came_atomo_preamble},
+    {&subghz_protocol_came_twee, &subghz_protocol_came_twee_preamble},
+    {&subghz_protocol_chamb_code, &subghz_protocol_chamb_code_preamble},
+    {&subghz_protocol_clemsa, &subghz_protocol_clemsa_preamble},
+    {&subghz_protocol_doitrand, &subghz_protocol_doitrand_preamble},
+    {&subghz_protocol_dooya, &subghz_protocol_dooya_preamble},
+    {&subghz_protocol_faac_slh, &subghz_protocol_faac_slh_preamble},
+    {&subghz_protocol_gate_tx, &subghz_protocol_gate_tx_preamble},
+    {&subghz_protocol_holtek, &subghz_protocol_holtek_preamble},
+    {&subghz_protocol_holtek_th12x, &subghz_protocol_holtek_th12x_preamble},
+    {&subghz_protocol_honeywell_wdb, &subghz_protocol_honeywell_wdb_preamble},
+    {&subghz_protocol_hormann, &subghz_protocol_hormann_preamble},
+    {&subghz_protocol_ido, &subghz_protocol_ido_preamble},
+    {&subghz_protocol_intertechno_v3, &subghz_protocol_intertechno_v3_preamble},
+    {&subghz_protocol_keeloq, &subghz_protocol_keeloq_preamble},
+    {&subghz_protocol_kia, &subghz_protocol_kia_preamble},
+    {&subghz_protocol_kinggates_stylo_4k, &subghz_protocol_kinggates_stylo_4k_preamble},
+    {&subghz_protocol_linear, &subghz_protocol_linear_preamble},
+    {&subghz_protocol_linear_delta3, &subghz_protocol_linear_delta3_preamble},
+    {&subghz_protocol_magellan, &subghz_protocol_magellan_preamble},
+    {&subghz_protocol_megacode, &subghz_protocol_megacode_preamble},
+    {&subghz_protocol_nero_radio, &subghz_protocol_nero_radio_preamble},
+    {&subghz_protocol_nero_sketch, &subghz_protocol_nero_sketch_preamble},
+    {&subghz_protocol_nice_flo, &subghz_protocol_nice_flo_preamble},
+    {&subghz_protocol_nice_flor_s, &subghz_protocol_nice_flor_s_preamble},
+    {&subghz_protocol_phoenix_v2, &subghz_protocol_phoenix_v2_preamble},
+    {&subghz_protocol_princeton, &subghz_protocol_princeton_preamble},
+    {&subghz_protocol_scher_khan, &subghz_protocol_scher_khan_preamble},
+    {&subghz_protocol_smc5326, &subghz_protocol_smc5326_preamble},
+    {&subghz_protocol_somfy_keytis, &subghz_protocol_somfy_keytis_preamble},
+    {&subghz_protocol_somfy_telis, &subghz_protocol_somfy_telis_preamble},
+};
+
+const SubGhzBlockPreamble* subghz_protocol_registry_get_preamble(const SubGhzProtocol* protocol) {
+    for(size_t i = 0; i < COUNT_OF(subghz_protocol_preamble_items); i++) {
+        if(subghz_protocol_preamble_items[i].protocol == protocol) {
+            return subghz_protocol_preamble_items[i].preamble;
+        }
+    }
+    return NULL;
+}
@@ -44,3 +44,10 @@
 #include "alutech_at_4n.h"
 #include "kinggates_stylo_4k.h"
 #include "bin_raw.h"
+
+/**
+ * Get the pulse a built-in decoder waits for in its reset step.
+ * @param protocol Pointer to a SubGhzProtocol instance
+ * @return SubGhzBlockPreamble* or NULL if the decoder must see every pulse
+ */
+const SubGhzBlockPreamble* subghz_protocol_registry_get_preamble(const SubGhzProtocol* protocol);
@@ -20,6 +20,13 @@ static const SubGhzBlockConst subghz_protocol_scher_khan_const = {
     .min_count_bit_for_found = 35,
 };
 
+const SubGhzBlockPreamble subghz_protocol_scher_khan_preamble = {
+    .timing = &subghz_protocol_scher_khan_const,
+    .level = true,
+    .te_short_count = 2,
+    .te_delta_count = 1,
+};
+
 struct SubGhzProtocolDecoderScherKhan {
     SubGhzProtocolDecoderBase base;
 
@@ -50,6 +57,7 @@ const SubGhzProtocolDecoder subghz_protocol_scher_khan_decoder = {
 
     .feed = subghz_protocol_decoder_scher_khan_feed,
     .reset = subghz_protocol_decoder_scher_khan_reset,
+    .is_idle = subghz_protocol_decoder_scher_khan_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_scher_khan_get_hash_data,
     .serialize = subghz_protocol_decoder_scher_khan_serialize,
@@ -202,6 +210,12 @@ void subghz_protocol_decoder_scher_khan_feed(void* context, bool level, uint32_t
     }
 }
 
+bool subghz_protocol_decoder_scher_khan_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderScherKhan* instance = context;
+    return instance->decoder.parser_step == ScherKhanDecoderStepReset;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderScherKhan SubGhzProtocolEncoderScherKhan;
 extern const SubGhzProtocolDecoder subghz_protocol_scher_khan_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_scher_khan_encoder;
 extern const SubGhzProtocol subghz_protocol_scher_khan;
+extern const SubGhzBlockPreamble subghz_protocol_scher_khan_preamble;
 
 /**
  * Allocate SubGhzProtocolDecoderScherKhan.
@@ -30,6 +31,13 @@ void subghz_protocol_decoder_scher_khan_free(void* context);
  */
 void subghz_protocol_decoder_scher_khan_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderScherKhan waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderScherKhan instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_scher_khan_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderScherKhan instance
@@ -36,6 +36,13 @@ static const SubGhzBlockConst subghz_protocol_smc5326_const = {
     .min_count_bit_for_found = 25,
 };
 
+const SubGhzBlockPreamble subghz_protocol_smc5326_preamble = {
+    .timing = &subghz_protocol_smc5326_const,
+    .level = false,
+    .te_short_count = 24,
+    .te_delta_count = 12,
+};
+
 struct SubGhzProtocolDecoderSMC5326 {
     SubGhzProtocolDecoderBase base;
 
@@ -67,6 +74,7 @@ const SubGhzProtocolDecoder subghz_protocol_smc5326_decoder = {
 
     .feed = subghz_protocol_decoder_smc5326_feed,
     .reset = subghz_protocol_decoder_smc5326_reset,
+    .is_idle = subghz_protocol_decoder_smc5326_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_smc5326_get_hash_data,
     .serialize = subghz_protocol_decoder_smc5326_serialize,
@@ -236,6 +244,12 @@ void subghz_protocol_decoder_smc5326_reset(void* context) {
     instance->last_data = 0;
 }
 
+bool subghz_protocol_decoder_smc5326_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSMC5326* instance = context;
+    return instance->decoder.parser_step == SMC5326DecoderStepReset;
+}
+
 void subghz_protocol_decoder_smc5326_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderSMC5326* instance = context;
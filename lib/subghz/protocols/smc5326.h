@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderSMC5326 SubGhzProtocolEncoderSMC5326;
 extern const SubGhzProtocolDecoder subghz_protocol_smc5326_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_smc5326_encoder;
 extern const SubGhzProtocol subghz_protocol_smc5326;
+extern const SubGhzBlockPreamble subghz_protocol_smc5326_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderSMC5326.
@@ -65,6 +66,13 @@ void subghz_protocol_decoder_smc5326_free(void* context);
  */
 void subghz_protocol_decoder_smc5326_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderSMC5326 waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderSMC5326 instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_smc5326_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderSMC5326 instance
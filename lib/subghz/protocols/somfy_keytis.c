@@ -16,6 +16,13 @@ static const SubGhzBlockConst subghz_protocol_somfy_keytis_const = {
     .min_count_bit_for_found = 80,
 };
 
+const SubGhzBlockPreamble subghz_protocol_somfy_keytis_preamble = {
+    .timing = &subghz_protocol_somfy_keytis_const,
+    .level = true,
+    .te_short_count = 4,
+    .te_delta_count = 4,
+};
+
 struct SubGhzProtocolDecoderSomfyKeytis {
     SubGhzProtocolDecoderBase base;
 
@@ -48,6 +55,7 @@ const SubGhzProtocolDecoder subghz_protocol_somfy_keytis_decoder = {
 
     .feed = subghz_protocol_decoder_somfy_keytis_feed,
     .reset = subghz_protocol_decoder_somfy_keytis_reset,
+    .is_idle = subghz_protocol_decoder_somfy_keytis_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_somfy_keytis_get_hash_data,
     .serialize = subghz_protocol_decoder_somfy_keytis_serialize,
@@ -122,6 +130,12 @@ void subghz_protocol_decoder_somfy_keytis_reset(void* context) {
         NULL);
 }
 
+bool subghz_protocol_decoder_somfy_keytis_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSomfyKeytis* instance = context;
+    return instance->decoder.parser_step == SomfyKeytisDecoderStepReset;
+}
+
 static bool
     subghz_protocol_somfy_keytis_gen_data(SubGhzProtocolEncoderSomfyKeytis* instance, uint8_t btn) {
     UNUSED(btn);
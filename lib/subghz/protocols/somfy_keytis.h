@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderSomfyKeytis SubGhzProtocolEncoderSomfyKeytis
 extern const SubGhzProtocolDecoder subghz_protocol_somfy_keytis_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_somfy_keytis_encoder;
 extern const SubGhzProtocol subghz_protocol_somfy_keytis;
+extern const SubGhzBlockPreamble subghz_protocol_somfy_keytis_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderSomfyKeytis.
@@ -83,6 +84,13 @@ void subghz_protocol_decoder_somfy_keytis_free(void* context);
  */
 void subghz_protocol_decoder_somfy_keytis_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderSomfyKeytis waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderSomfyKeytis instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_somfy_keytis_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderSomfyKeytis instance
@@ -18,6 +18,13 @@ static const SubGhzBlockConst subghz_protocol_somfy_telis_const = {
     .min_count_bit_for_found = 56,
 };
 
+const SubGhzBlockPreamble subghz_protocol_somfy_telis_preamble = {
+    .timing = &subghz_protocol_somfy_telis_const,
+    .level = true,
+    .te_short_count = 4,
+    .te_delta_count = 4,
+};
+
 struct SubGhzProtocolDecoderSomfyTelis {
     SubGhzProtocolDecoderBase base;
 
@@ -49,6 +56,7 @@ const SubGhzProtocolDecoder subghz_protocol_somfy_telis_decoder = {
 
     .feed = subghz_protocol_decoder_somfy_telis_feed,
     .reset = subghz_protocol_decoder_somfy_telis_reset,
+    .is_idle = subghz_protocol_decoder_somfy_telis_is_idle,
 
     .get_hash_data = subghz_protocol_decoder_somfy_telis_get_hash_data,
     .serialize = subghz_protocol_decoder_somfy_telis_serialize,
@@ -406,6 +414,12 @@ void subghz_protocol_decoder_somfy_telis_reset(void* context) {
         NULL);
 }
 
+bool subghz_protocol_decoder_somfy_telis_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSomfyTelis* instance = context;
+    return instance->decoder.parser_step == SomfyTelisDecoderStepReset;
+}
+
 /** 
  * Сhecksum calculation.
  * @param data Вata for checksum calculation
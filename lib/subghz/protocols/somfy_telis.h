@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderSomfyTelis SubGhzProtocolEncoderSomfyTelis;
 extern const SubGhzProtocolDecoder subghz_protocol_somfy_telis_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_somfy_telis_encoder;
 extern const SubGhzProtocol subghz_protocol_somfy_telis;
+extern const SubGhzBlockPreamble subghz_protocol_somfy_telis_preamble;
 
 /**
  * Allocate SubGhzProtocolEncoderSomfyTelis.
@@ -83,6 +84,13 @@ void subghz_protocol_decoder_somfy_telis_free(void* context);
  */
 void subghz_protocol_decoder_somfy_telis_reset(void* context);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderSomfyTelis waits for its preamble.
+ * @param context Pointer to a SubGhzProtocolDecoderSomfyTelis instance
+ * @return true if decoder is in its reset step
+ */
+bool subghz_protocol_decoder_somfy_telis_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderSomfyTelis instance
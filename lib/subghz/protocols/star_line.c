@@ -496,6 +496,67 @@ static inline bool subghz_protocol_star_line_check_decrypt(
     return false;
 }
 
+#define subghz_protocol_star_line_learning_cache_serial(fix) ((fix)&0x0FFFFFFF)
+
+static inline void subghz_protocol_star_line_learning_cache_put(
+    SubGhzKeystore* keystore,
+    uint32_t fix,
+    const SubGhzKey* manufacture_code,
+    uint64_t man,
+    uint8_t learning_type) {
+    subghz_keystore_learning_cache_put(
+        keystore,
+        subghz_protocol_star_line_learning_cache_serial(fix),
+        0,
+        manufacture_code,
+        man,
+        learning_type);
+}
+
+/** 
+ * Check the device key derived for this remote on a previous press
+ * @param instance Pointer to a SubGhzBlockGeneric* instance
+ * @param fix Fix part of the parcel
+ * @param hop Hop encrypted part of the parcel
+ * @param keystore Pointer to a SubGhzKeystore* instance
+ * @param mf_not_set true if any manufacture is accepted
+ * @param manufacture_name 
+ * @return true if the cached device key still decrypts hop
+ */
+static bool subghz_protocol_star_line_learning_cache_check(
+    SubGhzBlockGeneric* instance,
+    uint32_t fix,
+    uint32_t hop,
+    SubGhzKeystore* keystore,
+    bool mf_not_set,
+    const char** manufacture_name) {
+    uint32_t serial = subghz_protocol_star_line_learning_cache_serial(fix);
+    uint64_t man;
+    uint8_t learning_type;
+    const SubGhzKey* manufacture_code =
+        subghz_keystore_learning_cache_get(keystore, serial, 0, &man, &learning_type);
+    if(!manufacture_code) return false;
+
+    const char* name = furi_string_get_cstr(manufacture_code->name);
+    bool found = false;
+    if(mf_not_set || (strcmp(name, keystore->mfname) == 0)) {
+        uint32_t decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        found = subghz_protocol_star_line_check_decrypt(
+            instance, decrypt, (uint8_t)(fix >> 24), (uint16_t)(fix & 0xFF));
+    }
+
+    if(found) {
+        *manufacture_name = name;
+        keystore->mfname = *manufacture_name;
+        if(manufacture_code->type == KEELOQ_LEARNING_UNKNOWN) {
+            keystore->kl_type = learning_type;
+        }
+    } else {
+        subghz_keystore_learning_cache_drop(keystore, serial, 0);
+    }
+    return found;
+}
+
 /** 
  * Checking the accepted code against the database manafacture key
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -528,6 +589,11 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
     } else if(strcmp(mfname, "") == 0) {
         mf_not_set = true;
     }
+
+    if(subghz_protocol_star_line_learning_cache_check(
+           instance, fix, hop, keystore, mf_not_set, manufacture_name)) {
+        return 1;
+    }
     for
         M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
             if(mf_not_set || (strcmp(furi_string_get_cstr(manufacture_code->name), mfname) == 0)) {
@@ -539,6 +605,12 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
                            instance, decrypt, btn, end_serial)) {
                         *manufacture_name = furi_string_get_cstr(manufacture_code->name);
                         keystore->mfname = *manufacture_name;
+                        subghz_protocol_star_line_learning_cache_put(
+                            keystore,
+                            fix,
+                            manufacture_code,
+                            manufacture_code->key,
+                            KEELOQ_LEARNING_SIMPLE);
                         return 1;
                     }
                     break;
@@ -552,6 +624,12 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
                            instance, decrypt, btn, end_serial)) {
                         *manufacture_name = furi_string_get_cstr(manufacture_code->name);
                         keystore->mfname = *manufacture_name;
+                        subghz_protocol_star_line_learning_cache_put(
+                            keystore,
+                            fix,
+                            manufacture_code,
+                            man_normal_learning,
+                            KEELOQ_LEARNING_NORMAL);
                         return 1;
                     }
                     break;
@@ -562,6 +640,12 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
                            instance, decrypt, btn, end_serial)) {
                         *manufacture_name = furi_string_get_cstr(manufacture_code->name);
                         keystore->mfname = *manufacture_name;
+                        subghz_protocol_star_line_learning_cache_put(
+                            keystore,
+                            fix,
+                            manufacture_code,
+                            manufacture_code->key,
+                            KEELOQ_LEARNING_SIMPLE);
                         keystore->kl_type = 1;
                         return 1;
                     }
@@ -577,6 +661,8 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
                            instance, decrypt, btn, end_serial)) {
                         *manufacture_name = furi_string_get_cstr(manufacture_code->name);
                         keystore->mfname = *manufacture_name;
+                        subghz_protocol_star_line_learning_cache_put(
+                            keystore, fix, manufacture_code, man_rev, KEELOQ_LEARNING_SIMPLE);
                         keystore->kl_type = 1;
                         return 1;
                     }
@@ -590,6 +676,12 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
                            instance, decrypt, btn, end_serial)) {
                         *manufacture_name = furi_string_get_cstr(manufacture_code->name);
                         keystore->mfname = *manufacture_name;
+                        subghz_protocol_star_line_learning_cache_put(
+                            keystore,
+                            fix,
+                            manufacture_code,
+                            man_normal_learning,
+                            KEELOQ_LEARNING_NORMAL);
                         keystore->kl_type = 2;
                         return 1;
                     }
@@ -601,6 +693,12 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
                            instance, decrypt, btn, end_serial)) {
                         *manufacture_name = furi_string_get_cstr(manufacture_code->name);
                         keystore->mfname = *manufacture_name;
+                        subghz_protocol_star_line_learning_cache_put(
+                            keystore,
+                            fix,
+                            manufacture_code,
+                            man_normal_learning,
+                            KEELOQ_LEARNING_NORMAL);
                         keystore->kl_type = 2;
                         return 1;
                     }
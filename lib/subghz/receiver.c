@@ -3,10 +3,22 @@
 #include "registry.h"
 #include "protocols/protocol_items.h"
 
+#include "blocks/math.h"
+
 #include <m-array.h>
 
 typedef struct {
     SubGhzProtocolEncoderBase* base;
+
+    // Preamble window, only valid if has_preamble
+    bool has_preamble;
+    bool preamble_level;
+    uint32_t preamble_duration;
+    uint32_t preamble_delta;
+    // Decoder is in its reset step, updated after every feed
+    bool idle;
+
+    SubGhzReceiverDecoderStats stats;
 } SubGhzReceiverSlot;
 
 ARRAY_DEF(SubGhzReceiverSlotArray, SubGhzReceiverSlot, M_POD_OPLIST);
@@ -15,6 +27,7 @@ ARRAY_DEF(SubGhzReceiverSlotArray, SubGhzReceiverSlot, M_POD_OPLIST);
 struct SubGhzReceiver {
     SubGhzReceiverSlotArray_t slots;
     SubGhzProtocolFlag filter;
+    bool preamble_filter;
 
     SubGhzReceiverCallback callback;
     void* context;
@@ -33,9 +46,24 @@ SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
         if(protocol->decoder && protocol->decoder->alloc) {
             SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_push_new(instance->slots);
             slot->base = protocol->decoder->alloc(environment);
+
+            const SubGhzBlockPreamble* preamble = subghz_protocol_registry_get_preamble(protocol);
+            // Without is_idle there is no way to tell when the decoder is back in reset step
+            slot->has_preamble = (preamble != NULL) && protocol->decoder->is_idle;
+            if(preamble) {
+                slot->preamble_level = preamble->level;
+                slot->preamble_duration = preamble->timing->te_short * preamble->te_short_count +
+                                          preamble->timing->te_long * preamble->te_long_count;
+                slot->preamble_delta = preamble->timing->te_delta * preamble->te_delta_count;
+            }
+            // Freshly allocated decoders start in their reset step
+            slot->idle = slot->has_preamble;
+            slot->stats.fed = 0;
+            slot->stats.skipped = 0;
         }
     }
 
+    instance->preamble_filter = true;
     instance->callback = NULL;
     instance->context = NULL;
     return instance;
@@ -64,12 +92,43 @@ void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t durat
 
     for
         M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
-            if((slot->base->protocol->flag & instance->filter) != 0) {
-                slot->base->protocol->decoder->feed(slot->base, level, duration);
+            if((slot->base->protocol->flag & instance->filter) == 0) continue;
+
+            if(slot->idle) {
+                // An idle decoder ignores everything except its preamble pulse,
+                // so feeding it anything else would be a wasted call
+                if((level != slot->preamble_level) ||
+                   (DURATION_DIFF(duration, slot->preamble_duration) >= slot->preamble_delta)) {
+                    slot->stats.skipped++;
+                    continue;
+                }
+                slot->idle = false;
+            }
+
+            slot->stats.fed++;
+            slot->base->protocol->decoder->feed(slot->base, level, duration);
+
+            if(slot->has_preamble && instance->preamble_filter) {
+                slot->idle = slot->base->protocol->decoder->is_idle(slot->base);
             }
         }
 }
 
+void subghz_receiver_decode_batch(
+    SubGhzReceiver* instance,
+    const LevelDuration* pairs,
+    size_t count) {
+    furi_assert(instance);
+    furi_assert(pairs);
+
+    for(size_t i = 0; i < count; i++) {
+        subghz_receiver_decode(
+            instance,
+            level_duration_get_level(pairs[i]),
+            level_duration_get_duration(pairs[i]));
+    }
+}
+
 void subghz_receiver_reset(SubGhzReceiver* instance) {
     furi_assert(instance);
     furi_assert(instance->slots);
@@ -77,6 +136,7 @@ void subghz_receiver_reset(SubGhzReceiver* instance) {
     for
         M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
             slot->base->protocol->decoder->reset(slot->base);
+            slot->idle = instance->preamble_filter && slot->has_preamble;
         }
 }
 
@@ -108,6 +168,35 @@ void subghz_receiver_set_filter(SubGhzReceiver* instance, SubGhzProtocolFlag fil
     instance->filter = filter;
 }
 
+void subghz_receiver_set_preamble_filter(SubGhzReceiver* instance, bool enable) {
+    furi_assert(instance);
+    instance->preamble_filter = enable;
+    // Enabling takes effect once a decoder gets back to its reset step
+    if(!enable) {
+        for
+            M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
+                slot->idle = false;
+            }
+    }
+}
+
+bool subghz_receiver_get_decoder_stats(
+    SubGhzReceiver* instance,
+    size_t index,
+    const char** name,
+    SubGhzReceiverDecoderStats* stats) {
+    furi_assert(instance);
+    furi_assert(name);
+    furi_assert(stats);
+
+    if(index >= SubGhzReceiverSlotArray_size(instance->slots)) return false;
+
+    const SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_cget(instance->slots, index);
+    *name = slot->base->protocol->name;
+    *stats = slot->stats;
+    return true;
+}
+
 SubGhzProtocolDecoderBase* subghz_receiver_search_decoder_base_by_name(
     SubGhzReceiver* instance,
     const char* decoder_name) {
@@ -9,6 +9,12 @@ extern "C" {
 
 typedef struct SubGhzReceiver SubGhzReceiver;
 
+/** Number of pulses a decoder got and how many were skipped by the preamble filter */
+typedef struct {
+    uint32_t fed;
+    uint32_t skipped;
+} SubGhzReceiverDecoderStats;
+
 typedef void (*SubGhzReceiverCallback)(
     SubGhzReceiver* decoder,
     SubGhzProtocolDecoderBase* decoder_base,
@@ -35,6 +41,18 @@ void subghz_receiver_free(SubGhzReceiver* instance);
  */
 void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t duration);
 
+/**
+ * Parse a span of levels and durations, same as calling subghz_receiver_decode for each.
+ * Matches SubGhzWorkerPairBatchCallback.
+ * @param instance Pointer to a SubGhzReceiver instance
+ * @param pairs Array of LevelDuration
+ * @param count Number of elements in pairs
+ */
+void subghz_receiver_decode_batch(
+    SubGhzReceiver* instance,
+    const LevelDuration* pairs,
+    size_t count);
+
 /**
  * Reset decoder SubGhzReceiver.
  * @param instance Pointer to a SubGhzReceiver instance
@@ -59,6 +77,29 @@ void subghz_receiver_set_rx_callback(
  */
 void subghz_receiver_set_filter(SubGhzReceiver* instance, SubGhzProtocolFlag filter);
 
+/**
+ * Enable or disable the preamble filter, enabled by default.
+ * While a decoder that declares its preamble is idle (in its reset step), pulses that can not
+ * start its preamble are not fed to it. Decoding results stay the same.
+ * @param instance Pointer to a SubGhzReceiver instance
+ * @param enable true to skip idle decoders
+ */
+void subghz_receiver_set_preamble_filter(SubGhzReceiver* instance, bool enable);
+
+/**
+ * Get feed counters of a decoder.
+ * @param instance Pointer to a SubGhzReceiver instance
+ * @param index Decoder index
+ * @param name Returned protocol name
+ * @param stats Returned SubGhzReceiverDecoderStats
+ * @return false if index is out of range
+ */
+bool subghz_receiver_get_decoder_stats(
+    SubGhzReceiver* instance,
+    size_t index,
+    const char** name,
+    SubGhzReceiverDecoderStats* stats);
+
 /**
  * Search for a cattery by his name.
  * @param instance Pointer to a SubGhzReceiver instance
@@ -34,6 +34,11 @@ SubGhzKeystore* subghz_keystore_alloc() {
 
     subghz_keystore_reset_kl(instance);
 
+    memset(instance->learning_cache, 0, sizeof(instance->learning_cache));
+    instance->learning_cache_clock = 0;
+    instance->learning_cache_stats.hits = 0;
+    instance->learning_cache_stats.misses = 0;
+
     return instance;
 }
 
@@ -57,6 +62,91 @@ void subghz_keystore_free(SubGhzKeystore* instance) {
     free(instance);
 }
 
+static SubGhzKeystoreLearningCacheItem*
+    subghz_keystore_learning_cache_find(SubGhzKeystore* instance, uint32_t serial, uint32_t seed) {
+    for(size_t i = 0; i < SUBGHZ_KEYSTORE_LEARNING_CACHE_SIZE; i++) {
+        SubGhzKeystoreLearningCacheItem* item = &instance->learning_cache[i];
+        if(item->last_used && item->serial == serial && item->seed == seed) {
+            return item;
+        }
+    }
+    return NULL;
+}
+
+const SubGhzKey* subghz_keystore_learning_cache_get(
+    SubGhzKeystore* instance,
+    uint32_t serial,
+    uint32_t seed,
+    uint64_t* man,
+    uint8_t* learning_type) {
+    furi_assert(instance);
+    furi_assert(man);
+    furi_assert(learning_type);
+
+    SubGhzKeystoreLearningCacheItem* item =
+        subghz_keystore_learning_cache_find(instance, serial, seed);
+    if(!item || item->manufacture_index >= SubGhzKeyArray_size(instance->data)) {
+        instance->learning_cache_stats.misses++;
+        return NULL;
+    }
+
+    instance->learning_cache_stats.hits++;
+    item->last_used = ++instance->learning_cache_clock;
+    *man = item->man;
+    *learning_type = item->learning_type;
+    return SubGhzKeyArray_cget(instance->data, item->manufacture_index);
+}
+
+void subghz_keystore_learning_cache_put(
+    SubGhzKeystore* instance,
+    uint32_t serial,
+    uint32_t seed,
+    const SubGhzKey* manufacture_code,
+    uint64_t man,
+    uint8_t learning_type) {
+    furi_assert(instance);
+    furi_assert(manufacture_code);
+
+    SubGhzKeystoreLearningCacheItem* item =
+        subghz_keystore_learning_cache_find(instance, serial, seed);
+    if(!item) {
+        item = &instance->learning_cache[0];
+        for(size_t i = 1; i < SUBGHZ_KEYSTORE_LEARNING_CACHE_SIZE; i++) {
+            if(instance->learning_cache[i].last_used < item->last_used) {
+                item = &instance->learning_cache[i];
+            }
+        }
+    }
+
+    item->serial = serial;
+    item->seed = seed;
+    item->man = man;
+    item->manufacture_index = manufacture_code - SubGhzKeyArray_cget(instance->data, 0);
+    item->learning_type = learning_type;
+    item->last_used = ++instance->learning_cache_clock;
+}
+
+void subghz_keystore_learning_cache_drop(
+    SubGhzKeystore* instance,
+    uint32_t serial,
+    uint32_t seed) {
+    furi_assert(instance);
+
+    SubGhzKeystoreLearningCacheItem* item =
+        subghz_keystore_learning_cache_find(instance, serial, seed);
+    if(item) {
+        item->last_used = 0;
+        instance->learning_cache_stats.hits--;
+        instance->learning_cache_stats.misses++;
+    }
+}
+
+SubGhzKeystoreLearningCacheStats
+    subghz_keystore_learning_cache_get_stats(SubGhzKeystore* instance) {
+    furi_assert(instance);
+    return instance->learning_cache_stats;
+}
+
 static void subghz_keystore_add_key(
     SubGhzKeystore* instance,
     const char* name,
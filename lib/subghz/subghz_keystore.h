@@ -20,6 +20,11 @@ ARRAY_DEF(SubGhzKeyArray, SubGhzKey, M_POD_OPLIST)
 
 typedef struct SubGhzKeystore SubGhzKeystore;
 
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+} SubGhzKeystoreLearningCacheStats;
+
 /**
  * Allocate SubGhzKeystore.
  * @return SubGhzKeystore* pointer to a SubGhzKeystore instance
@@ -77,6 +82,56 @@ bool subghz_keystore_raw_get_data(const char* file_name, size_t offset, uint8_t*
 
 void subghz_keystore_reset_kl(SubGhzKeystore* instance);
 
+/** 
+ * Get device key derived earlier for this remote (LRU cache)
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @param serial Serial number of the remote
+ * @param seed Seed of the remote, 0 if not used
+ * @param man Returned device key
+ * @param learning_type Returned learning type that matched, KEELOQ_LEARNING_*
+ * @return manufacture key the device key was derived from, NULL on miss
+ */
+const SubGhzKey* subghz_keystore_learning_cache_get(
+    SubGhzKeystore* instance,
+    uint32_t serial,
+    uint32_t seed,
+    uint64_t* man,
+    uint8_t* learning_type);
+
+/** 
+ * Remember device key derived for this remote, least recently used entry is evicted
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @param serial Serial number of the remote
+ * @param seed Seed of the remote, 0 if not used
+ * @param manufacture_code Manufacture key from this keystore
+ * @param man Device key
+ * @param learning_type Learning type that matched, KEELOQ_LEARNING_*
+ */
+void subghz_keystore_learning_cache_put(
+    SubGhzKeystore* instance,
+    uint32_t serial,
+    uint32_t seed,
+    const SubGhzKey* manufacture_code,
+    uint64_t man,
+    uint8_t learning_type);
+
+/** 
+ * Drop stale entry returned by subghz_keystore_learning_cache_get,
+ * the lookup is accounted as a miss
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @param serial Serial number of the remote
+ * @param seed Seed of the remote, 0 if not used
+ */
+void subghz_keystore_learning_cache_drop(SubGhzKeystore* instance, uint32_t serial, uint32_t seed);
+
+/** 
+ * Get learning cache hit/miss counters
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @return SubGhzKeystoreLearningCacheStats
+ */
+SubGhzKeystoreLearningCacheStats
+    subghz_keystore_learning_cache_get_stats(SubGhzKeystore* instance);
+
 #ifdef __cplusplus
 }
 #endif
@@ -2,8 +2,23 @@
 
 #include <m-array.h>
 
+#define SUBGHZ_KEYSTORE_LEARNING_CACHE_SIZE 16
+
+typedef struct {
+    uint32_t serial;
+    uint32_t seed;
+    uint64_t man;
+    uint32_t last_used; // 0 - empty slot
+    uint16_t manufacture_index;
+    uint8_t learning_type;
+} SubGhzKeystoreLearningCacheItem;
+
 struct SubGhzKeystore {
     SubGhzKeyArray_t data;
     const char* mfname;
     uint8_t kl_type;
+
+    SubGhzKeystoreLearningCacheItem learning_cache[SUBGHZ_KEYSTORE_LEARNING_CACHE_SIZE];
+    uint32_t learning_cache_clock;
+    SubGhzKeystoreLearningCacheStats learning_cache_stats;
 };
@@ -4,6 +4,10 @@
 
 #define TAG "SubGhzWorker"
 
+#define SUBGHZ_WORKER_STREAM_SIZE 4096
+#define SUBGHZ_WORKER_BATCH_SIZE 64
+#define SUBGHZ_WORKER_RATE_PERIOD_MS 1000
+
 struct SubGhzWorker {
     FuriThread* thread;
     FuriStreamBuffer* stream;
@@ -14,8 +18,18 @@ struct SubGhzWorker {
     LevelDuration filter_level_duration;
     uint16_t filter_duration;
 
+    // Raw edges drained from the stream and filtered pairs waiting for the callback
+    LevelDuration rx_batch[SUBGHZ_WORKER_BATCH_SIZE];
+    LevelDuration pair_batch[SUBGHZ_WORKER_BATCH_SIZE];
+    size_t pair_batch_count;
+
+    SubGhzWorkerStats stats;
+    uint32_t rate_tick;
+    uint32_t rate_edges;
+
     SubGhzWorkerOverrunCallback overrun_callback;
     SubGhzWorkerPairCallback pair_callback;
+    SubGhzWorkerPairBatchCallback pair_batch_callback;
     void* context;
 };
 
@@ -38,6 +52,83 @@ void subghz_worker_rx_callback(bool level, uint32_t duration, void* context) {
     if(sizeof(LevelDuration) != ret) instance->overrun = true;
 }
 
+/** Pass accumulated pairs to the receiver
+ * 
+ * @param instance Pointer to a SubGhzWorker instance
+ */
+static void subghz_worker_pair_batch_flush(SubGhzWorker* instance) {
+    if(!instance->pair_batch_count) return;
+
+    if(instance->pair_batch_callback) {
+        instance->pair_batch_callback(
+            instance->context, instance->pair_batch, instance->pair_batch_count);
+    } else if(instance->pair_callback) {
+        for(size_t i = 0; i < instance->pair_batch_count; i++) {
+            instance->pair_callback(
+                instance->context,
+                level_duration_get_level(instance->pair_batch[i]),
+                level_duration_get_duration(instance->pair_batch[i]));
+        }
+    }
+    instance->stats.pairs += instance->pair_batch_count;
+    instance->pair_batch_count = 0;
+}
+
+/** Run glitch filter over received edges
+ * 
+ * @param instance Pointer to a SubGhzWorker instance
+ * @param count number of edges in rx_batch
+ */
+static void subghz_worker_process_batch(SubGhzWorker* instance, size_t count) {
+    for(size_t i = 0; i < count; i++) {
+        LevelDuration level_duration = instance->rx_batch[i];
+        if(level_duration_is_reset(level_duration)) {
+            // Keep ordering: everything before the overrun goes out first
+            subghz_worker_pair_batch_flush(instance);
+            instance->stats.overruns++;
+            FURI_LOG_E(TAG, "Overrun buffer");
+            if(instance->overrun_callback) instance->overrun_callback(instance->context);
+            continue;
+        }
+
+        bool level = level_duration_get_level(level_duration);
+        uint32_t duration = level_duration_get_duration(level_duration);
+
+        if((duration < instance->filter_duration) ||
+           (instance->filter_level_duration.level == level)) {
+            instance->filter_level_duration.duration += duration;
+
+        } else if(instance->filter_level_duration.level != level) {
+            instance->pair_batch[instance->pair_batch_count++] = level_duration_make(
+                instance->filter_level_duration.level, instance->filter_level_duration.duration);
+
+            instance->filter_level_duration.duration = duration;
+            instance->filter_level_duration.level = level;
+        }
+    }
+    subghz_worker_pair_batch_flush(instance);
+}
+
+/** Update edges per second estimation
+ * 
+ * @param instance Pointer to a SubGhzWorker instance
+ * @param count number of edges received since last call
+ */
+static void subghz_worker_update_rate(SubGhzWorker* instance, size_t count) {
+    instance->stats.edges += count;
+    instance->rate_edges += count;
+
+    uint32_t elapsed = furi_get_tick() - instance->rate_tick;
+    if(elapsed >= furi_ms_to_ticks(SUBGHZ_WORKER_RATE_PERIOD_MS)) {
+        uint64_t edges = (uint64_t)instance->rate_edges * furi_kernel_get_tick_frequency();
+        instance->stats.edges_per_second = (uint32_t)(edges / elapsed);
+        instance->stats.edges_per_second_peak =
+            MAX(instance->stats.edges_per_second_peak, instance->stats.edges_per_second);
+        instance->rate_edges = 0;
+        instance->rate_tick += elapsed;
+    }
+}
+
 /** Worker callback thread
  * 
  * @param context 
@@ -46,36 +137,26 @@ void subghz_worker_rx_callback(bool level, uint32_t duration, void* context) {
 static int32_t subghz_worker_thread_callback(void* context) {
     SubGhzWorker* instance = context;
 
-    LevelDuration level_duration;
+    instance->rate_tick = furi_get_tick();
+    instance->rate_edges = 0;
+
     while(instance->running) {
-        int ret = furi_stream_buffer_receive(
-            instance->stream, &level_duration, sizeof(LevelDuration), 10);
-        if(ret == sizeof(LevelDuration)) {
-            if(level_duration_is_reset(level_duration)) {
-                FURI_LOG_E(TAG, "Overrun buffer");
-                if(instance->overrun_callback) instance->overrun_callback(instance->context);
-            } else {
-                bool level = level_duration_get_level(level_duration);
-                uint32_t duration = level_duration_get_duration(level_duration);
-
-                if((duration < instance->filter_duration) ||
-                   (instance->filter_level_duration.level == level)) {
-                    instance->filter_level_duration.duration += duration;
-
-                } else if(instance->filter_level_duration.level != level) {
-                    if(instance->pair_callback)
-                        instance->pair_callback(
-                            instance->context,
-                            instance->filter_level_duration.level,
-                            instance->filter_level_duration.duration);
-
-                    instance->filter_level_duration.duration = duration;
-                    instance->filter_level_duration.level = level;
-                }
-            }
-        }
+        // Drain everything available in one call, the stream wakes us on the first edge
+        size_t ret = furi_stream_buffer_receive(
+            instance->stream, instance->rx_batch, sizeof(instance->rx_batch), 10);
+        size_t count = ret / sizeof(LevelDuration);
+        if(count) subghz_worker_process_batch(instance, count);
+        subghz_worker_update_rate(instance, count);
     }
 
+    FURI_LOG_I(
+        TAG,
+        "Edges %lu, peak %lu/s, pairs %lu, overruns %lu",
+        instance->stats.edges,
+        instance->stats.edges_per_second_peak,
+        instance->stats.pairs,
+        instance->stats.overruns);
+
     return 0;
 }
 
@@ -85,8 +166,8 @@ SubGhzWorker* subghz_worker_alloc() {
     instance->thread =
         furi_thread_alloc_ex("SubGhzWorker", 2048, subghz_worker_thread_callback, instance);
 
-    instance->stream =
-        furi_stream_buffer_alloc(sizeof(LevelDuration) * 4096, sizeof(LevelDuration));
+    instance->stream = furi_stream_buffer_alloc(
+        sizeof(LevelDuration) * SUBGHZ_WORKER_STREAM_SIZE, sizeof(LevelDuration));
 
     //setting default filter in us
     instance->filter_duration = 30;
@@ -115,6 +196,13 @@ void subghz_worker_set_pair_callback(SubGhzWorker* instance, SubGhzWorkerPairCal
     instance->pair_callback = callback;
 }
 
+void subghz_worker_set_pair_batch_callback(
+    SubGhzWorker* instance,
+    SubGhzWorkerPairBatchCallback callback) {
+    furi_assert(instance);
+    instance->pair_batch_callback = callback;
+}
+
 void subghz_worker_set_context(SubGhzWorker* instance, void* context) {
     furi_assert(instance);
     instance->context = context;
@@ -125,6 +213,7 @@ void subghz_worker_start(SubGhzWorker* instance) {
     furi_assert(!instance->running);
 
     instance->running = true;
+    memset(&instance->stats, 0, sizeof(SubGhzWorkerStats));
 
     furi_thread_start(instance->thread);
 }
@@ -146,4 +235,10 @@ bool subghz_worker_is_running(SubGhzWorker* instance) {
 void subghz_worker_set_filter(SubGhzWorker* instance, uint16_t timeout) {
     furi_assert(instance);
     instance->filter_duration = timeout;
-}
\ No newline at end of file
+}
+
+void subghz_worker_get_stats(SubGhzWorker* instance, SubGhzWorkerStats* stats) {
+    furi_assert(instance);
+    furi_assert(stats);
+    *stats = instance->stats;
+}
@@ -12,6 +12,20 @@ typedef void (*SubGhzWorkerOverrunCallback)(void* context);
 
 typedef void (*SubGhzWorkerPairCallback)(void* context, bool level, uint32_t duration);
 
+typedef void (*SubGhzWorkerPairBatchCallback)(
+    void* context,
+    const LevelDuration* pairs,
+    size_t count);
+
+/** SubGhzWorker counters, reset on start */
+typedef struct {
+    uint32_t edges; /**< Edges received from the radio */
+    uint32_t pairs; /**< Pairs passed to the receiver after glitch filter */
+    uint32_t overruns; /**< Times the stream buffer was full and edges were lost */
+    uint32_t edges_per_second; /**< Edge rate over the last second */
+    uint32_t edges_per_second_peak; /**< Highest edge rate seen */
+} SubGhzWorkerStats;
+
 void subghz_worker_rx_callback(bool level, uint32_t duration, void* context);
 
 /** 
@@ -42,6 +56,16 @@ void subghz_worker_set_overrun_callback(
  */
 void subghz_worker_set_pair_callback(SubGhzWorker* instance, SubGhzWorkerPairCallback callback);
 
+/** 
+ * Batched pair callback SubGhzWorker.
+ * If set, used instead of the pair callback: filtered pairs are delivered as a whole span.
+ * @param instance Pointer to a SubGhzWorker instance
+ * @param callback SubGhzWorkerPairBatchCallback callback
+ */
+void subghz_worker_set_pair_batch_callback(
+    SubGhzWorker* instance,
+    SubGhzWorkerPairBatchCallback callback);
+
 /** 
  * Context callback SubGhzWorker.
  * @param instance Pointer to a SubGhzWorker instance
@@ -75,6 +99,13 @@ bool subghz_worker_is_running(SubGhzWorker* instance);
  */
 void subghz_worker_set_filter(SubGhzWorker* instance, uint16_t timeout);
 
+/** 
+ * Get SubGhzWorker counters.
+ * @param instance Pointer to a SubGhzWorker instance
+ * @param stats Pointer to a SubGhzWorkerStats to fill
+ */
+void subghz_worker_get_stats(SubGhzWorker* instance, SubGhzWorkerStats* stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -73,6 +73,7 @@ typedef SubGhzProtocolStatus (*SubGhzDeserialize)(void* context, FlipperFormat*
 // Decoder specific
 typedef void (*SubGhzDecoderFeed)(void* decoder, bool level, uint32_t duration);
 typedef void (*SubGhzDecoderReset)(void* decoder);
+typedef bool (*SubGhzDecoderIsIdle)(void* decoder);
 typedef uint8_t (*SubGhzGetHashData)(void* decoder);
 typedef void (*SubGhzGetString)(void* decoder, FuriString* output);
 
@@ -91,6 +92,9 @@ typedef struct {
     SubGhzGetString get_string;
     SubGhzSerialize serialize;
     SubGhzDeserialize deserialize;
+
+    // Optional, true while decoder waits for its preamble. Last to keep the layout for FAPs
+    SubGhzDecoderIsIdle is_idle;
 } SubGhzProtocolDecoder;
 
 typedef struct {
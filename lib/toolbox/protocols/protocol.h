@@ -11,6 +11,10 @@ typedef uint8_t* (*ProtocolGetData)(void* protocol);
 
 typedef void (*ProtocolDecoderStart)(void* protocol);
 typedef bool (*ProtocolDecoderFeed)(void* protocol, bool level, uint32_t duration);
+typedef bool (*ProtocolDecoderFeedDemodulated)(void* protocol, const void* symbols);
+
+typedef void (*ProtocolDemodulatorStart)(void* demodulator);
+typedef const void* (*ProtocolDemodulatorFeed)(void* demodulator, bool level, uint32_t duration);
 
 typedef bool (*ProtocolEncoderStart)(void* protocol);
 typedef LevelDuration (*ProtocolEncoderYield)(void* protocol);
@@ -18,9 +22,24 @@ typedef LevelDuration (*ProtocolEncoderYield)(void* protocol);
 typedef void (*ProtocolRenderData)(void* protocol, FuriString* result);
 typedef bool (*ProtocolWriteData)(void* protocol, void* data);
 
+/**
+ * Demodulator shared by all protocols of a dict that use the same modulation.
+ * Dict runs it once per edge and passes its symbols to every such protocol.
+ * Feed returns NULL while there are no symbols for this edge.
+ */
+typedef struct {
+    ProtocolAlloc alloc;
+    ProtocolFree free;
+    ProtocolDemodulatorStart start;
+    ProtocolDemodulatorFeed feed;
+} ProtocolDemodulator;
+
 typedef struct {
     ProtocolDecoderStart start;
     ProtocolDecoderFeed feed;
+    // Alternative to feed: symbols from a demodulator shared with other protocols
+    const ProtocolDemodulator* demodulator;
+    ProtocolDecoderFeedDemodulated feed_demodulated;
 } ProtocolDecoder;
 
 typedef struct {
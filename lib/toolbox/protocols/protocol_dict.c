@@ -1,20 +1,58 @@
 #include <furi.h>
 #include "protocol_dict.h"
 
+typedef struct {
+    const ProtocolDemodulator* base;
+    void* data;
+    uint32_t features;
+    const void* symbols;
+} ProtocolDictDemodulator;
+
 struct ProtocolDict {
     const ProtocolBase** base;
     size_t count;
     void** data;
+
+    ProtocolDictDemodulator* demodulators;
+    size_t demodulators_count;
+    // Demodulator of each protocol, NULL if protocol demodulates by itself
+    ProtocolDictDemodulator** demodulator;
 };
 
+static ProtocolDictDemodulator*
+    protocol_dict_demodulator_get(ProtocolDict* dict, const ProtocolDemodulator* base) {
+    for(size_t i = 0; i < dict->demodulators_count; i++) {
+        if(dict->demodulators[i].base == base) {
+            return &dict->demodulators[i];
+        }
+    }
+
+    ProtocolDictDemodulator* demodulator = &dict->demodulators[dict->demodulators_count++];
+    demodulator->base = base;
+    demodulator->data = base->alloc();
+    return demodulator;
+}
+
 ProtocolDict* protocol_dict_alloc(const ProtocolBase** protocols, size_t count) {
     ProtocolDict* dict = malloc(sizeof(ProtocolDict));
     dict->base = protocols;
     dict->count = count;
     dict->data = malloc(sizeof(void*) * dict->count);
+    dict->demodulators = malloc(sizeof(ProtocolDictDemodulator) * dict->count);
+    dict->demodulators_count = 0;
+    dict->demodulator = malloc(sizeof(ProtocolDictDemodulator*) * dict->count);
 
     for(size_t i = 0; i < dict->count; i++) {
         dict->data[i] = dict->base[i]->alloc();
+
+        const ProtocolDecoder* decoder = &dict->base[i]->decoder;
+        if(decoder->demodulator) {
+            furi_assert(decoder->feed_demodulated);
+            dict->demodulator[i] = protocol_dict_demodulator_get(dict, decoder->demodulator);
+            dict->demodulator[i]->features |= dict->base[i]->features;
+        } else {
+            dict->demodulator[i] = NULL;
+        }
     }
 
     return dict;
@@ -25,10 +63,51 @@ void protocol_dict_free(ProtocolDict* dict) {
         dict->base[i]->free(dict->data[i]);
     }
 
+    for(size_t i = 0; i < dict->demodulators_count; i++) {
+        dict->demodulators[i].base->free(dict->demodulators[i].data);
+    }
+
+    free(dict->demodulator);
+    free(dict->demodulators);
     free(dict->data);
     free(dict);
 }
 
+static void protocol_dict_demodulators_feed(
+    ProtocolDict* dict,
+    uint32_t feature,
+    bool level,
+    uint32_t duration) {
+    for(size_t i = 0; i < dict->demodulators_count; i++) {
+        ProtocolDictDemodulator* demodulator = &dict->demodulators[i];
+
+        if(feature == PROTOCOL_ALL_FEATURES || (demodulator->features & feature)) {
+            demodulator->symbols = demodulator->base->feed(demodulator->data, level, duration);
+        } else {
+            demodulator->symbols = NULL;
+        }
+    }
+}
+
+static bool protocol_dict_decoder_feed(
+    ProtocolDict* dict,
+    size_t protocol_index,
+    bool level,
+    uint32_t duration) {
+    const ProtocolDecoder* decoder = &dict->base[protocol_index]->decoder;
+    const ProtocolDictDemodulator* demodulator = dict->demodulator[protocol_index];
+
+    if(demodulator) {
+        // Nothing to do until demodulator yields symbols
+        return demodulator->symbols &&
+               decoder->feed_demodulated(dict->data[protocol_index], demodulator->symbols);
+    } else if(decoder->feed) {
+        return decoder->feed(dict->data[protocol_index], level, duration);
+    }
+
+    return false;
+}
+
 void protocol_dict_set_data(
     ProtocolDict* dict,
     size_t protocol_index,
@@ -83,6 +162,14 @@ const char* protocol_dict_get_manufacturer(ProtocolDict* dict, size_t protocol_i
 }
 
 void protocol_dict_decoders_start(ProtocolDict* dict) {
+    for(size_t i = 0; i < dict->demodulators_count; i++) {
+        ProtocolDemodulatorStart fn = dict->demodulators[i].base->start;
+
+        if(fn) {
+            fn(dict->demodulators[i].data);
+        }
+    }
+
     for(size_t i = 0; i < dict->count; i++) {
         ProtocolDecoderStart fn = dict->base[i]->decoder.start;
 
@@ -101,15 +188,13 @@ ProtocolId protocol_dict_decoders_feed(ProtocolDict* dict, bool level, uint32_t
     bool done = false;
     ProtocolId ready_protocol_id = PROTOCOL_NO;
 
-    for(size_t i = 0; i < dict->count; i++) {
-        ProtocolDecoderFeed fn = dict->base[i]->decoder.feed;
+    protocol_dict_demodulators_feed(dict, PROTOCOL_ALL_FEATURES, level, duration);
 
-        if(fn) {
-            if(fn(dict->data[i], level, duration)) {
-                if(!done) {
-                    ready_protocol_id = i;
-                    done = true;
-                }
+    for(size_t i = 0; i < dict->count; i++) {
+        if(protocol_dict_decoder_feed(dict, i, level, duration)) {
+            if(!done) {
+                ready_protocol_id = i;
+                done = true;
             }
         }
     }
@@ -125,17 +210,15 @@ ProtocolId protocol_dict_decoders_feed_by_feature(
     bool done = false;
     ProtocolId ready_protocol_id = PROTOCOL_NO;
 
+    protocol_dict_demodulators_feed(dict, feature, level, duration);
+
     for(size_t i = 0; i < dict->count; i++) {
         uint32_t features = dict->base[i]->features;
         if(features & feature) {
-            ProtocolDecoderFeed fn = dict->base[i]->decoder.feed;
-
-            if(fn) {
-                if(fn(dict->data[i], level, duration)) {
-                    if(!done) {
-                        ready_protocol_id = i;
-                        done = true;
-                    }
+            if(protocol_dict_decoder_feed(dict, i, level, duration)) {
+                if(!done) {
+                    ready_protocol_id = i;
+                    done = true;
                 }
             }
         }
@@ -152,12 +235,14 @@ ProtocolId protocol_dict_decoders_feed_by_id(
     furi_assert(protocol_index < dict->count);
 
     ProtocolId ready_protocol_id = PROTOCOL_NO;
-    ProtocolDecoderFeed fn = dict->base[protocol_index]->decoder.feed;
+    ProtocolDictDemodulator* demodulator = dict->demodulator[protocol_index];
 
-    if(fn) {
-        if(fn(dict->data[protocol_index], level, duration)) {
-            ready_protocol_id = protocol_index;
-        }
+    if(demodulator) {
+        demodulator->symbols = demodulator->base->feed(demodulator->data, level, duration);
+    }
+
+    if(protocol_dict_decoder_feed(dict, protocol_index, level, duration)) {
+        ready_protocol_id = protocol_index;
     }
 
     return ready_protocol_id;
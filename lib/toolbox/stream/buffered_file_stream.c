@@ -61,6 +61,7 @@ bool buffered_file_stream_open(
     furi_assert(_stream);
     BufferedFileStream* stream = (BufferedFileStream*)_stream;
     furi_check(stream->stream_base.vtable == &buffered_file_stream_vtable);
+    stream->stream_base.generation++;
     return file_stream_open(stream->file_stream, path, access_mode, open_mode);
 }
 
@@ -2,6 +2,8 @@
 #include "stream_i.h"
 #include "file_stream.h"
 
+#define FILE_STREAM_READ_CACHE_SIZE 512U
+
 typedef struct {
     Stream stream_base;
     Storage* storage;
@@ -38,6 +40,8 @@ Stream* file_stream_alloc(Storage* storage) {
     FileStream* stream = malloc(sizeof(FileStream));
     stream->file = storage_file_alloc(storage);
     stream->storage = storage;
+    // Serves line parsers from memory, writes are never deferred
+    storage_file_set_read_cache_size(stream->file, FILE_STREAM_READ_CACHE_SIZE);
 
     stream->stream_base.vtable = &file_stream_vtable;
     return (Stream*)stream;
@@ -51,6 +55,7 @@ bool file_stream_open(
     furi_assert(_stream);
     FileStream* stream = (FileStream*)_stream;
     furi_check(stream->stream_base.vtable == &file_stream_vtable);
+    stream->stream_base.generation++;
     return storage_file_open(stream->file, path, access_mode, open_mode);
 }
 
@@ -68,6 +73,20 @@ FS_Error file_stream_get_error(Stream* _stream) {
     return storage_file_get_error(stream->file);
 }
 
+void file_stream_set_cache_size(Stream* _stream, uint16_t size) {
+    furi_assert(_stream);
+    FileStream* stream = (FileStream*)_stream;
+    furi_check(stream->stream_base.vtable == &file_stream_vtable);
+    storage_file_set_cache_size(stream->file, size);
+}
+
+void file_stream_get_cache_stats(Stream* _stream, StorageFileCacheStats* stats) {
+    furi_assert(_stream);
+    FileStream* stream = (FileStream*)_stream;
+    furi_check(stream->stream_base.vtable == &file_stream_vtable);
+    storage_file_get_cache_stats(stream->file, stats);
+}
+
 static void file_stream_free(FileStream* stream) {
     storage_file_free(stream->file);
     free(stream);
@@ -134,7 +153,6 @@ static size_t file_stream_size(FileStream* stream) {
 }
 
 static size_t file_stream_write(FileStream* stream, const uint8_t* data, size_t size) {
-    // TODO FL-3545: cache
     size_t need_to_write = size;
     while(need_to_write > 0) {
         uint16_t was_written =
@@ -148,7 +166,6 @@ static size_t file_stream_write(FileStream* stream, const uint8_t* data, size_t
 }
 
 static size_t file_stream_read(FileStream* stream, uint8_t* data, size_t size) {
-    // TODO FL-3545: cache
     size_t need_to_read = size;
     while(need_to_read > 0) {
         uint16_t was_read =
@@ -42,6 +42,23 @@ bool file_stream_close(Stream* stream);
  */
 FS_Error file_stream_get_error(Stream* stream);
 
+/**
+ * Sets size of the file cache, see storage_file_set_cache_size.
+ * File streams only have a read-ahead cache by default, writes are not deferred.
+ * This replaces it with a cache that also collects writes. Cached writes may fail
+ * only when they are flushed, so check the result of file_stream_close.
+ * @param stream pointer to stream object.
+ * @param size cache size in bytes, 0 to disable the cache
+ */
+void file_stream_set_cache_size(Stream* stream, uint16_t size);
+
+/**
+ * Gets file cache statistics, see storage_file_get_cache_stats.
+ * @param stream pointer to stream object.
+ * @param stats pointer to statistics
+ */
+void file_stream_get_cache_stats(Stream* stream, StorageFileCacheStats* stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -13,6 +13,7 @@ void stream_free(Stream* stream) {
 
 void stream_clean(Stream* stream) {
     furi_assert(stream);
+    stream->generation++;
     stream->vtable->clean(stream);
 }
 
@@ -114,6 +115,7 @@ size_t stream_size(Stream* stream) {
 
 size_t stream_write(Stream* stream, const uint8_t* data, size_t size) {
     furi_assert(stream);
+    stream->generation++;
     return stream->vtable->write(stream, data, size);
 }
 
@@ -128,6 +130,7 @@ bool stream_delete_and_insert(
     StreamWriteCB write_callback,
     const void* ctx) {
     furi_assert(stream);
+    stream->generation++;
     return stream->vtable->delete_and_insert(stream, delete_size, write_callback, ctx);
 }
 
@@ -39,6 +39,8 @@ struct StreamVTable {
 
 struct Stream {
     const StreamVTable* vtable;
+    // Bumped on every content change, lets users detect stale derived data
+    uint32_t generation;
 };
 
 #ifdef __cplusplus
@@ -102,6 +102,17 @@ class Main(App):
         )
         self.parser_dolphin.set_defaults(func=self.dolphin)
 
+        self.parser_infrared = self.subparsers.add_parser(
+            "infrared", help="Compile infrared databases into .irx indexes"
+        )
+        self.parser_infrared.add_argument(
+            "input_directory", help="Infrared databases directory"
+        )
+        self.parser_infrared.add_argument(
+            "output_directory", help="Infrared indexes output directory"
+        )
+        self.parser_infrared.set_defaults(func=self.infrared)
+
     def _icon2header(self, file):
         image = file2image(file)
         return image.width, image.height, image.data_as_carray()
@@ -327,6 +338,29 @@ extern const size_t ICON_PATHS_COUNT;
 
         return 0
 
+    def infrared(self):
+        from flipper.assets.infrared import InfraredIndex, INFRARED_INDEX_EXTENSION
+
+        self.logger.info("Compiling infrared databases")
+        os.makedirs(self.args.output_directory, exist_ok=True)
+        for filename in sorted(os.listdir(self.args.input_directory)):
+            basename, extension = os.path.splitext(filename)
+            if extension != ".ir":
+                continue
+            source = os.path.join(self.args.input_directory, filename)
+            target = os.path.join(
+                self.args.output_directory, basename + INFRARED_INDEX_EXTENSION
+            )
+            try:
+                index = InfraredIndex.compile(source, target)
+            except Exception as e:
+                self.logger.error(f"Failed to compile {source}: {e}")
+                return 1
+            self.logger.info(f"{filename}: {len(index.signals)} signals")
+        self.logger.info("Complete")
+
+        return 0
+
 
 if __name__ == "__main__":
     Main()()
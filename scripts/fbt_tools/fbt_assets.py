@@ -65,6 +65,14 @@ def dolphin_emitter(target, source, env):
     return target, source
 
 
+def infrared_index_emitter(target, source, env):
+    source = source[0].srcnode().glob("*.ir")
+    target = [
+        target[0].File(os.path.splitext(src.name)[0] + ".irx") for src in source
+    ]
+    return target, source
+
+
 def _invoke_git(args, source_dir):
     cmd = ["git"]
     cmd.extend(args)
@@ -131,6 +139,7 @@ def generate(env):
             ICONSCOMSTR="\tICONS\t${TARGET}",
             PROTOCOMSTR="\tPROTO\t${SOURCE}",
             DOLPHINCOMSTR="\tDOLPHIN\t${DOLPHIN_RES_TYPE}",
+            IRINDEXCOMSTR="\tIRINDEX\t${TARGET.dir}",
             RESMANIFESTCOMSTR="\tMANIFEST\t${TARGET}",
             PBVERCOMSTR="\tPBVER\t${TARGET}",
         )
@@ -167,6 +176,13 @@ def generate(env):
                 ),
                 emitter=dolphin_emitter,
             ),
+            "InfraredIndexBuilder": Builder(
+                action=Action(
+                    "${PYTHON3} ${ASSETS_COMPILER} infrared ${SOURCE.dir} ${TARGET.dir}",
+                    "${IRINDEXCOMSTR}",
+                ),
+                emitter=infrared_index_emitter,
+            ),
             "ProtoVerBuilder": Builder(
                 action=Action(
                     proto_ver_generator,
@@ -0,0 +1,178 @@
+import logging
+import os
+import struct
+
+from flipper.utils.fff import FlipperFormatFile
+
+# Must match applications/main/infrared/infrared_brute_force.c
+INFRARED_INDEX_MAGIC = 0x31585249  # "IRX1"
+INFRARED_INDEX_VERSION = 1
+INFRARED_INDEX_EXTENSION = ".irx"
+
+# Must match applications/main/infrared/infrared_signal.c
+INFRARED_SIGNAL_TYPE_PARSED = 0
+INFRARED_SIGNAL_TYPE_RAW = 1
+
+# Must match lib/infrared/worker/infrared_worker.h
+INFRARED_MAX_TIMINGS_AMOUNT = 1024
+
+# Address and command lengths in bits, must match lib/infrared/encoder_decoder
+INFRARED_PROTOCOLS = {
+    "NEC": (8, 8),
+    "NECext": (16, 16),
+    "NEC42": (13, 8),
+    "NEC42ext": (26, 16),
+    "Samsung32": (8, 8),
+    "RC6": (8, 8),
+    "RC5": (5, 6),
+    "RC5X": (5, 7),
+    "SIRC": (5, 7),
+    "SIRC15": (8, 7),
+    "SIRC20": (13, 7),
+    "Kaseikyo": (26, 10),
+    "RCA": (4, 8),
+}
+
+
+class InfraredSignal:
+    def __init__(self, name: str):
+        self.name = name
+        self.protocol = None
+        self.address = 0
+        self.command = 0
+        self.frequency = 0
+        self.duty_cycle = 0.0
+        self.timings = None
+
+    @staticmethod
+    def _readHex(value: str):
+        data = bytes.fromhex(value)
+        if len(data) != 4:
+            raise ValueError(f"Expected 4 bytes, got {len(data)}")
+        return int.from_bytes(data, "little")
+
+    # Same checks as infrared_signal_read, device skips signals that fail them
+    def _validate(self):
+        if self.timings is not None:
+            if len(self.timings) > INFRARED_MAX_TIMINGS_AMOUNT:
+                raise ValueError(f"Too many timings: {len(self.timings)}")
+            return
+
+        if self.protocol not in INFRARED_PROTOCOLS:
+            raise ValueError(f"Unknown protocol {self.protocol}")
+        address_length, command_length = INFRARED_PROTOCOLS[self.protocol]
+        if self.address >> address_length:
+            raise ValueError(f"Address is out of range: {self.address:#x}")
+        if self.command >> command_length:
+            raise ValueError(f"Command is out of range: {self.command:#x}")
+
+    def load(self, fff: FlipperFormatFile):
+        signal_type = fff.readKey("type")
+        if signal_type == "parsed":
+            self.protocol = fff.readKey("protocol")
+            self.address = self._readHex(fff.readKey("address"))
+            self.command = self._readHex(fff.readKey("command"))
+        elif signal_type == "raw":
+            self.frequency = fff.readKeyInt("frequency")
+            self.duty_cycle = fff.readKeyFloat("duty_cycle")
+            self.timings = fff.readKeyIntArray("data")
+        else:
+            raise ValueError(f"Unknown signal type {signal_type}")
+        self._validate()
+
+    def pack(self):
+        if self.timings is not None:
+            return struct.pack(
+                f"<BIfI{len(self.timings)}I",
+                INFRARED_SIGNAL_TYPE_RAW,
+                self.frequency,
+                self.duty_cycle,
+                len(self.timings),
+                *self.timings,
+            )
+
+        protocol = self.protocol.encode()
+        return struct.pack(
+            f"<BB{len(protocol)}sII",
+            INFRARED_SIGNAL_TYPE_PARSED,
+            len(protocol),
+            protocol,
+            self.address,
+            self.command,
+        )
+
+
+class InfraredIndex:
+    HEADER_FORMAT = "<6I"
+
+    def __init__(self):
+        self.source_size = 0
+        self.signals = []
+        self.logger = logging.getLogger("InfraredIndex")
+
+    def load(self, filename: str):
+        self.source_size = os.path.getsize(filename)
+        fff = FlipperFormatFile()
+        fff.load(filename)
+        fff.getHeader()
+
+        # Same as on device: look for the next `name` key, skip broken signals
+        while True:
+            try:
+                key, value = fff.readKeyValue()
+            except EOFError:
+                break
+            if key != "name":
+                continue
+            signal = InfraredSignal(value)
+            cursor = fff.cursor
+            try:
+                signal.load(fff)
+            except (EOFError, KeyError, ValueError) as e:
+                self.logger.warning(f"{filename}: skipping signal {value}: {e}")
+                fff.cursor = cursor
+                continue
+            self.signals.append(signal)
+
+    def save(self, filename: str):
+        header_size = struct.calcsize(self.HEADER_FORMAT)
+        records = bytearray()
+        names = {}
+        for signal in self.signals:
+            names.setdefault(signal.name, []).append(header_size + len(records))
+            records += signal.pack()
+
+        table = bytearray()
+        for name, offsets in names.items():
+            name = name.encode()
+            if len(name) > 255:
+                raise Exception(f"Signal name is too long: {name}")
+            table += struct.pack(
+                f"<B{len(name)}sI{len(offsets)}I",
+                len(name),
+                name,
+                len(offsets),
+                *offsets,
+            )
+
+        header = struct.pack(
+            self.HEADER_FORMAT,
+            INFRARED_INDEX_MAGIC,
+            INFRARED_INDEX_VERSION,
+            self.source_size,
+            len(self.signals),
+            len(names),
+            header_size + len(records),
+        )
+
+        with open(filename, "wb") as file:
+            file.write(header)
+            file.write(records)
+            file.write(table)
+
+    @staticmethod
+    def compile(source_filename: str, target_filename: str):
+        index = InfraredIndex()
+        index.load(source_filename)
+        index.save(target_filename)
+        return index